@@ -0,0 +1,109 @@
+/* engine.h -- Reusable synthesis engine definition
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef RU_TTS_ENGINE_H
+#define RU_TTS_ENGINE_H
+
+#include <stdint.h>
+
+#include "ru_tts.h"
+#include "sink.h"
+#include "timing.h"
+#include "modulation.h"
+#include "transcription.h"
+#include "synth.h"
+#include "soundscript.h"
+
+
+/* Streamed text buffer size */
+#define STREAM_BUFFER_SIZE 4096
+
+/* Pulled transcription log size */
+#define TRANSCRIPTION_LOG_SIZE (8 * TRANSCRIPTION_BUFFER_SIZE)
+
+
+/*
+ * Compiled configuration.
+ *
+ * Keeps the speech parameters in the form ready for synthesis.
+ * It is never changed after compilation, so it may be shared
+ * by any number of engines working simultaneously.
+ */
+struct ru_tts_compiled_conf
+{
+  int flags;
+  int sample_format;
+  int sample_rate;
+  int first_chunk;
+  timing_t timing;
+  modulation_t modulation;
+};
+
+/*
+ * Synthesis engine.
+ *
+ * Holds all the working buffers used during text transfer,
+ * so they are allocated only once and reused from call to call.
+ * Their sizes do not depend on the input text length.
+ *
+ * The ttscb member must be the first one, since the transcription
+ * callbacks may get the whole engine by its address.
+ */
+struct ru_tts_engine
+{
+  ttscb_t ttscb;
+  sink_t transcription_consumer;
+  input_t input;
+  uint8_t transcription[TRANSCRIPTION_BUFFER_SIZE];
+  sink_flag_t cancelled;
+
+  /* Configuration compiled for transfers with plain parameters */
+  ru_tts_compiled_conf_t conf;
+
+  /* Incremental text streaming state */
+  int streaming;
+  int stream_started;
+  size_t stream_checked;
+  size_t stream_length;
+  char stream[STREAM_BUFFER_SIZE];
+
+  /* Pulled speech state */
+  int pulling;
+  int pull_started;
+  int phrase_pending;
+  int sound_pending;
+  int text_done;
+  sound_producer_t producer;
+  size_t slice_length;
+  size_t slice_offset;
+  int8_t slice[SOUND_SLICE];
+  const char *source;
+  size_t source_length;
+  size_t source_offset;
+  size_t piece_length;
+  int piece_partial;
+
+  /* Transcription state at the current piece start */
+  input_t piece_input;
+  transcription_state_t piece_state;
+  size_t piece_transcription_length; /* Unfinished clause transcription */
+  uint8_t piece_transcription[TRANSCRIPTION_BUFFER_SIZE];
+
+  /* Transcriptions of the current text piece waiting for synthesis */
+  int log_overflow;
+  unsigned int log_skip;
+  unsigned int log_count;
+  size_t log_length;
+  size_t log_offset;
+  uint8_t log[TRANSCRIPTION_LOG_SIZE];
+};
+
+
+#endif
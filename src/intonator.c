@@ -17,10 +17,16 @@
 #include "modulation.h"
 
 
+/* Local macros */
+
+/* Indexed breakpoint search result for any index */
+#define BREAKPOINT(breakpoints, end, i) (((i) < (end)) ? (breakpoints)[i] : -1)
+
+
 /* Static data */
 
 /* Intonation plans for various clause types */
-static const uint8_t intonations[][NSTAGES][2] =
+static const uint8_t intonations[CLAUSE_TYPES][NSTAGES][2] =
   {
     {
       { 30, 40 },
@@ -252,36 +258,33 @@ static const uint8_t intonations[][NSTAGES][2] =
 /* Local routines */
 
 /*
- * Search transcription buffer for a speech breakpoint
- * ahead from specified index.
+ * Index speech breakpoints in the transcription buffer
+ * from TRANSCRIPTION_START up to the specified end.
  *
- * Returns the last checked code or -1 if nothing found.
+ * For every index the breakpoint search result is stored.
+ * It is the code following the first word ahead from this index
+ * or -1 if nothing found. The search is done in one backward pass.
  */
-static int search_breakpoint(uint8_t *transcription, int start_index)
+static void index_breakpoints(uint8_t *transcription, uint16_t end, int16_t *breakpoints)
 {
-  int rc = -1;
-  int i;
+  int16_t mark = -1;
+  uint16_t i;
 
-  for (i = start_index; i < TRANSCRIPTION_BUFFER_SIZE; i++)
+  breakpoints[end] = -1;
+  for (i = end; i > TRANSCRIPTION_START; i--)
     {
-      rc = transcription[i];
-      if (rc != 43)
-        {
-          if (rc > 43)
-            return -1;
-          break;
-        }
+      uint8_t code = transcription[i - 1];
+      if (code == 43)
+        breakpoints[i - 1] = breakpoints[i];
+      else if (code > 43)
+        breakpoints[i - 1] = -1;
+      else breakpoints[i - 1] = mark;
+      if (code > 42)
+        mark = code;
     }
-  for (i++; i < TRANSCRIPTION_BUFFER_SIZE; i++)
-    {
-      rc = transcription[i];
-      if (rc > 42)
-        return rc;
-    }
-  return -1;
 }
 
-static unsigned int eval_tone(unsigned int x, unsigned int pitch_factor, modulation_t *modulation)
+static unsigned int eval_tone(unsigned int x, unsigned int pitch_factor, const modulation_t *modulation)
 {
   return pitch_factor / ((modulation->maxtone - modulation->mintone) * x / 100 + modulation->mintone);
 }
@@ -308,8 +311,11 @@ static uint16_t setstage(soundscript_t *script, uint16_t start_index, uint8_t va
  * Setup modulation parameters according to specified voice pitch
  * and intonation level expressed as a percentage of the default values.
  */
-void modulation_setup(modulation_t *modulation, int voice_pitch, int intonation)
+void modulation_setup(modulation_t *modulation, int voice_pitch, int intonation,
+                      unsigned int pitch_factor)
 {
+  unsigned int i, k;
+
   /* Adjust voice pitch */
   if (voice_pitch < 50)
     modulation->mintone = 50;
@@ -323,24 +329,37 @@ void modulation_setup(modulation_t *modulation, int voice_pitch, int intonation)
     modulation->maxtone += (intonation < 140) ?
       (((modulation->mintone >> 1) + 25) * intonation / 100) :
       (modulation->mintone * 7 / 10 + 35);
+
+  /* Evaluate stage tones */
+  for (i = 0; i < CLAUSE_TYPES; i++)
+    for (k = 0; k < NSTAGES; k++)
+      {
+        modulation->tones[i][k][0] = eval_tone(intonations[i][k][0], pitch_factor, modulation);
+        modulation->tones[i][k][1] = eval_tone(intonations[i][k][1], pitch_factor, modulation);
+      }
 }
 
-/* Apply intonation parameters to the sound script */
-void apply_intonation(uint8_t *transcription, soundscript_t *soundscript,
-                      modulation_t *modulation, uint8_t clause_type)
+/*
+ * Apply intonation parameters to the sound script according
+ * to the transcription from TRANSCRIPTION_START up to the specified end.
+ */
+void apply_intonation(uint8_t *transcription, uint16_t end, soundscript_t *soundscript,
+                      const modulation_t *modulation, uint8_t clause_type)
 {
+  int16_t breakpoints[TRANSCRIPTION_BUFFER_SIZE + 1];
   uint16_t i = TRANSCRIPTION_START;
   uint16_t nspeechmarks = 0;
   int bp;
 
-  while (i < TRANSCRIPTION_BUFFER_SIZE)
+  index_breakpoints(transcription, end, breakpoints);
+  while (i < end)
     {
-      bp = search_breakpoint(transcription, i);
+      bp = breakpoints[i];
       if (bp < 0)
         break;
       if (bp != 54)
         nspeechmarks++;
-      while (((++i) < TRANSCRIPTION_BUFFER_SIZE) &&
+      while (((++i) < end) &&
              ((transcription[i] >= 53) || (transcription[i] < 43)));
     }
 
@@ -378,7 +397,7 @@ void apply_intonation(uint8_t *transcription, soundscript_t *soundscript,
                   stage = 0;
                   st4 = 1;
                 }
-              bp = search_breakpoint(transcription, i);
+              bp = BREAKPOINT(breakpoints, end, i);
               m = ((bp != 53) && (bp != 54)) ? 1 : 2;
             }
 
@@ -424,7 +443,7 @@ void apply_intonation(uint8_t *transcription, soundscript_t *soundscript,
                   else
                     {
                       j++;
-                      bp = search_breakpoint(transcription, i + 1);
+                      bp = BREAKPOINT(breakpoints, end, i + 1);
                       if (bp < 0)
                         break;
                       else if (bp != 54)
@@ -457,8 +476,8 @@ void apply_intonation(uint8_t *transcription, soundscript_t *soundscript,
           if ((prevk != ((uint16_t)k)) && (soundscript->voice->sound_lengths[j] < VOICE_THRESHOLD))
             {
               int q = 0;
-              int tone1 = eval_tone(intonations[clause_type][k][0], soundscript->voice->pitch_factor, modulation);
-              int tone2 = eval_tone(intonations[clause_type][k][1], soundscript->voice->pitch_factor, modulation) - tone1;
+              int tone1 = modulation->tones[clause_type][k][0];
+              int tone2 = modulation->tones[clause_type][k][1] - tone1;
               soundscript->icb[k].period = 1;
               soundscript->icb[k].count = 1;
               if (tone2)
@@ -13,17 +13,33 @@
 
 #include <stdint.h>
 
-/* Pitch and intonation control data */
+
+/* Number of intonation stages */
+#define NSTAGES 12
+
+/* Number of clause types distinguished by intonation */
+#define CLAUSE_TYPES 16
+
+
+/*
+ * Pitch and intonation control data.
+ *
+ * Tones of every intonation stage are precomputed
+ * for all clause types and the chosen voice.
+ */
 typedef struct
 {
   uint16_t mintone;
   uint16_t maxtone;
+  uint16_t tones[CLAUSE_TYPES][NSTAGES][2];
 } modulation_t;
 
 /*
  * Setup modulation parameters according to specified voice pitch
- * and intonation level expressed as a percentage of the default values.
+ * and intonation level expressed as a percentage of the default values
+ * for the voice with specified pitch factor.
  */
-extern void modulation_setup(modulation_t *modulation, int voice_pitch, int intonation);
+extern void modulation_setup(modulation_t *modulation, int voice_pitch, int intonation,
+                             unsigned int pitch_factor);
 
 #endif
@@ -0,0 +1,1606 @@
+/* noise.c -- Precomputed noise waveforms
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/* This file is generated by noisegen. Do not edit. */
+
+#include <stdint.h>
+
+#include "soundscript.h"
+
+
+const noise_bank_t noise_bank =
+  {
+    /* Slots */
+    {
+      0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 2, 3,
+      4, 5, 6, 7, 8, 9, 10, 11, 0, 0, 0, 0,
+      0, 0, 0, 0, 0, 0, 0, 0, 0
+    },
+
+    /* Samples */
+    {
+      {
+        16, -6, 7, -4, 2, 15, 9, 20, -4, 9, 11, -2, 22, 7, 5, 2,
+        16, -4, 6, -2, 17, 11, 16, 1, 19, 12, 0, 23, -10, 29, 2, 9,
+        0, 0, 18, 7, 6, 0, 19, 9, 20, 13, 18, 16, 0, 7, 12, -2,
+        5, -2, 17, 10, 18, -1, 21, 10, 18, 16, -2, 25, 5, 8, -1, 2,
+        16, 10, 19, -3, 8, -3, 19, -7, 23, 8, 2, 6, -5, 6, -6, 5,
+        -5, 19, -9, 9, 11, 13, 18, 12, 20, -3, 10, 11, -1, 21, -9, 27,
+        5, 22, 13, 16, 19, 12, 22, 11, 22, -4, 26, -10, 12, 10, -3, 8,
+        -7, 7, -6, 20, -10, 10, -5, 18, -6, 5, 15, -8, 27, 1, 10, 14,
+        14, 17, 14, 18, -1, 8, 13, -3, 22, -9, 11, 10, -2, 23, 5, 23,
+        10, 20, 14, 17, 17, 15, 3, 20, -5, 7, -2, 17, -4, 5, 0, -2,
+        19, -10, 12, -9, 7, 11, 12, 17, 13, 3, 3, 1, 16, 11, 1, 5,
+        13, -3, 21, -8, 25, -10, 9, -3, 16, -3, 2, 18, 6, 24, -9, 13,
+        8, 1, 20, 8, 21, -4, 25, 7, 4, 4, 13, 15, 14, 3, 3, 17,
+        9, 20, -4, 25, -10, 11, 11, -4, 8, 9, 1, 18, -5, 23, -8, 8,
+        13, -6, 10, -9, 8, 9, 15, -2, 6, 14, 12, 2, 3, 16, -6, 8,
+        11, 14, 0, 4, 0, 0, 1, -2, 17, -8, 9, 10, -2, 6, 12, 14,
+        15, 0, 21, -7, 25, -10, 10, -3, 0, 18, 5, 8, 13, -1, 20, -6,
+        24, -8, 8, -2, 15, 14, 13, 21, 10, 7, 0, 4, 13, -3, 21, -7,
+        8, 13, 11, 19, 11, 5, 1, 18, -7, 25, 5, 22, 13, 17, 18, -2,
+        26, 4, 24, 10, 4, 4, -2, 19, -9, 26, -12, 28, 4, 5, 5, 11,
+        1, 0, 19, -10, 29, -15, 31, 2, 23, -3, 21, -4, 4, 3, 11, 17,
+        -6, 28, -15, 32, 0, 10, 0, -1, 20, -11, 29, 0, 26, 9, 20, 16,
+        15, 20, -4, 27, -12, 14, -8, 5, 14, -7, 10, -8, 23, -12, 11, -6,
+        3, -1, -2, 3, 11, 15, 13, 19, 13, 19, -2, 24, -9, 11, 11, 13,
+        2, 18, 13, -1, 24, -11, 13, -8, 22, 7, 3, 21, -10, 13, -9, 23,
+        -11, 10, 11, -4, 25, 3, 26, -8, 12, 11, 14, 18, -3, 10, 10, 0,
+        4, 15, -5, 23, -10, 27, -11, 10, 12, 10, 5, -2, 5, 11, 16, -3,
+        9, 11, 15, 15, 0, 6, 14, -4, 7, 12, -3, 6, -4, 19, -8, 8,
+        12, 12, 2, 2, 2, -2, 19, 7, 21, 12, 3, 20, -7, 10, 10, 14,
+        0, 20, -5, 23, -8, 8, -2, -1, 19, 5, 8, 13, 15, 15, 1, 20,
+        -6, 8, -3, 17, 11, 15, 2, 19, 13, 15, 2, 2, 2, 13, -2, 4,
+        0, 15, 13, 15, 18, -3, 9, -5, 21, 7, 20, 13, 1, 7, 12, -1,
+        20, -6, 8, -3, 1, 17, -9, 27, 2, 25, 10, 20, 16, -1, 9, -5,
+        6, -5, 3, -3, 1, 15, -6, 24, 5, 6, 18, 10, 5, 1, 2, 15,
+        -5, 6, -3, 17, -6, 6, -2, 16, 12, -2, 24, 5, 24, 9, 21, 13,
+        18, 17, -1, 24, 6, 7, 17, -5, 25, -11, 12, -6, 19, -6, 21, -6,
+        5, 17, 7, 8, 13, 1, 18, 12, 0, 23, 6, 23, 10, 5, 19, 10,
+        20, 13, 19, -1, 7, 14, -5, 8, -5, 20, 7, 4, 19, 9, 21, 11,
+        20, -2, 23, 8, 4, 20, 8, 6, 16, -3, 22, 8, 4, 20, -8, 12,
+        -8, 6, -4, 17, 10, 16, 16, -2, 25, -11, 13, -8, 21, 8, 18, 0,
+        19, -3, 5, 1, -3, 5, 10, 0, 1, 1, 14, -3, 4, -1, -1, 17,
+        7, 5, 16, 12, 17, 15, 16, 17, 0, 7, 13, 13, 16, -1, 23, -8,
+        26, -10, 26, 7, 19, 1, 18, -1, 18, -2, 19, -3, 3, 19, -11, 30,
+        -1, 12, 12, -2, 7, -4, 20, 7, 4, 18, -6, 26, -12, 28, -12, 11,
+        12, -6, 27, 0, 28, 6, 8, 1, 1, 17, 8, 4, 17, -5, 8, -3,
+        2, 15, -7, 9, -7, 21, 7, 20, -2, 6, 0, -1, 3, 12, 14, 13,
+        2, 3, 1, -1, 1, 14, 12, 16, 16, -1, 7, -3, 3, 14, 11, 17,
+        14, 2, 21, -7, 25, -10, 27, -10, 25, -8, 22, -5, 3, 4, 9, 3,
+        -3, 6, -7, 7, -8, 6, 10, -2, 21, 8, 20, 13, 1, 22, -9, 12,
+        9, -1, 5, -4, 4, -3, 2, -2, 1, -1, 15, -6, 7, 13, -4, 24,
+        -11, 13, -8, 5, 14, -7, 26, -13, 14, 7, 16, 15, -2, 9, -6, 6,
+        -5, 19, 8, 19, 14, 16, 2, 4, 1, 15, 12, 15, 17, -2, 25, 6,
+        23, 11, 3, 5, -3, 4, 13, -3, 5, 14, 11, 2, 3, 16, -6, 24,
+        -11, 11, 10, -3, 24, -12, 14, -9, 23, 6, 19, 15, 14, 4, 17, 14,
+        15, 3, 18, -3, 6, 15, 9, 21, -6, 27, 4, 24, 11, 2, 6, 12,
+        15, 14, 2, 19, 11, 18, 0, 5, 16, 10, 4, 17, -4, 22, 8, 19,
+        15, -1, 25, -11, 14, 7, 17, 15, 15, 2, 3, 1, -1, 2, -3, 18,
+        7, 20, 12, 2, 21, -8, 27, 4, 6, 18, 9, 6, 16, -3, 6, -2,
+        16, 11, 16, 1, 4, 1, -2, 19, -9, 11, 9, 0, 5, -3, 3, -3,
+        17, -7, 8, 12, -4, 7, -6, 21, -10, 26, 5, 5, 20, -9, 13, -9,
+        24, 5, 21, -3, 6, 16, -7, 27, -14, 15, 6, 1, 5, -4, 5, 11,
+        14, 14, 17, 15, 17, -1, 7, 14, -3, 7, 12, -3, 22, 7, 5, 19,
+        10, 20, 12, 3, 4, -1, 18, -7, 24, -10, 10, 12, -4, 9, 8, 2,
+        1, 17, -7, 25, 5, 22, -4, 7, -1, -1, 3, -5, 4, 10, -1, 3,
+        15, -6, 9, 10, 15, -1, 5, 15, -5, 24, -11, 12, -6, 3, 15, -8,
+        11, -8, 23, 5, 21, 12, 1, 7, -4, 5, 11, 14, 15, 0, 5, 15,
+        -4, 23, -10, 27, -11, 27, -10, 8, -1, 13, 16, 10, 23, -8, 14, -10,
+        9, 10, -2, 22, -10, 12, 9, -1, 22, -10, 28, -13, 13, -7, 19, 11,
+        15, 3, 16, 15, -3, 10, 9, 2, 17, -5, 7, -2, 17, 11, 0, 23,
+        -10, 29, 2, 24, 11, 2, 23, -10, 30, 1, 26, 10, 19, 0, 4, 2,
+        -3, 4, 11, 15, -3, 8, 11, 15, 15, 0, 22, 8, 20, 14, 17, 1,
+        4, 1, 15, -4, 21, 9, 18, 0, 19, 12, 16, 2, 2, 19, -9, 12,
+        -9, 23, 6, 20, 14, 16, 2, 19, 13, 0, 24, 5, 8, -1, 19, 9,
+        19, -2, 22, -7, 8, -2, 0, 18, -10, 12, 7, 2, 18, -7, 9, -5,
+        3, -2, -1, 17, -9, 10, 9, 15, 15, 0, 7, 13, -2, 21, -8, 26,
+        -10, 26, 7, 2, 7, 10, 18, 10, 22, -6, 11, -6, 21, 7, 19, -2,
+        5, 16, 9, 5, 16, -2, 5, -1, 0, 1, -3, 18, -9, 10, 9, 15,
+        0, 4, 0, 15, -4, 21, -7, 23, -8, 23, -6, 6, 17, -10, 30, -18,
+        35, -18, 17, -9, 4, 17, 6, 9, 12, 18, -4, 10, 10, 0, 4, -1,
+        17, 10, 18, -2, 6, 15, -5, 25, -12, 29, 3, 7, 3, -2, 5, 10,
+        16, 12, 19, -3, 25, 6, 22, 12, 18, 1, 20, -5, 22, -6, 7, 15,
+        8, 7, 14, 16, -3, 9, 10, 0, 20, 9, 19, -2, 22, -7, 8, 14,
+        -6, 26, 2, 10, -2, 19, 9, 2, 5, 13, -2, 20, -7, 24, 8, 3,
+        6, -5, 6, -6, 21, 5, 22, -5, 24, 8, 19, 16, 14, 20, 12, 22,
+        -5, 11, 10, 15, 15, 0, 23, -9, 11, -6, 20, 9, 17, 1, 19, -3,
+        21, -5, 5, 0, 13, -1, 1, 3, 12, 0, 18, -4, 21, -6, 22, 10,
+        16, 19, 11, 23, -7, 29, -14, 15, -9, 21, -7, 6, 15, -8, 29, -16,
+        17, -12, 8, 11, 11, 19, -5, 11, 9, 17, 13, 1, 5, -2, 18, -7,
+        8, -4, 18, -6, 22, -7, 7, -1, -2, 20, 4, 25, 7, 23, -5, 26,
+        7, 5, 4, -3, 21, -11, 28, 2, 24, -5, 24, -7, 23, 10, 0, 25,
+        -14, 17, -13, 26, 3, 6, 18, 8, 23, -7, 28, -12, 13, 9, -2, 23,
+        4, 9, 14, 14, 16, 0, 6, 14, -4, 23, -10, 27, -11, 11, 12, 11,
+        5, 15, 16, 13, 20, -4, 11, 10, 16, 14, 1, 22, -8, 26, -11, 11,
+        11, 12, 4, 16, -1, 19, -4, 21, -6, 22, 11, 15, 4, 16, 16, 12,
+        5, 0, 4, -4, 21, -10, 27, 3, 23, 12, 17, 2, 3, 19, -9, 12,
+        -9, 7, -5, 2, 15, 9, 19, 12, 20, -3, 24, -9, 26, -10, 26, 7,
+        2, 24, 3, 27, -10, 15, 7, 1, 4, 13, 14, -1, 7, 12, 14, 0,
+        21, 8, 4, 3, 15, -3, 5, -2, 0, 1, 14, -3, 5, 15, -6, 25,
+        -12, 29, -13, 28, 5, 4, 22, -12, 16, 3, 21, -6, 9, -4, 18, 10,
+        0, 22, -10, 29, 2, 9, 0, 16, -3, 4, 16, 9, 21, 10, 22, 12,
+        20, -2, 24, -8, 9, 12, 11, 20, 11, 6, 1, 19, -8, 10, -6, 20,
+        8, 18, 15, -1, 25, 5, 24, -6, 26, 6, 5, 4, 13, -1, 2, 17,
+        8, 21, 10, 21, -3, 25, -9, 26, -10, 9, 13, 9, 22, 8, 24, -7,
+        13, 9, 0, 21, 8, 21, 12, 19, 15, 17, 17, 15, 18, 14, 3, 4,
+        0, 17, -6, 7, -3, 1, 0, -2, 18, 7, 5, 1, 17, 10, 18, -2,
+        22, -7, 25, 7, 19, 0, 3, 3, 12, 0, 17, -4, 20, 11, 0, 24,
+        -12, 15, -10, 24, -11, 26, -10, 25, 9, 0, 25, -14, 18, 2, 22, -6,
+        25, -9, 25, 7, 2, 23, -12, 32, -1, 12, 13, 13, 18, 13, 20, -3,
+        25, 6, 22, 12, 2, 7, 12, -1, 19, 10, 2, 21, 7, 6, 0, 18,
+        10, 19, 14, 1, 22, -9, 11, -6, 20, -8, 7, 14, 10, 5, -1, 4,
+        -4, 4, 12, 13, 15, 0, 21, -7, 9, 12, 12, 19, 12, 20, -4, 10,
+        11, -2, 6, 13, 13, 16, 15, 16, 16, 16, 17, 16, 1, 6, 15, 12,
+        18, 14, 2, 5, -1, 2, 15, 10, 18, -2, 23, 8, 4, 20, -8, 27,
+        -13, 30, -13, 12, 11, 11, 5, -2, 22, 4, 9, -2, 4, 13, 12, 17,
+        -1, 7, -2, 2, -1, -1, 17, -8, 9, -6, 4, -3, 0, 16, 8, 4,
+        17, -4, 23, 7, 4, 20, -8, 28, 2, 25, 10, 19, 16, 15, 20, -4,
+        27, 4, 24, -6, 9, 13, -5, 9, -7, 22, -11, 27, 4, 22, -2, 21,
+        12, -1, 25, 3, 27, -9, 13, -7, 21, 8, 17, 0, 3, 2, 13, 15,
+        -3, 9, -6, 6, -5, 3, -3, 0, 0, -1, 17, -8, 25, 5, 22, -4,
+        7, -1, -1, 3, 11, -1, 2, 1, -2, 18, -9, 11, 9, 15, 15, -1,
+        23, 7, 6, 1, 0, 17, -7, 25, 5, 6, 18, 9, 5, 17, 13, 1,
+        22, -8, 11, 10, -2, 6, -4, 4, -4, 2, -2, 17, -6, 23, -9, 9,
+        13, -5, 26, -14, 16, 6, 2, 4, 13, 14, 14, 1, 20, 11, 18, 16,
+        -1, 8, -5, 21, 6, 5, 18, 10, 20, -4, 9, 12, -3, 7, -4, 20,
+        7, 4, 19, 9, 5, 18, 11, 2, 20, 9, 4, 19, 10, 3, 3, 0,
+        1, -1, 0, -1, 0, 0, -1, 0, 15, 10, 18, 14, 1, 6, -3, 3,
+        -2, 1, 15, 10, 2, 19, -6, 25, -10, 26, 6, 4, 22, 5, 25, 7,
+        24, 10, 5, 3, 15, 12, 0, 6, 13, -3, 21, -8, 25, 6, 20, -1
+      },
+      {
+        8, 0, -4, 3, 0, 4, 10, 6, -2, 1, 10, -1, 4, 14, -3, -4,
+        15, -1, -8, 8, 8, 2, 10, 2, 4, 12, -1, 4, 7, 3, 8, 1,
+        -3, 3, 8, 6, -1, 1, 10, 7, 5, 10, 9, 6, 1, 0, 9, 1,
+        -4, 4, 8, 5, 7, 2, 6, 11, 6, 7, 3, 6, 10, -2, -2, 5,
+        6, 6, 8, 0, -2, 3, 7, -1, 6, 12, -4, -2, 6, -3, -3, 4,
+        -1, 5, 3, -4, 9, 11, 2, 9, 11, -3, -1, 13, -2, 2, 8, 4,
+        7, 10, 6, 7, 10, 7, 7, 9, 8, 0, 8, 4, -5, 10, 3, -8,
+        4, 3, -6, 9, 3, -8, 4, 11, -5, -2, 14, -2, 1, 16, -3, 2,
+        18, 4, 3, 15, -1, -5, 15, 0, -1, 8, -3, 4, 6, 3, 9, 9,
+        6, 9, 9, 7, 8, 9, -1, 7, 4, -5, 2, 11, -3, -4, 6, -2,
+        4, 4, -4, 0, 3, 5, 8, 7, 7, 1, -1, 2, 8, 7, -2, 0,
+        11, -1, 3, 6, 4, 0, 0, 1, 7, 0, -3, 11, 9, 2, 2, 1,
+        7, 1, 5, 12, 6, -2, 10, 11, -5, 0, 14, 5, 4, 5, -2, 7,
+        11, 4, 0, 10, 1, -5, 12, 2, -8, 13, 3, -2, 7, 7, -3, 0,
+        12, -2, -5, 6, -1, 3, 12, -2, -4, 14, 7, -7, 4, 12, -5, -3,
+        15, 6, -6, 4, 3, -6, 1, 2, 4, 1, -2, 9, 1, -5, 12, 10,
+        1, 3, 10, -1, 5, 5, -4, 0, 3, 5, 8, 0, 6, 4, 4, 2,
+        7, 1, -3, 2, 8, 6, 6, 10, 8, -1, 0, 3, 6, 0, 6, 3,
+        -4, 9, 11, 2, 9, 3, -4, 11, 3, 1, 13, 8, 3, 12, 9, -3,
+        9, 13, 2, 8, 4, -4, 2, 10, -3, 5, 6, 3, 9, 1, -4, 11,
+        1, -7, 13, 2, -1, 7, 7, 5, 9, 1, 6, 4, -4, 1, 10, 6,
+        -3, 10, 3, 1, 12, 0, -5, 6, 8, -4, 7, 13, 3, 7, 13, 5,
+        7, 11, -1, 6, 6, -5, 1, 4, 4, 0, -1, 1, 7, 0, -3, 3,
+        0, -3, 2, 0, 6, 10, 6, 7, 10, 7, -1, 9, 3, -5, 11, 11,
+        -7, 9, 15, -8, 7, 10, -9, 0, 15, 3, -4, 13, 2, -8, 6, 10,
+        -6, -1, 14, -3, 2, 16, 4, -4, 5, 9, 4, 8, 2, -3, 10, 2,
+        -6, 12, 2, -1, 6, 7, -2, 0, 11, 7, -4, 2, 3, 4, 9, 0,
+        -2, 12, 8, 3, 3, 1, 7, 1, -4, 10, 2, -7, 5, 10, -4, -2,
+        13, 6, -5, 4, 3, -5, 9, 11, 2, 9, 4, 4, 3, -2, 8, 10,
+        -4, 7, 6, 1, 2, 1, -1, 0, 8, 8, -3, 8, 12, 3, 0, 11,
+        1, -5, 5, 9, 4, 8, 2, 5, 11, 6, -2, 2, 2, 6, 1, -2,
+        2, 8, 7, 6, 9, 0, -2, 3, 7, 6, 7, 9, 0, -1, 11, 0,
+        2, 6, -3, -1, 3, 6, -1, 7, 11, 4, 7, 11, 6, -1, 1, 2,
+        -2, 0, 1, -2, -1, 9, 0, 4, 13, -2, 4, 15, -4, -4, 8, 5,
+        -4, 1, 3, 5, 1, -2, 1, 8, 7, -2, 8, 12, 3, 8, 12, 5,
+        7, 11, -1, 6, 14, -4, 5, 8, 2, 1, 2, -1, 7, 1, 4, 4,
+        -3, 8, 11, -5, 7, 7, 1, 10, 2, 3, 13, 7, 5, 4, 7, 9,
+        7, 8, 9, -1, -1, 11, 0, -6, 5, 8, 4, 0, 9, 10, 4, 9,
+        10, -2, 7, 13, -5, 6, 16, -6, 5, 10, 1, 8, 4, 3, 3, -1,
+        0, 1, -1, 7, 10, 5, 8, 2, 5, 3, -3, 1, 10, 7, 5, 2,
+        7, 2, -3, 2, 1, -3, 9, 2, -6, 4, 9, -4, -2, 5, -3, 5,
+        12, -4, 6, 15, 3, 6, 14, 6, -2, 3, 10, 6, 6, 2, 7, 2,
+        5, 3, 5, 10, 7, -1, 9, 3, 3, 4, 7, 0, -2, 10, 0, 2,
+        14, -2, 3, 8, -5, -1, 13, 6, -5, 11, 4, 0, 5, 7, -2, -1,
+        11, -1, 3, 14, 5, 4, 5, -1, -1, 10, 7, -4, 9, 4, -7, 3,
+        3, 3, 2, -1, 0, 8, 8, 5, 1, 0, 1, 0, -1, 8, 8, 5,
+        1, 1, 1, -1, -1, 8, 8, 5, 9, 1, -3, 3, 0, 5, 10, 6,
+        7, 2, 6, 2, 5, 3, 6, 2, 6, 2, 5, 2, -2, 1, 9, -1,
+        -3, 4, -1, -3, 2, 0, 5, 2, 5, 10, 7, 6, 2, 7, 2, -3,
+        10, 2, -6, 4, 2, -5, 2, 2, -4, 0, 9, -2, -4, 13, 0, 1,
+        7, -3, -3, 4, 6, -2, 7, 4, -5, 10, 11, 2, 1, 3, -1, -1,
+        1, 7, 8, 6, 8, 9, -1, -1, 3, 6, 7, 7, 8, 0, 7, 12,
+        5, 7, 3, -3, 2, 1, 5, 1, -3, 10, 9, -5, 1, 13, -3, 3,
+        8, -5, 7, 6, 1, 2, 1, -1, 8, 9, 4, 9, 10, -2, 7, 13,
+        3, -1, 11, 1, -6, 13, 10, 0, 3, 10, 7, 6, 10, 0, -2, 12,
+        8, 3, 3, 9, 8, 6, 1, 0, 9, 9, -4, 9, 5, 1, 11, 9,
+        4, 2, 9, 1, -3, 11, 9, 2, 11, 2, -5, 4, 1, -4, 1, 9,
+        6, 6, 10, 0, 6, 5, 4, 10, 0, 5, 13, -3, 5, 7, -5, 0,
+        12, 5, 4, 4, -1, 0, 2, 7, 0, -3, 11, 1, -6, 5, 1, -5,
+        10, 2, -7, 12, 3, -9, 5, 11, -6, 7, 15, -7, 6, 10, -8, 0,
+        14, 4, 4, 6, -2, 7, 4, 3, 3, -1, 8, 2, -5, 3, 1, 4,
+        10, 7, 6, 10, 8, -1, 0, 11, -1, -5, 13, 0, 0, 15, -1, 2,
+        17, 5, 3, 6, -2, -1, 11, 0, 3, 6, -3, 7, 4, -6, 10, 4,
+        -8, 12, 4, -1, 14, 9, -6, 3, 5, -5, 0, 3, -3, 7, 3, -6,
+        10, 3, -8, 12, 12, -8, 2, 15, -5, 3, 10, -7, -1, 6, 4, -2,
+        1, 1, 6, 9, 6, 8, 1, -2, 2, 0, 6, 10, 5, -1, 1, 9,
+        -1, 4, 5, 4, 1, 8, 2, -4, 3, 9, 6, 6, 10, -1, -2, 4,
+        -1, 5, 3, 4, 2, -2, 8, 2, 3, 4, 6, 0, -1, 2, 8, 7,
+        6, 1, 7, 11, -3, -1, 13, -2, 2, 8, -4, -2, 12, 6, -5, 11,
+        4, 0, 13, 9, 3, 3, 9, 0, 5, 12, 5, 6, 12, -1, -3, 5,
+        -1, -3, 11, 8, -5, 2, 12, 4, 5, 4, 6, 9, 7, 7, 9, 0,
+        -1, 3, 7, -1, 6, 12, 4, -1, 11, 10, 3, 2, 1, 7, 1, -3,
+        3, 8, 6, 7, 9, 8, -1, 8, 12, -4, 7, 15, -6, -2, 16, 5,
+        2, 6, 7, -1, -1, 3, -2, 6, 2, -4, 10, 3, 1, 5, -1, -2,
+        2, -1, -2, 9, 0, -5, 12, 10, 1, 3, 2, 6, 1, 5, 3, 5,
+        2, 6, 10, -2, -2, 12, 7, 3, 12, 1, -4, 5, 8, 5, 8, 2,
+        -2, 10, 9, -5, 9, 6, -8, 2, 4, -6, 0, 11, -3, -4, 14, 7,
+        -7, 4, 4, 2, 2, 8, 1, 5, 4, 5, 1, -1, 9, 1, 3, 5,
+        5, 0, -1, 2, -1, 6, 10, -3, 7, 14, -5, -2, 15, -3, -7, 8,
+        7, 3, 10, 1, -4, 12, 2, 1, 6, 6, 7, 1, -1, 2, 0, 6,
+        10, 5, 8, 2, 6, 11, 6, 7, 11, -1, 6, 5, 3, 2, 0, 8,
+        9, -3, 8, 13, -5, -2, 15, -3, 1, 17, 4, -5, 14, 3, -9, 14,
+        3, -3, 15, 1, -8, 15, 10, -9, 4, 14, -6, 5, 9, 1, 8, 4,
+        -5, 2, 2, -4, 9, 11, 3, 1, 10, 8, 4, 10, 9, 6, 9, 9,
+        -1, -1, 12, 7, 4, 3, 8, 1, -3, 3, 8, 6, 7, 1, 7, 3,
+        4, 3, -2, 1, 9, -1, -4, 4, 7, -3, 7, 5, 2, 3, 8, 8,
+        6, 8, 9, 7, 0, 8, 3, -5, 2, 10, -3, -3, 13, -1, 1, 8,
+        -3, -2, 4, 6, 6, 8, 0, -1, 11, 8, 3, 3, 1, 0, 8, 1,
+        -4, 3, 8, -3, 6, 5, -6, 1, 3, 4, 8, 8, 6, 9, 1, 6,
+        12, -3, -2, 6, 6, -2, 8, 11, 3, 0, 10, 1, 3, 13, -2, 4,
+        7, -5, -1, 12, 6, -4, 11, 12, 1, 2, 11, -1, -4, 13, 0, 0,
+        15, -2, 2, 16, 5, -5, 5, 10, -4, 6, 6, 2, 2, 1, 7, 9,
+        -3, 7, 13, 3, 7, 4, -3, 9, 11, 3, 1, 10, 0, 3, 5, -3,
+        7, 12, -5, 7, 7, 1, 2, 9, 0, 4, 13, 5, -2, 11, 10, 2,
+        2, 2, -1, 0, 9, 0, 4, 13, 6, 5, 12, -1, -3, 13, 0, -7,
+        6, 1, -6, 3, 9, 4, 7, 11, 7, -1, 9, 3, 3, 4, 6, 8,
+        -1, 7, 12, 4, -1, 3, 9, -1, -3, 12, 8, -6, 2, 12, 4, -3,
+        11, 10, -6, 1, 13, -4, -5, 7, -2, -5, 12, 0, -8, 14, 2, -2,
+        8, 7, -3, 8, 12, -5, 7, 7, -7, 9, 14, -8, -1, 8, 2, 6,
+        3, 5, 2, 6, 10, -2, -2, 12, -1, -6, 14, 9, 0, 12, 11, 3,
+        10, 3, 4, 4, -2, 8, 11, 4, 8, 3, -3, 10, 2, -7, 4, 10,
+        4, 7, 11, -2, 6, 14, 4, -2, 12, 9, -5, 2, 13, -4, -4, 15,
+        7, 1, 13, 9, -5, 10, 5, 0, 4, 0, 6, 10, 6, 7, 10, -1,
+        -2, 12, 0, 2, 15, 6, 4, 13, 8, 5, 11, 9, 5, 10, 1, -3,
+        3, 8, -2, -2, 4, -2, -2, 2, 7, 7, -1, 0, 11, 7, 4, 3,
+        8, 1, 5, 12, 6, -2, 2, 2, 5, 1, 6, 3, 5, 10, -1, 5,
+        6, -5, 0, 11, -3, 4, 7, 3, 8, 2, 5, 4, -3, 8, 11, -5,
+        8, 7, 1, 11, 2, 3, 5, 6, 8, 0, 6, 12, 5, 7, 11, -1,
+        6, 14, 4, 6, 5, -3, 9, 3, 2, 12, 0, 3, 14, -3, -4, 15,
+        7, 1, 13, 1, 2, 6, -3, -2, 11, -1, -6, 14, 9, -8, 3, 5,
+        -6, 0, 12, 5, 4, 4, 6, 1, -2, 10, 9, 3, 10, 10, -3, 0,
+        12, -2, -5, 14, 8, 1, 13, 10, 3, 11, 10, 5, 1, 1, 8, 8,
+        5, 9, 1, -2, 3, 0, 5, 10, 6, -1, 9, 11, -5, 8, 6, 1,
+        3, 9, -1, -3, 12, 8, -6, 2, 12, 4, -3, 3, 1, 5, 10, 6,
+        -1, 1, 2, -2, -1, 1, 6, 0, -3, 3, 0, -3, 1, 8, 7, -2,
+        8, 4, 2, 12, 0, 4, 6, 4, 8, 9, 7, 8, 9, 7, 8, 1,
+        7, 11, 5, -1, 2, 9, -1, -3, 4, 7, -2, 7, 12, 4, -1, 11,
+        9, -5, 9, 14, 1, 0, 4, -1, 6, 11, 5, -1, 2, 1, 6, 9,
+        -2, -1, 4, -2, -2, 2, -1, -2, 1, 0, 6, 2, 4, 11, 6, -2,
+        2, 2, -3, 0, 9, -1, -4, 5, 0, 4, 3, -3, 8, 11, 3, 1,
+        10, 9, -4, 1, 4, 5, 0, 7, 10, -3, 7, 14, -5, 6, 16, -6,
+        5, 10, -8, 7, 8, -8, 1, 5, -6, -1, 4, 4, -1, 7, 2, -4,
+        10, 2, 1, 5, -1, 6, 3, -4, 9, 11, 2, 1, 11, 8, 5, 10,
+        1, -3, 4, 8, 6, -1, 9, 11, 4, 0, 2, 8, 0, -3, 4, 8,
+        6, -1, 8, 11, -4, 7, 14, -6, 6, 17, -7, 5, 18, -7, -4, 10,
+        -4, -5, 7, -2, -5, 4, 0, -4, 10, 9, 2, 10, 2, -4, 3, 1,
+        -4, 1, 9, 6, -2, 9, 3, 2, 4, 7, 8, -1, 7, 12, 4, 7,
+        11, 6, -1, 2, 10, 7, -3, 1, 11, -2, 4, 6, 3, 8, 9, -2
+      },
+      {
+        4, 2, -2, -1, 1, 4, 5, 4, 0, -1, 4, 2, 2, 4, 1, -2,
+        3, 3, -2, -2, 4, 7, 3, -1, 3, 7, 1, 1, 1, 4, 5, 0,
+        -2, 0, 5, 5, -1, -3, 4, 7, 4, 2, 5, 6, 0, -2, 4, 3,
+        -2, -2, 5, 7, 3, -1, 3, 7, 5, 3, 0, 4, 6, 0, -3, 0,
+        5, 6, 3, -1, -1, 1, 4, 1, 2, 5, 1, -2, -1, 1, 0, -1,
+        -1, 4, 2, -2, 3, 7, 5, 2, 4, 2, -1, 3, 3, 2, 0, 3,
+        6, 5, 3, 4, 5, 5, 4, 4, 5, 0, 2, 2, -1, 3, 2, -1,
+        -1, 0, 0, 3, 1, -2, -1, 5, 2, -3, 3, 3, 3, 4, 1, 2,
+        6, 5, 3, 4, 1, -1, 4, 2, 2, 0, -1, 4, 2, 2, 4, 5,
+        4, 4, 5, 5, 4, 4, 0, 3, 2, -1, -1, 4, 2, -2, -2, 1,
+        4, 1, -2, -1, 1, 4, 5, 4, 4, 1, -1, 0, 4, 6, 0, -3,
+        4, 3, 2, 0, 3, 2, -2, -1, 5, 2, -3, 2, 7, 5, -2, -2,
+        5, 3, 1, 4, 6, 0, 1, 6, 2, -3, 3, 7, 5, -2, -2, 5,
+        7, 3, -1, 3, 3, -1, 2, 2, -1, 2, 2, 3, 0, 3, 2, -1,
+        3, 2, -1, -2, 0, 4, 5, 0, -2, 4, 7, 0, -4, 4, 4, -2,
+        1, 7, 1, -4, -1, 2, 0, -2, 3, 2, -2, 2, 3, -1, 2, 6,
+        5, -1, 2, 3, 3, 0, -2, 0, 1, 4, 5, 0, 2, 2, 4, 1,
+        2, 1, -1, -1, 4, 6, 4, 3, 5, 1, -2, -1, 5, 2, 1, 1,
+        0, 3, 6, 4, 3, 0, -1, 4, 2, 2, 4, 5, 4, 4, 5, 1,
+        2, 6, 5, 3, 0, -1, 0, 4, 1, 2, 1, 3, 5, 0, -2, 4,
+        3, -2, 2, 3, 3, 0, 2, 6, 5, -1, 2, 3, -1, -2, 4, 6,
+        0, 1, 2, 4, 5, 0, -2, 0, 5, 1, 1, 5, 6, 4, 3, 5,
+        5, 4, 0, 3, 2, -1, -1, 0, 4, 1, -2, -1, 5, 2, -3, -2,
+        1, 0, -2, -1, 4, 6, 4, 3, 5, 5, 0, 2, 2, -1, 3, 6,
+        1, 1, 6, 2, 1, 1, 0, -1, 4, 6, 0, 1, 2, 0, -1, 4,
+        2, -2, 2, 3, 3, 4, 5, 0, -2, 4, 7, 4, -1, -1, 5, 3,
+        -3, 2, 3, 3, 0, 3, 2, -1, 3, 6, 1, -3, 0, 6, 6, -1,
+        -3, 5, 7, 3, -2, -1, 5, 2, -3, 2, 3, -1, -2, 4, 3, -2,
+        2, 7, 1, -4, -1, 2, 4, 4, 4, 4, 1, 2, 2, -1, 3, 6,
+        1, 1, 2, 4, 1, -2, -1, 1, 4, 5, 0, 2, 6, 6, -1, 2,
+        3, 0, -2, 4, 6, 4, -1, 3, 7, 5, -1, -2, 1, 5, 1, -3,
+        -1, 5, 6, 3, 3, 1, -1, -1, 4, 6, 4, 3, 1, -1, 4, 2,
+        2, 0, -1, 0, 0, 4, 1, 2, 5, 5, 4, 4, 5, 1, -2, 0,
+        1, 0, -1, -1, 0, 4, 1, 2, 5, 1, 2, 5, 2, -2, -1, 5,
+        2, -3, -1, 5, 2, -3, -2, 5, 6, -1, 1, 7, 6, 3, 3, 5,
+        5, 4, 0, 3, 6, 1, 1, 1, 4, 1, -2, -1, 5, 2, 1, 1,
+        0, 3, 6, 0, 1, 2, 4, 5, 0, 2, 6, 5, 3, 0, 3, 6,
+        5, 3, 4, 1, -1, 3, 3, -2, -2, 5, 6, -1, 1, 6, 6, 3,
+        3, 1, 3, 5, 1, 2, 6, 2, 1, 1, 4, 5, 0, 2, 2, 0,
+        -1, 0, 0, 3, 5, 4, 3, 0, 3, 2, -1, -1, 4, 6, 4, -1,
+        3, 3, -1, -2, 0, 1, 3, 1, -2, -1, 5, 2, -3, -1, 1, 4,
+        5, 0, 2, 6, 5, 3, 4, 5, 1, -2, 4, 7, 4, -2, 2, 3,
+        3, 0, 3, 6, 5, -1, 2, 3, 3, 0, 2, 2, -1, 3, 2, 3,
+        4, 1, 2, 1, -1, -1, 4, 6, 0, 1, 2, 4, 1, 2, 2, -1,
+        3, 2, 3, 5, 5, 4, 0, -1, 0, 5, 5, -1, 1, 2, 0, -2,
+        0, 4, 1, -2, -1, 5, 6, 3, -1, -1, 1, 0, -1, 3, 6, 4,
+        -1, -2, 1, 1, -1, 3, 6, 4, 3, 0, -1, 0, 0, 3, 5, 4,
+        3, 0, 3, 2, 3, 1, 3, 1, 3, 1, 3, 1, -1, -1, 4, 2,
+        -2, -1, 1, 0, -1, -1, 4, 2, 2, 5, 5, 4, 0, 3, 2, -1,
+        2, 2, -1, -2, 0, 0, -1, -1, 0, 0, 3, 1, -2, 3, 3, 3,
+        0, -1, 0, 0, 3, 1, 2, 1, -1, 3, 6, 4, -1, -2, 1, 1,
+        -1, 3, 6, 4, 3, 4, 1, -1, -1, 5, 6, 3, 3, 1, 3, 6,
+        5, 3, 0, -1, 0, 0, 3, 1, -2, 3, 7, 0, -3, 4, 4, 2,
+        -1, -1, 4, 2, 2, 1, -1, 0, 4, 6, 4, 3, 5, 1, 2, 5,
+        5, 0, 2, 2, 0, 2, 6, 5, -1, 2, 7, 5, 3, 0, -1, 4,
+        6, 4, -1, 3, 7, 5, -1, -2, 5, 7, -1, 0, 2, 4, 4, 4,
+        4, 1, 3, 2, -1, 3, 6, 5, 3, 0, -1, 0, 0, -1, -1, 4,
+        6, 4, 3, 0, 3, 2, 3, 5, 1, 2, 5, 1, 1, 1, 0, -1,
+        4, 6, 4, -1, -2, 1, 1, 3, 1, -2, 3, 2, -2, -2, 0, 0,
+        3, 1, -2, 3, 2, -2, -2, 4, 2, 1, 4, 2, 2, 1, -1, -1,
+        4, 6, 4, -1, -1, 5, 3, 2, 0, 0, 4, 2, -2, -1, 1, 4,
+        5, 4, 4, 5, 5, 0, -2, 4, 3, -2, 2, 3, 3, 4, 1, 2,
+        6, 5, 3, 0, -1, 0, 4, 1, 2, 1, -1, 3, 2, -2, 3, 3,
+        -1, 2, 2, 3, 4, 5, 0, -2, 0, 1, -1, -1, 0, 4, 1, -2,
+        3, 3, -1, 2, 6, 1, -3, 3, 4, 2, 0, -1, 0, 0, 3, 1,
+        -2, -1, 5, 6, 3, 3, 1, -1, 0, 0, 4, 5, 4, -1, -2, 4,
+        3, 2, 0, 3, 2, 2, 1, -1, -1, 4, 6, 4, 3, 1, -1, 0,
+        0, 4, 1, 2, 1, -1, 3, 2, 2, 1, 3, 2, -1, -1, 4, 6,
+        4, -1, 3, 7, 1, -3, 3, 4, 2, -1, -1, 0, 4, 5, 0, 1,
+        2, 4, 5, 4, 4, 0, 3, 2, 3, 5, 5, 4, 4, 1, -1, 0,
+        1, 0, 3, 6, 0, -3, 4, 7, 4, -2, 2, 7, 5, 2, 4, 2,
+        -1, -1, 4, 2, 2, 5, 6, 0, 2, 6, 6, -1, -2, 5, 3, -3,
+        -2, 5, 7, 3, 3, 5, 1, 2, 5, 1, 2, 5, 2, -2, 3, 7,
+        4, -2, 2, 3, -1, -2, 0, 5, 1, -3, 3, 3, 2, 0, -1, 0,
+        0, -1, -1, 4, 2, -2, 3, 7, 5, -1, -2, 5, 3, 1, 0, 4,
+        2, 2, 5, 1, -2, 3, 7, 4, 2, 0, 0, 0, 4, 5, 4, -1,
+        -1, 4, 7, 0, 1, 2, 0, -2, -1, 0, 0, 3, 1, -2, 3, 7,
+        1, -3, 0, 6, 2, 1, 1, 4, 1, 2, 1, -1, 3, 2, 2, 1,
+        3, 2, -1, -1, 0, 4, 5, 0, 2, 6, 2, -3, 3, 3, -1, -2,
+        4, 7, 3, -2, -1, 5, 2, 1, 0, 4, 6, 0, -3, 0, 1, 3,
+        4, 4, 4, 0, 3, 6, 5, 3, 4, 1, 3, 1, 3, 1, -1, 3,
+        6, 0, 1, 6, 2, -3, 3, 3, 3, 4, 5, 1, 2, 2, -1, 3,
+        2, 3, 5, 1, -2, 3, 7, 0, -3, 4, 4, 2, -1, 3, 6, 0,
+        -3, 0, 1, 0, 2, 6, 5, -1, 2, 7, 5, 3, 4, 5, 5, 4,
+        0, -1, 4, 6, 4, -1, 3, 3, -1, -2, 4, 7, 4, -1, 3, 3,
+        3, 0, -1, 0, 4, 1, -2, -1, 5, 2, 1, 0, 4, 2, 2, 5,
+        5, 4, 4, 5, 1, 2, 2, -1, -1, 4, 2, -2, 2, 3, 3, 0,
+        -1, 0, 0, 3, 5, 4, 0, -2, 4, 7, 4, -1, -1, 1, 4, 1,
+        -2, -1, 5, 2, 1, 1, 0, -1, 0, 4, 5, 4, 3, 4, 1, 2,
+        6, 1, -3, -1, 5, 2, 1, 5, 6, 0, 1, 2, 4, 5, 0, 2,
+        2, -1, -1, 4, 6, 0, 1, 6, 6, -1, 1, 3, 0, 2, 2, 3,
+        5, 1, 2, 6, 5, -1, -2, 5, 3, 2, 0, 3, 2, -2, 3, 7,
+        1, 1, 6, 6, 3, -1, -1, 5, 6, 4, -1, 3, 3, 3, 0, -1,
+        4, 6, 0, 1, 2, 4, 1, 2, 1, 3, 5, 4, 0, 2, 6, 5,
+        -1, -2, 1, 1, 3, 1, 2, 5, 5, 4, 4, 1, -1, 4, 2, -2,
+        -2, 1, 0, -1, 3, 6, 4, 3, 4, 1, 2, 1, 3, 1, 3, 5,
+        1, 2, 5, 6, -1, -2, 4, 3, -2, 2, 7, 1, -4, 3, 8, 0,
+        0, 6, 3, -3, 2, 3, -1, -2, 0, 1, 3, 1, -2, 3, 3, 2,
+        0, 3, 2, 3, 5, 1, 2, 1, -1, 3, 6, 1, -3, 0, 5, 6,
+        -1, 1, 3, 4, 4, 0, -2, 4, 3, -2, 2, 7, 5, 3, 4, 6,
+        5, 0, 2, 2, -1, 2, 6, 5, 3, 0, -1, 4, 2, -2, -2, 5,
+        6, 3, 3, 1, 3, 6, 5, -1, 2, 6, 1, -3, 3, 4, -2, 2,
+        7, 5, 3, 4, 1, 3, 1, 3, 1, -1, 3, 6, 4, 3, 4, 1,
+        -2, 3, 3, 2, 4, 5, 4, 4, 4, 5, 4, 4, 4, 5, 0, -2,
+        0, 5, 1, -3, -1, 1, 0, -1, 3, 6, 0, -3, 4, 8, 4, -2,
+        2, 3, 3, 4, 5, 0, -2, 0, 5, 2, 1, 1, 4, 5, 0, 2,
+        2, 0, -1, 4, 2, 2, 0, 3, 6, 0, 1, 2, 0, 3, 6, 1,
+        1, 2, 4, 5, 0, 2, 2, 3, 5, 0, 2, 6, 5, 3, 4, 1,
+        3, 6, 5, 3, 0, -1, 4, 2, 2, 4, 1, 2, 5, 1, -2, 3,
+        7, 4, 2, 0, 4, 2, -2, -1, 5, 2, -3, 2, 7, 1, -4, -1,
+        2, 0, 2, 5, 5, -1, 2, 2, -1, 2, 6, 5, 3, 4, 1, -1,
+        3, 2, -2, 2, 7, 5, 3, 4, 5, 5, 4, 4, 1, -1, 4, 7,
+        4, 3, 0, -1, 0, 0, 3, 5, 4, -1, 2, 6, 1, 1, 1, 4,
+        1, 2, 1, -1, 3, 6, 0, -3, 4, 7, 0, -4, 0, 6, 5, 3,
+        -1, -1, 0, 0, -1, -1, 4, 2, -2, -1, 1, 0, -1, 3, 6, 0,
+        1, 2, 4, 5, 0, 2, 2, 3, 5, 4, 4, 4, 5, 4, 4, 0,
+        3, 6, 5, -1, -2, 5, 3, -2, -2, 5, 3, 1, 4, 6, 0, 1,
+        6, 2, 1, 5, 6, 0, -3, 0, 5, 5, 3, -1, -1, 0, 4, 5,
+        0, -2, 0, 1, -1, -1, 0, 0, -1, -1, 4, 2, 2, 5, 5, 0,
+        -2, 0, 1, -1, 3, 2, -1, -1, 0, 4, 1, -2, 3, 7, 4, -2,
+        2, 7, 1, -4, -1, 6, 2, 1, 5, 2, 2, 5, 1, 2, 5, 1,
+        2, 1, 0, 3, 2, -2, -1, 0, 0, -1, -1, 4, 2, 2, 1, -1,
+        3, 2, 2, 1, -1, 3, 2, -2, 2, 7, 5, -1, 2, 7, 5, 3,
+        0, 0, 0, 4, 5, 0, 1, 6, 6, -1, -2, 5, 3, -3, -2, 5,
+        7, -1, 1, 7, 2, 1, 5, 2, 2, 5, 1, 2, 5, 1, -2, -1,
+        1, 0, -1, -1, 0, 0, -1, -1, 4, 6, 4, 3, 1, -1, 0, 0,
+        0, -1, 4, 6, 0, 1, 2, 4, 1, 2, 5, 1, 1, 5, 6, 4,
+        3, 5, 1, -2, 4, 7, 0, -3, 4, 4, 2, -1, 3, 6, 4, -1
+      },
+      {
+        8, -3, 3, -2, 1, 7, 4, 10, -2, 4, 5, -1, 11, 3, 2, 1,
+        8, -2, 3, -1, 8, 5, 8, 0, 9, 6, 0, 11, -5, 14, 1, 4,
+        0, 0, 9, 3, 3, 0, 9, 4, 10, 6, 9, 8, 0, 3, 6, -1,
+        2, -1, 8, 5, 9, -1, 10, 5, 9, 8, -1, 12, 2, 4, -1, 1,
+        8, 5, 9, -2, 4, -2, 9, -4, 11, 4, 1, 3, -3, 3, -3, 2,
+        -3, 9, -5, 4, 5, 6, 9, 6, 10, -2, 5, 5, -1, 10, -5, 13,
+        2, 11, 6, 8, 9, 6, 11, 5, 11, -2, 13, -5, 6, 5, -2, 4,
+        -4, 3, -3, 10, -5, 5, -3, 9, -3, 2, 7, -4, 13, 0, 5, 7,
+        7, 8, 7, 9, -1, 4, 6, -2, 11, -5, 5, 5, -1, 11, 2, 11,
+        5, 10, 7, 8, 8, 7, 1, 10, -3, 3, -1, 8, -2, 2, 0, -1,
+        9, -5, 6, -5, 3, 5, 6, 8, 6, 1, 1, 0, 8, 5, 0, 2,
+        6, -2, 10, -4, 12, -5, 4, -2, 8, -2, 1, 9, 3, 12, -5, 6,
+        4, 0, 10, 4, 10, -2, 12, 3, 2, 2, 6, 7, 7, 1, 1, 8,
+        4, 10, -2, 12, -5, 5, 5, -2, 4, 4, 0, 9, -3, 11, -4, 4,
+        6, -3, 5, -5, 4, 4, 7, -1, 3, 7, 6, 1, 1, 8, -3, 4,
+        5, 7, 0, 2, 0, 0, 0, -1, 8, -4, 4, 5, -1, 3, 6, 7,
+        7, 0, 10, -4, 12, -5, 5, -2, 0, 9, 2, 4, 6, -1, 10, -3,
+        12, -4, 4, -1, 7, 7, 6, 10, 5, 3, 0, 2, 6, -2, 10, -4,
+        4, 6, 5, 9, 5, 2, 0, 9, -4, 12, 2, 11, 6, 8, 9, -1,
+        13, 2, 12, 5, 2, 2, -1, 9, -5, 13, -6, 14, 2, 2, 2, 5,
+        0, 0, 9, -5, 14, -8, 15, 1, 11, -2, 10, -2, 2, 1, 5, 8,
+        -3, 14, -8, 16, 0, 5, 0, -1, 10, -6, 14, 0, 13, 4, 10, 8,
+        7, 10, -2, 13, -6, 7, -4, 2, 7, -4, 5, -4, 11, -6, 5, -3,
+        1, -1, -1, 1, 5, 7, 6, 9, 6, 9, -1, 12, -5, 5, 5, 6,
+        1, 9, 6, -1, 12, -6, 6, -4, 11, 3, 1, 10, -5, 6, -5, 11,
+        -6, 5, 5, -2, 12, 1, 13, -4, 6, 5, 7, 9, -2, 5, 5, 0,
+        2, 7, -3, 11, -5, 13, -6, 5, 6, 5, 2, -1, 2, 5, 8, -2,
+        4, 5, 7, 7, 0, 3, 7, -2, 3, 6, -2, 3, -2, 9, -4, 4,
+        6, 6, 1, 1, 1, -1, 9, 3, 10, 6, 1, 10, -4, 5, 5, 7,
+        0, 10, -3, 11, -4, 4, -1, -1, 9, 2, 4, 6, 7, 7, 0, 10,
+        -3, 4, -2, 8, 5, 7, 1, 9, 6, 7, 1, 1, 1, 6, -1, 2,
+        0, 7, 6, 7, 9, -2, 4, -3, 10, 3, 10, 6, 0, 3, 6, -1,
+        10, -3, 4, -2, 0, 8, -5, 13, 1, 12, 5, 10, 8, -1, 4, -3,
+        3, -3, 1, -2, 0, 7, -3, 12, 2, 3, 9, 5, 2, 0, 1, 7,
+        -3, 3, -2, 8, -3, 3, -1, 8, 6, -1, 12, 2, 12, 4, 10, 6,
+        9, 8, -1, 12, 3, 3, 8, -3, 12, -6, 6, -3, 9, -3, 10, -3,
+        2, 8, 3, 4, 6, 0, 9, 6, 0, 11, 3, 11, 5, 2, 9, 5,
+        10, 6, 9, -1, 3, 7, -3, 4, -3, 10, 3, 2, 9, 4, 10, 5,
+        10, -1, 11, 4, 2, 10, 4, 3, 8, -2, 11, 4, 2, 10, -4, 6,
+        -4, 3, -2, 8, 5, 8, 8, -1, 12, -6, 6, -4, 10, 4, 9, 0,
+        9, -2, 2, 0, -2, 2, 5, 0, 0, 0, 7, -2, 2, -1, -1, 8,
+        3, 2, 8, 6, 8, 7, 8, 8, 0, 3, 6, 6, 8, -1, 11, -4,
+        13, -5, 13, 3, 9, 0, 9, -1, 9, -1, 9, -2, 1, 9, -6, 15,
+        -1, 6, 6, -1, 3, -2, 10, 3, 2, 9, -3, 13, -6, 14, -6, 5,
+        6, -3, 13, 0, 14, 3, 4, 0, 0, 8, 4, 2, 8, -3, 4, -2,
+        1, 7, -4, 4, -4, 10, 3, 10, -1, 3, 0, -1, 1, 6, 7, 6,
+        1, 1, 0, -1, 0, 7, 6, 8, 8, -1, 3, -2, 1, 7, 5, 8,
+        7, 1, 10, -4, 12, -5, 13, -5, 12, -4, 11, -3, 1, 2, 4, 1,
+        -2, 3, -4, 3, -4, 3, 5, -1, 10, 4, 10, 6, 0, 11, -5, 6,
+        4, -1, 2, -2, 2, -2, 1, -1, 0, -1, 7, -3, 3, 6, -2, 12,
+        -6, 6, -4, 2, 7, -4, 13, -7, 7, 3, 8, 7, -1, 4, -3, 3,
+        -3, 9, 4, 9, 7, 8, 1, 2, 0, 7, 6, 7, 8, -1, 12, 3,
+        11, 5, 1, 2, -2, 2, 6, -2, 2, 7, 5, 1, 1, 8, -3, 12,
+        -6, 5, 5, -2, 12, -6, 7, -5, 11, 3, 9, 7, 7, 2, 8, 7,
+        7, 1, 9, -2, 3, 7, 4, 10, -3, 13, 2, 12, 5, 1, 3, 6,
+        7, 7, 1, 9, 5, 9, 0, 2, 8, 5, 2, 8, -2, 11, 4, 9,
+        7, -1, 12, -6, 7, 3, 8, 7, 7, 1, 1, 0, -1, 1, -2, 9,
+        3, 10, 6, 1, 10, -4, 13, 2, 3, 9, 4, 3, 8, -2, 3, -1,
+        8, 5, 8, 0, 2, 0, -1, 9, -5, 5, 4, 0, 2, -2, 1, -2,
+        8, -4, 4, 6, -2, 3, -3, 10, -5, 13, 2, 2, 10, -5, 6, -5,
+        12, 2, 10, -2, 3, 8, -4, 13, -7, 7, 3, 0, 2, -2, 2, 5,
+        7, 7, 8, 7, 8, -1, 3, 7, -2, 3, 6, -2, 11, 3, 2, 9,
+        5, 10, 6, 1, 2, -1, 9, -4, 12, -5, 5, 6, -2, 4, 4, 1,
+        0, 8, -4, 12, 2, 11, -2, 3, -1, -1, 1, -3, 2, 5, -1, 1,
+        7, -3, 4, 5, 7, -1, 2, 7, -3, 12, -6, 6, -3, 1, 7, -4,
+        5, -4, 11, 2, 10, 6, 0, 3, -2, 2, 5, 7, 7, 0, 2, 7,
+        -2, 11, -5, 13, -6, 13, -5, 4, -1, 6, 8, 5, 11, -4, 7, -5,
+        4, 5, -1, 11, -5, 6, 4, -1, 11, -5, 14, -7, 6, -4, 9, 5,
+        7, 1, 8, 7, -2, 5, 4, 1, 8, -3, 3, -1, 8, 5, 0, 11,
+        -5, 14, 1, 12, 5, 1, 11, -5, 15, 0, 13, 5, 9, 0, 2, 1,
+        -2, 2, 5, 7, -2, 4, 5, 7, 7, 0, 11, 4, 10, 7, 8, 0,
+        2, 0, 7, -2, 10, 4, 9, 0, 9, 6, 8, 1, 1, 9, -5, 6,
+        -5, 11, 3, 10, 7, 8, 1, 9, 6, 0, 12, 2, 4, -1, 9, 4,
+        9, -1, 11, -4, 4, -1, 0, 9, -5, 6, 3, 1, 9, -4, 4, -3,
+        1, -1, -1, 8, -5, 5, 4, 7, 7, 0, 3, 6, -1, 10, -4, 13,
+        -5, 13, 3, 1, 3, 5, 9, 5, 11, -3, 5, -3, 10, 3, 9, -1,
+        2, 8, 4, 2, 8, -1, 2, -1, 0, 0, -2, 9, -5, 5, 4, 7,
+        0, 2, 0, 7, -2, 10, -4, 11, -4, 11, -3, 3, 8, -5, 15, -9,
+        17, -9, 8, -5, 2, 8, 3, 4, 6, 9, -2, 5, 5, 0, 2, -1,
+        8, 5, 9, -1, 3, 7, -3, 12, -6, 14, 1, 3, 1, -1, 2, 5,
+        8, 6, 9, -2, 12, 3, 11, 6, 9, 0, 10, -3, 11, -3, 3, 7,
+        4, 3, 7, 8, -2, 4, 5, 0, 10, 4, 9, -1, 11, -4, 4, 7,
+        -3, 13, 1, 5, -1, 9, 4, 1, 2, 6, -1, 10, -4, 12, 4, 1,
+        3, -3, 3, -3, 10, 2, 11, -3, 12, 4, 9, 8, 7, 10, 6, 11,
+        -3, 5, 5, 7, 7, 0, 11, -5, 5, -3, 10, 4, 8, 0, 9, -2,
+        10, -3, 2, 0, 6, -1, 0, 1, 6, 0, 9, -2, 10, -3, 11, 5,
+        8, 9, 5, 11, -4, 14, -7, 7, -5, 10, -4, 3, 7, -4, 14, -8,
+        8, -6, 4, 5, 5, 9, -3, 5, 4, 8, 6, 0, 2, -1, 9, -4,
+        4, -2, 9, -3, 11, -4, 3, -1, -1, 10, 2, 12, 3, 11, -3, 13,
+        3, 2, 2, -2, 10, -6, 14, 1, 12, -3, 12, -4, 11, 5, 0, 12,
+        -7, 8, -7, 13, 1, 3, 9, 4, 11, -4, 14, -6, 6, 4, -1, 11,
+        2, 4, 7, 7, 8, 0, 3, 7, -2, 11, -5, 13, -6, 5, 6, 5,
+        2, 7, 8, 6, 10, -2, 5, 5, 8, 7, 0, 11, -4, 13, -6, 5,
+        5, 6, 2, 8, -1, 9, -2, 10, -3, 11, 5, 7, 2, 8, 8, 6,
+        2, 0, 2, -2, 10, -5, 13, 1, 11, 6, 8, 1, 1, 9, -5, 6,
+        -5, 3, -3, 1, 7, 4, 9, 6, 10, -2, 12, -5, 13, -5, 13, 3,
+        1, 12, 1, 13, -5, 7, 3, 0, 2, 6, 7, -1, 3, 6, 7, 0,
+        10, 4, 2, 1, 7, -2, 2, -1, 0, 0, 7, -2, 2, 7, -3, 12,
+        -6, 14, -7, 14, 2, 2, 11, -6, 8, 1, 10, -3, 4, -2, 9, 5,
+        0, 11, -5, 14, 1, 4, 0, 8, -2, 2, 8, 4, 10, 5, 11, 6,
+        10, -1, 12, -4, 4, 6, 5, 10, 5, 3, 0, 9, -4, 5, -3, 10,
+        4, 9, 7, -1, 12, 2, 12, -3, 13, 3, 2, 2, 6, -1, 1, 8,
+        4, 10, 5, 10, -2, 12, -5, 13, -5, 4, 6, 4, 11, 4, 12, -4,
+        6, 4, 0, 10, 4, 10, 6, 9, 7, 8, 8, 7, 9, 7, 1, 2,
+        0, 8, -3, 3, -2, 0, 0, -1, 9, 3, 2, 0, 8, 5, 9, -1,
+        11, -4, 12, 3, 9, 0, 1, 1, 6, 0, 8, -2, 10, 5, 0, 12,
+        -6, 7, -5, 12, -6, 13, -5, 12, 4, 0, 12, -7, 9, 1, 11, -3,
+        12, -5, 12, 3, 1, 11, -6, 16, -1, 6, 6, 6, 9, 6, 10, -2,
+        12, 3, 11, 6, 1, 3, 6, -1, 9, 5, 1, 10, 3, 3, 0, 9,
+        5, 9, 7, 0, 11, -5, 5, -3, 10, -4, 3, 7, 5, 2, -1, 2,
+        -2, 2, 6, 6, 7, 0, 10, -4, 4, 6, 6, 9, 6, 10, -2, 5,
+        5, -1, 3, 6, 6, 8, 7, 8, 8, 8, 8, 8, 0, 3, 7, 6,
+        9, 7, 1, 2, -1, 1, 7, 5, 9, -1, 11, 4, 2, 10, -4, 13,
+        -7, 15, -7, 6, 5, 5, 2, -1, 11, 2, 4, -1, 2, 6, 6, 8,
+        -1, 3, -1, 1, -1, -1, 8, -4, 4, -3, 2, -2, 0, 8, 4, 2,
+        8, -2, 11, 3, 2, 10, -4, 14, 1, 12, 5, 9, 8, 7, 10, -2,
+        13, 2, 12, -3, 4, 6, -3, 4, -4, 11, -6, 13, 2, 11, -1, 10,
+        6, -1, 12, 1, 13, -5, 6, -4, 10, 4, 8, 0, 1, 1, 6, 7,
+        -2, 4, -3, 3, -3, 1, -2, 0, 0, -1, 8, -4, 12, 2, 11, -2,
+        3, -1, -1, 1, 5, -1, 1, 0, -1, 9, -5, 5, 4, 7, 7, -1,
+        11, 3, 3, 0, 0, 8, -4, 12, 2, 3, 9, 4, 2, 8, 6, 0,
+        11, -4, 5, 5, -1, 3, -2, 2, -2, 1, -1, 8, -3, 11, -5, 4,
+        6, -3, 13, -7, 8, 3, 1, 2, 6, 7, 7, 0, 10, 5, 9, 8,
+        -1, 4, -3, 10, 3, 2, 9, 5, 10, -2, 4, 6, -2, 3, -2, 10,
+        3, 2, 9, 4, 2, 9, 5, 1, 10, 4, 2, 9, 5, 1, 1, 0,
+        0, -1, 0, -1, 0, 0, -1, 0, 7, 5, 9, 7, 0, 3, -2, 1,
+        -1, 0, 7, 5, 1, 9, -3, 12, -5, 13, 3, 2, 11, 2, 12, 3,
+        12, 5, 2, 1, 7, 6, 0, 3, 6, -2, 10, -4, 12, 3, 10, -1
+      },
+      {
+        8, 4, -5, -3, 3, 9, 9, 6, -1, -2, 9, 5, 2, 8, 4, -4,
+        6, 7, -3, -5, 10, 15, 5, -6, 6, 17, 1, -3, 4, 12, 9, -4,
+        -5, 4, 12, 9, -4, -4, 12, 15, 4, 2, 11, 13, -2, -7, 10, 10,
+        -7, -7, 13, 17, 3, -7, 8, 18, 8, 0, 1, 11, 12, -2, -7, 3,
+        14, 9, 3, -1, 0, 2, 8, 2, 3, 11, 3, -6, -2, 4, 1, -4,
+        -1, 10, 4, -7, 5, 17, 10, 1, 7, 6, -3, 4, 6, 6, 0, 5,
+        13, 10, 4, 7, 11, 10, 6, 8, 10, 1, 3, 4, 0, 5, 4, -3,
+        -3, 2, 2, 6, 2, -3, -1, 10, 4, -7, 5, 9, 6, 5, 1, 6,
+        12, 9, 5, 8, 3, -3, 7, 6, 4, -1, -2, 9, 5, 2, 8, 12,
+        8, 6, 9, 11, 8, 7, 1, 6, 5, -2, -3, 10, 6, -6, -4, 5,
+        11, 0, -7, 0, 5, 7, 7, 8, 9, 1, -4, 0, 11, 11, -3, -7,
+        11, 9, 1, -3, 9, 7, -5, -5, 12, 7, -8, 3, 18, 11, -8, -6,
+        15, 9, -2, 5, 15, 2, -1, 11, 7, -6, 3, 17, 11, -7, -6, 14,
+        17, 2, -7, 9, 10, -5, 1, 8, 1, 2, 3, 8, 2, 4, 3, -1,
+        6, 5, -3, -3, 2, 10, 9, -3, -5, 11, 16, -3, -10, 11, 12, -7,
+        -1, 17, 6, -11, -4, 9, 3, -7, 5, 9, -3, 1, 6, 1, 4, 11,
+        11, -3, 2, 7, 8, -1, -4, 1, 3, 7, 9, 0, 3, 5, 7, 1,
+        4, 4, -1, -2, 9, 13, 6, 4, 10, 4, -5, -2, 12, 5, 0, 0,
+        1, 8, 11, 7, 6, 1, -2, 8, 5, 3, 8, 11, 8, 6, 9, 2,
+        4, 11, 11, 6, -2, -2, 2, 9, 2, 2, 3, 8, 10, -1, -6, 9,
+        8, -6, 2, 8, 8, -2, 3, 14, 11, -5, 2, 8, 0, -6, 8, 16,
+        -1, -2, 5, 12, 8, -3, -4, 3, 11, 1, 1, 12, 13, 5, 4, 11,
+        12, 7, -2, 6, 7, -2, -5, 2, 11, 2, -7, -1, 13, 4, -9, -3,
+        7, 2, -6, -2, 12, 13, 4, 4, 12, 12, -2, 2, 7, 1, 3, 11,
+        3, 1, 10, 5, 2, 1, 0, 0, 8, 12, -1, 1, 5, 1, -4, 7,
+        6, -4, 3, 7, 7, 7, 8, 1, -4, 8, 15, 7, -5, -3, 13, 6,
+        -9, 3, 11, 7, -4, 4, 7, -2, 3, 13, 3, -8, -2, 14, 13, -6,
+        -8, 13, 18, 3, -8, 0, 15, 4, -10, 5, 12, -3, -9, 10, 10, -6,
+        0, 17, 5, -11, -3, 8, 10, 5, 5, 10, 3, 3, 3, 0, 6, 12,
+        1, 1, 4, 9, 1, -5, 0, 4, 8, 8, -1, 4, 13, 11, -4, 2,
+        8, 0, -6, 8, 16, 7, -6, 5, 18, 10, -7, -5, 7, 12, -2, -8,
+        2, 14, 10, 2, 6, 5, -2, -3, 10, 14, 6, 3, 2, 0, 7, 4,
+        4, 1, -1, -1, 1, 8, 3, 3, 10, 11, 7, 6, 10, 2, -5, -1,
+        4, 0, -4, -1, 2, 8, 2, 3, 11, 3, 2, 10, 4, -5, -3, 12,
+        6, -8, -4, 14, 7, -10, -5, 15, 15, -7, -2, 18, 15, 1, 3, 15,
+        13, 4, -3, 8, 15, 0, -1, 5, 11, 1, -7, 0, 13, 3, -1, 2,
+        2, 7, 10, 0, 3, 5, 8, 9, 0, 4, 13, 11, 4, -2, 8, 14,
+        8, 3, 8, 4, -4, 6, 7, -3, -5, 10, 15, -2, -2, 15, 15, 3,
+        3, 5, 9, 10, -1, 3, 13, 4, 0, 2, 10, 11, -2, 2, 6, 0,
+        -4, -1, 3, 8, 9, 7, 7, 1, 5, 4, -2, -3, 9, 14, 6, -4,
+        6, 8, -3, -6, 2, 4, 6, 0, -3, 0, 10, 3, -7, -2, 5, 9,
+        7, -2, 4, 14, 10, 3, 7, 12, 2, -7, 8, 17, 8, -7, 5, 10,
+        6, -4, 5, 15, 10, -5, 3, 9, 8, -3, 4, 7, -1, 3, 5, 7,
+        9, 0, 4, 4, -1, -3, 9, 14, -1, -1, 6, 10, 0, 2, 4, 0,
+        5, 3, 6, 10, 9, 7, -1, -2, 1, 10, 10, -2, 2, 7, 0, -5,
+        0, 11, 4, -7, -3, 13, 13, 3, -4, 1, 4, 0, -4, 8, 14, 7,
+        -5, -3, 5, 2, -4, 6, 14, 9, 3, 0, 1, 1, 0, 7, 12, 8,
+        5, 0, 7, 5, 5, 1, 6, 4, 5, 1, 6, 3, -3, -2, 10, 5,
+        -7, -4, 5, 2, -4, -3, 11, 5, 1, 8, 13, 8, -3, 5, 8, -2,
+        3, 5, -1, -4, 0, 2, -1, -3, 0, 1, 7, 2, -5, 6, 7, 4,
+        -1, -2, 1, 1, 6, 2, 4, 2, -2, 7, 13, 8, -4, -4, 4, 3,
+        -4, 5, 14, 9, 3, 7, 4, -3, -2, 10, 13, 5, 4, 3, 8, 11,
+        8, 6, 1, -2, 0, 1, 7, 2, -4, 6, 15, 0, -10, 8, 11, 3,
+        -5, -1, 12, 4, 0, 1, 2, 0, 6, 12, 8, 5, 8, 3, 5, 11,
+        11, -2, 3, 6, 0, 4, 12, 11, -3, 2, 15, 12, 3, -3, 1, 11,
+        11, 5, -3, 7, 15, 9, -5, -4, 13, 15, -5, -1, 8, 11, 6, 5,
+        10, 3, 3, 3, -1, 6, 12, 9, 5, 0, -1, 1, 1, -1, -1, 8,
+        12, 7, 5, 1, 7, 4, 4, 9, 2, 3, 11, 4, 2, 2, 0, -1,
+        8, 12, 7, -3, -3, 4, 2, 5, 1, -3, 7, 6, -4, -4, 3, 3,
+        5, 1, -3, 7, 6, -4, -4, 11, 7, 1, 7, 5, 5, 1, -2, 0,
+        9, 11, 6, -3, -2, 11, 6, 1, 0, 1, 8, 3, -5, -2, 4, 9,
+        8, 6, 8, 10, 9, -1, -4, 10, 7, -6, 3, 8, 7, 6, 0, 6,
+        13, 9, 5, 0, -1, 1, 9, 3, 3, 2, 0, 7, 4, -4, 5, 7,
+        -3, 3, 6, 7, 8, 8, 0, -4, 1, 3, -1, -3, 0, 9, 3, -6,
+        6, 9, -3, 2, 14, 4, -9, 5, 11, 5, -4, -2, 4, 2, 5, 2,
+        -2, -1, 10, 12, 6, 4, 2, -1, -1, 1, 8, 11, 7, -2, -3, 11,
+        6, 1, 0, 9, 5, 3, 1, 0, 0, 8, 12, 7, 5, 1, -1, 0,
+        1, 8, 3, 3, 2, -1, 7, 4, 4, 1, 6, 4, -3, -3, 10, 13,
+        5, -4, 7, 16, 1, -10, 8, 12, 3, -5, -1, 4, 8, 8, -1, 4,
+        6, 7, 8, 8, 8, 0, 5, 5, 6, 9, 9, 8, 8, 1, -3, 0,
+        3, -1, 5, 12, 1, -7, 8, 17, 7, -7, 5, 19, 10, 0, 7, 7,
+        -2, -4, 10, 7, 2, 7, 12, 1, 1, 12, 13, -3, -7, 11, 10, -7,
+        -7, 13, 17, 3, 1, 12, 6, 1, 8, 5, 4, 9, 3, -4, 7, 15,
+        8, -6, 4, 9, -1, -7, 1, 13, 3, -9, 6, 10, 5, -4, -2, 3,
+        1, -3, -2, 10, 4, -6, 5, 17, 10, -7, -5, 14, 8, -2, -2, 11,
+        6, 1, 8, 5, -4, 5, 15, 10, 3, -1, 1, 2, 7, 10, 8, -2,
+        -3, 10, 15, -3, -1, 7, 3, -5, -2, 3, 1, 5, 2, -3, 6, 14,
+        0, -8, 0, 14, 3, -2, 2, 11, 3, 1, 2, 1, 7, 3, 4, 2,
+        7, 3, -3, -2, 2, 9, 9, -2, 3, 14, 4, -8, 6, 11, -3, -8,
+        10, 18, 5, -8, -2, 15, 5, -2, 0, 11, 12, -3, -7, 3, 5, 5,
+        7, 9, 9, -1, 4, 13, 11, 4, 6, 4, 6, 2, 5, 3, -2, 6,
+        14, 1, 0, 12, 6, -7, 4, 9, 6, 5, 9, 3, 4, 3, -1, 6,
+        5, 5, 9, 2, -4, 7, 15, 0, -10, 9, 11, 3, -5, 8, 16, 0,
+        -10, 1, 8, -1, 1, 12, 12, -3, 1, 15, 13, 2, 5, 13, 11, 5,
+        -2, -1, 11, 13, 5, -4, 7, 8, -3, -5, 10, 16, 5, -6, 7, 10,
+        5, -3, -2, 3, 9, 1, -6, -1, 12, 4, 0, 1, 10, 4, 2, 10,
+        12, 7, 5, 10, 3, 4, 3, -1, -2, 8, 5, -5, 5, 8, 6, -2,
+        -3, 2, 2, 6, 10, 8, -1, -4, 10, 15, 6, -5, -2, 5, 9, 0,
+        -6, 1, 12, 3, 0, 2, 2, -1, -2, 8, 13, 7, 4, 9, 4, 4,
+        10, 3, -5, -2, 12, 5, 0, 8, 14, 0, 0, 5, 10, 9, -2, 4,
+        6, -1, -4, 9, 15, -1, -1, 14, 15, -4, -1, 8, 3, 2, 2, 8,
+        11, 0, 2, 13, 13, -4, -7, 12, 9, 0, -3, 9, 7, -6, 3, 16,
+        3, -2, 10, 16, 6, -5, -2, 13, 14, 3, -4, 8, 8, 4, -2, -1,
+        10, 13, -2, 0, 7, 10, -1, 2, 5, 8, 9, 8, 0, 5, 13, 10,
+        -4, -5, 4, 4, 5, 0, 6, 12, 9, 5, 8, 3, -3, 7, 6, -4,
+        -5, 3, 3, -3, 5, 13, 9, 4, 7, 4, 5, 2, 6, 3, 5, 10,
+        2, 3, 11, 12, -2, -7, 11, 9, -7, 1, 17, 4, -11, 5, 21, 1,
+        -6, 12, 10, -7, 1, 9, 1, -7, -1, 5, 8, 0, -5, 9, 8, 3,
+        -2, 8, 6, 4, 8, 3, 4, 3, -1, 6, 13, 0, -8, 0, 14, 11,
+        -6, 1, 9, 9, 5, -1, -2, 10, 5, -6, 4, 16, 10, 1, 7, 14,
+        10, -4, 3, 8, -1, 2, 12, 12, 5, -2, -1, 11, 5, -7, -3, 13,
+        14, 3, 3, 4, 8, 10, 8, -1, 5, 14, 2, -8, 7, 10, -4, 0,
+        15, 13, 3, 4, 5, 8, 1, 4, 4, -1, 6, 13, 9, 4, 8, 4,
+        -3, 6, 6, 5, 7, 10, 9, 7, 8, 10, 9, 8, 8, 9, 1, -4,
+        1, 11, 3, -7, -2, 5, 1, -5, 6, 15, 0, -10, 8, 19, 7, -9,
+        5, 12, 6, 3, 9, 4, -4, -2, 12, 5, 0, 0, 9, 12, -2, 1,
+        6, 1, -4, 7, 7, 4, -1, 7, 13, 1, 0, 4, 2, 5, 10, 1,
+        2, 4, 8, 10, -1, 3, 5, 8, 8, 0, 4, 13, 11, 4, 6, 4,
+        6, 10, 9, 7, 0, -2, 9, 6, 2, 8, 4, 4, 10, 3, -5, 7,
+        16, 8, 2, 0, 9, 5, -5, -3, 12, 6, -8, 4, 18, 3, -12, -1,
+        9, 1, 0, 11, 13, -2, 0, 7, 2, 3, 11, 11, 6, 6, 2, -2,
+        7, 6, -4, 4, 15, 10, 3, 7, 13, 10, 5, 7, 3, -3, 7, 14,
+        8, 3, 0, 0, 1, 0, 7, 12, 8, -3, 4, 15, 2, -1, 3, 11,
+        2, 1, 3, 1, 6, 11, 0, -6, 8, 17, -1, -11, 1, 16, 10, 0,
+        -2, 2, 2, -2, -2, 1, 9, 3, -6, -2, 4, 1, -4, 7, 14, 0,
+        -1, 5, 11, 9, -3, 3, 7, 7, 7, 8, 9, 8, 8, 8, 9, 0,
+        4, 13, 11, -3, -6, 12, 8, -7, -6, 14, 8, -1, 6, 15, 2, -1,
+        11, 7, 2, 8, 13, 1, -7, 1, 14, 11, 3, -2, 1, 3, 8, 9,
+        -1, -5, 1, 4, -1, -4, 0, 2, -1, -2, 8, 5, 3, 8, 11, 0,
+        -6, 1, 5, -1, 4, 4, -2, -3, 1, 10, 3, -6, 6, 17, 9, -7,
+        4, 18, 3, -12, -1, 17, 5, -4, 9, 9, 4, 6, 3, 6, 10, 1,
+        2, 4, 0, 6, 4, -3, -3, 2, 1, -2, -2, 9, 5, 2, 0, 0,
+        8, 4, 3, 1, -1, 7, 4, -4, 5, 15, 10, -6, 3, 17, 12, 1,
+        -2, 2, 3, 6, 9, 0, 3, 12, 12, -3, -6, 11, 9, -7, -7, 13,
+        17, -5, -3, 17, 8, -3, 6, 8, 5, 7, 2, 5, 11, 2, -6, -1,
+        5, 0, -5, -1, 3, 0, -3, -1, 9, 12, 6, 5, 2, -1, -1, 1,
+        0, -1, 7, 12, 0, 1, 5, 9, 1, 2, 12, 4, 1, 10, 13, 7,
+        5, 10, 3, -4, 6, 16, 1, -10, 8, 12, 3, -5, 7, 16, 8, -6
+      },
+      {
+        2, 1, -1, -1, 0, 2, 2, 2, 0, -1, 2, 1, 1, 2, 0, -1,
+        1, 1, -1, -1, 2, 3, 1, -1, 1, 3, 0, 0, 0, 2, 2, 0,
+        -1, 0, 2, 2, -1, -2, 2, 3, 2, 1, 2, 3, 0, -1, 2, 1,
+        -1, -1, 2, 3, 1, -1, 1, 3, 2, 1, 0, 2, 3, 0, -2, 0,
+        2, 3, 1, -1, -1, 0, 2, 0, 1, 2, 0, -1, -1, 0, 0, -1,
+        -1, 2, 1, -1, 1, 3, 2, 1, 2, 1, -1, 1, 1, 1, 0, 1,
+        3, 2, 1, 2, 2, 2, 2, 2, 2, 0, 1, 1, -1, 1, 1, -1,
+        -1, 0, 0, 1, 0, -1, -1, 2, 1, -2, 1, 1, 1, 2, 0, 1,
+        3, 2, 1, 2, 0, -1, 2, 1, 1, 0, -1, 2, 1, 1, 2, 2,
+        2, 2, 2, 2, 2, 2, 0, 1, 1, -1, -1, 2, 1, -1, -1, 0,
+        2, 0, -1, -1, 0, 2, 2, 2, 2, 0, -1, 0, 2, 3, 0, -2,
+        2, 1, 1, 0, 1, 1, -1, -1, 2, 1, -2, 1, 3, 2, -1, -1,
+        2, 1, 0, 2, 3, 0, 0, 3, 1, -2, 1, 3, 2, -1, -1, 2,
+        3, 1, -1, 1, 1, -1, 1, 1, -1, 1, 1, 1, 0, 1, 1, -1,
+        1, 1, -1, -1, 0, 2, 2, 0, -1, 2, 3, 0, -2, 2, 2, -1,
+        0, 3, 0, -2, -1, 1, 0, -1, 1, 1, -1, 1, 1, -1, 1, 3,
+        2, -1, 1, 1, 1, 0, -1, 0, 0, 2, 2, 0, 1, 1, 2, 0,
+        1, 0, -1, -1, 2, 3, 2, 1, 2, 0, -1, -1, 2, 1, 0, 0,
+        0, 1, 3, 2, 1, 0, -1, 2, 1, 1, 2, 2, 2, 2, 2, 0,
+        1, 3, 2, 1, 0, -1, 0, 2, 0, 1, 0, 1, 2, 0, -1, 2,
+        1, -1, 1, 1, 1, 0, 1, 3, 2, -1, 1, 1, -1, -1, 2, 3,
+        0, 0, 1, 2, 2, 0, -1, 0, 2, 0, 0, 2, 3, 2, 1, 2,
+        2, 2, 0, 1, 1, -1, -1, 0, 2, 0, -1, -1, 2, 1, -2, -1,
+        0, 0, -1, -1, 2, 3, 2, 1, 2, 2, 0, 1, 1, -1, 1, 3,
+        0, 0, 3, 1, 0, 0, 0, -1, 2, 3, 0, 0, 1, 0, -1, 2,
+        1, -1, 1, 1, 1, 2, 2, 0, -1, 2, 3, 2, -1, -1, 2, 1,
+        -2, 1, 1, 1, 0, 1, 1, -1, 1, 3, 0, -2, 0, 3, 3, -1,
+        -2, 2, 3, 1, -1, -1, 2, 1, -2, 1, 1, -1, -1, 2, 1, -1,
+        1, 3, 0, -2, -1, 1, 2, 2, 2, 2, 0, 1, 1, -1, 1, 3,
+        0, 0, 1, 2, 0, -1, -1, 0, 2, 2, 0, 1, 3, 3, -1, 1,
+        1, 0, -1, 2, 3, 2, -1, 1, 3, 2, -1, -1, 0, 2, 0, -2,
+        -1, 2, 3, 1, 1, 0, -1, -1, 2, 3, 2, 1, 0, -1, 2, 1,
+        1, 0, -1, 0, 0, 2, 0, 1, 2, 2, 2, 2, 2, 0, -1, 0,
+        0, 0, -1, -1, 0, 2, 0, 1, 2, 0, 1, 2, 1, -1, -1, 2,
+        1, -2, -1, 2, 1, -2, -1, 2, 3, -1, 0, 3, 3, 1, 1, 2,
+        2, 2, 0, 1, 3, 0, 0, 0, 2, 0, -1, -1, 2, 1, 0, 0,
+        0, 1, 3, 0, 0, 1, 2, 2, 0, 1, 3, 2, 1, 0, 1, 3,
+        2, 1, 2, 0, -1, 1, 1, -1, -1, 2, 3, -1, 0, 3, 3, 1,
+        1, 0, 1, 2, 0, 1, 3, 1, 0, 0, 2, 2, 0, 1, 1, 0,
+        -1, 0, 0, 1, 2, 2, 1, 0, 1, 1, -1, -1, 2, 3, 2, -1,
+        1, 1, -1, -1, 0, 0, 1, 0, -1, -1, 2, 1, -2, -1, 0, 2,
+        2, 0, 1, 3, 2, 1, 2, 2, 0, -1, 2, 3, 2, -1, 1, 1,
+        1, 0, 1, 3, 2, -1, 1, 1, 1, 0, 1, 1, -1, 1, 1, 1,
+        2, 0, 1, 0, -1, -1, 2, 3, 0, 0, 1, 2, 0, 1, 1, -1,
+        1, 1, 1, 2, 2, 2, 0, -1, 0, 2, 2, -1, 0, 1, 0, -1,
+        0, 2, 0, -1, -1, 2, 3, 1, -1, -1, 0, 0, -1, 1, 3, 2,
+        -1, -1, 0, 0, -1, 1, 3, 2, 1, 0, -1, 0, 0, 1, 2, 2,
+        1, 0, 1, 1, 1, 0, 1, 0, 1, 0, 1, 0, -1, -1, 2, 1,
+        -1, -1, 0, 0, -1, -1, 2, 1, 1, 2, 2, 2, 0, 1, 1, -1,
+        1, 1, -1, -1, 0, 0, -1, -1, 0, 0, 1, 0, -1, 1, 1, 1,
+        0, -1, 0, 0, 1, 0, 1, 0, -1, 1, 3, 2, -1, -1, 0, 0,
+        -1, 1, 3, 2, 1, 2, 0, -1, -1, 2, 3, 1, 1, 0, 1, 3,
+        2, 1, 0, -1, 0, 0, 1, 0, -1, 1, 3, 0, -2, 2, 2, 1,
+        -1, -1, 2, 1, 1, 0, -1, 0, 2, 3, 2, 1, 2, 0, 1, 2,
+        2, 0, 1, 1, 0, 1, 3, 2, -1, 1, 3, 2, 1, 0, -1, 2,
+        3, 2, -1, 1, 3, 2, -1, -1, 2, 3, -1, 0, 1, 2, 2, 2,
+        2, 0, 1, 1, -1, 1, 3, 2, 1, 0, -1, 0, 0, -1, -1, 2,
+        3, 2, 1, 0, 1, 1, 1, 2, 0, 1, 2, 0, 0, 0, 0, -1,
+        2, 3, 2, -1, -1, 0, 0, 1, 0, -1, 1, 1, -1, -1, 0, 0,
+        1, 0, -1, 1, 1, -1, -1, 2, 1, 0, 2, 1, 1, 0, -1, -1,
+        2, 3, 2, -1, -1, 2, 1, 1, 0, 0, 2, 1, -1, -1, 0, 2,
+        2, 2, 2, 2, 2, 0, -1, 2, 1, -1, 1, 1, 1, 2, 0, 1,
+        3, 2, 1, 0, -1, 0, 2, 0, 1, 0, -1, 1, 1, -1, 1, 1,
+        -1, 1, 1, 1, 2, 2, 0, -1, 0, 0, -1, -1, 0, 2, 0, -1,
+        1, 1, -1, 1, 3, 0, -2, 1, 2, 1, 0, -1, 0, 0, 1, 0,
+        -1, -1, 2, 3, 1, 1, 0, -1, 0, 0, 2, 2, 2, -1, -1, 2,
+        1, 1, 0, 1, 1, 1, 0, -1, -1, 2, 3, 2, 1, 0, -1, 0,
+        0, 2, 0, 1, 0, -1, 1, 1, 1, 0, 1, 1, -1, -1, 2, 3,
+        2, -1, 1, 3, 0, -2, 1, 2, 1, -1, -1, 0, 2, 2, 0, 0,
+        1, 2, 2, 2, 2, 0, 1, 1, 1, 2, 2, 2, 2, 0, -1, 0,
+        0, 0, 1, 3, 0, -2, 2, 3, 2, -1, 1, 3, 2, 1, 2, 1,
+        -1, -1, 2, 1, 1, 2, 3, 0, 1, 3, 3, -1, -1, 2, 1, -2,
+        -1, 2, 3, 1, 1, 2, 0, 1, 2, 0, 1, 2, 1, -1, 1, 3,
+        2, -1, 1, 1, -1, -1, 0, 2, 0, -2, 1, 1, 1, 0, -1, 0,
+        0, -1, -1, 2, 1, -1, 1, 3, 2, -1, -1, 2, 1, 0, 0, 2,
+        1, 1, 2, 0, -1, 1, 3, 2, 1, 0, 0, 0, 2, 2, 2, -1,
+        -1, 2, 3, 0, 0, 1, 0, -1, -1, 0, 0, 1, 0, -1, 1, 3,
+        0, -2, 0, 3, 1, 0, 0, 2, 0, 1, 0, -1, 1, 1, 1, 0,
+        1, 1, -1, -1, 0, 2, 2, 0, 1, 3, 1, -2, 1, 1, -1, -1,
+        2, 3, 1, -1, -1, 2, 1, 0, 0, 2, 3, 0, -2, 0, 0, 1,
+        2, 2, 2, 0, 1, 3, 2, 1, 2, 0, 1, 0, 1, 0, -1, 1,
+        3, 0, 0, 3, 1, -2, 1, 1, 1, 2, 2, 0, 1, 1, -1, 1,
+        1, 1, 2, 0, -1, 1, 3, 0, -2, 2, 2, 1, -1, 1, 3, 0,
+        -2, 0, 0, 0, 1, 3, 2, -1, 1, 3, 2, 1, 2, 2, 2, 2,
+        0, -1, 2, 3, 2, -1, 1, 1, -1, -1, 2, 3, 2, -1, 1, 1,
+        1, 0, -1, 0, 2, 0, -1, -1, 2, 1, 0, 0, 2, 1, 1, 2,
+        2, 2, 2, 2, 0, 1, 1, -1, -1, 2, 1, -1, 1, 1, 1, 0,
+        -1, 0, 0, 1, 2, 2, 0, -1, 2, 3, 2, -1, -1, 0, 2, 0,
+        -1, -1, 2, 1, 0, 0, 0, -1, 0, 2, 2, 2, 1, 2, 0, 1,
+        3, 0, -2, -1, 2, 1, 0, 2, 3, 0, 0, 1, 2, 2, 0, 1,
+        1, -1, -1, 2, 3, 0, 0, 3, 3, -1, 0, 1, 0, 1, 1, 1,
+        2, 0, 1, 3, 2, -1, -1, 2, 1, 1, 0, 1, 1, -1, 1, 3,
+        0, 0, 3, 3, 1, -1, -1, 2, 3, 2, -1, 1, 1, 1, 0, -1,
+        2, 3, 0, 0, 1, 2, 0, 1, 0, 1, 2, 2, 0, 1, 3, 2,
+        -1, -1, 0, 0, 1, 0, 1, 2, 2, 2, 2, 0, -1, 2, 1, -1,
+        -1, 0, 0, -1, 1, 3, 2, 1, 2, 0, 1, 0, 1, 0, 1, 2,
+        0, 1, 2, 3, -1, -1, 2, 1, -1, 1, 3, 0, -2, 1, 4, 0,
+        0, 3, 1, -2, 1, 1, -1, -1, 0, 0, 1, 0, -1, 1, 1, 1,
+        0, 1, 1, 1, 2, 0, 1, 0, -1, 1, 3, 0, -2, 0, 2, 3,
+        -1, 0, 1, 2, 2, 0, -1, 2, 1, -1, 1, 3, 2, 1, 2, 3,
+        2, 0, 1, 1, -1, 1, 3, 2, 1, 0, -1, 2, 1, -1, -1, 2,
+        3, 1, 1, 0, 1, 3, 2, -1, 1, 3, 0, -2, 1, 2, -1, 1,
+        3, 2, 1, 2, 0, 1, 0, 1, 0, -1, 1, 3, 2, 1, 2, 0,
+        -1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, -1,
+        0, 2, 0, -2, -1, 0, 0, -1, 1, 3, 0, -2, 2, 4, 2, -1,
+        1, 1, 1, 2, 2, 0, -1, 0, 2, 1, 0, 0, 2, 2, 0, 1,
+        1, 0, -1, 2, 1, 1, 0, 1, 3, 0, 0, 1, 0, 1, 3, 0,
+        0, 1, 2, 2, 0, 1, 1, 1, 2, 0, 1, 3, 2, 1, 2, 0,
+        1, 3, 2, 1, 0, -1, 2, 1, 1, 2, 0, 1, 2, 0, -1, 1,
+        3, 2, 1, 0, 2, 1, -1, -1, 2, 1, -2, 1, 3, 0, -2, -1,
+        1, 0, 1, 2, 2, -1, 1, 1, -1, 1, 3, 2, 1, 2, 0, -1,
+        1, 1, -1, 1, 3, 2, 1, 2, 2, 2, 2, 2, 0, -1, 2, 3,
+        2, 1, 0, -1, 0, 0, 1, 2, 2, -1, 1, 3, 0, 0, 0, 2,
+        0, 1, 0, -1, 1, 3, 0, -2, 2, 3, 0, -2, 0, 3, 2, 1,
+        -1, -1, 0, 0, -1, -1, 2, 1, -1, -1, 0, 0, -1, 1, 3, 0,
+        0, 1, 2, 2, 0, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 0,
+        1, 3, 2, -1, -1, 2, 1, -1, -1, 2, 1, 0, 2, 3, 0, 0,
+        3, 1, 0, 2, 3, 0, -2, 0, 2, 2, 1, -1, -1, 0, 2, 2,
+        0, -1, 0, 0, -1, -1, 0, 0, -1, -1, 2, 1, 1, 2, 2, 0,
+        -1, 0, 0, -1, 1, 1, -1, -1, 0, 2, 0, -1, 1, 3, 2, -1,
+        1, 3, 0, -2, -1, 3, 1, 0, 2, 1, 1, 2, 0, 1, 2, 0,
+        1, 0, 0, 1, 1, -1, -1, 0, 0, -1, -1, 2, 1, 1, 0, -1,
+        1, 1, 1, 0, -1, 1, 1, -1, 1, 3, 2, -1, 1, 3, 2, 1,
+        0, 0, 0, 2, 2, 0, 0, 3, 3, -1, -1, 2, 1, -2, -1, 2,
+        3, -1, 0, 3, 1, 0, 2, 1, 1, 2, 0, 1, 2, 0, -1, -1,
+        0, 0, -1, -1, 0, 0, -1, -1, 2, 3, 2, 1, 0, -1, 0, 0,
+        0, -1, 2, 3, 0, 0, 1, 2, 0, 1, 2, 0, 0, 2, 3, 2,
+        1, 2, 0, -1, 2, 3, 0, -2, 2, 2, 1, -1, 1, 3, 2, -1
+      },
+      {
+        16, -6, 7, -4, 2, 15, 9, 20, -4, 9, 11, -2, 22, 7, 5, 2,
+        16, -4, 6, -2, 17, 11, 16, 1, 19, 12, 0, 23, -10, 29, 2, 9,
+        0, 0, 18, 7, 6, 0, 19, 9, 20, 13, 18, 16, 0, 7, 12, -2,
+        5, -2, 17, 10, 18, -1, 21, 10, 18, 16, -2, 25, 5, 8, -1, 2,
+        16, 10, 19, -3, 8, -3, 19, -7, 23, 8, 2, 6, -5, 6, -6, 5,
+        -5, 19, -9, 9, 11, 13, 18, 12, 20, -3, 10, 11, -1, 21, -9, 27,
+        5, 22, 13, 16, 19, 12, 22, 11, 22, -4, 26, -10, 12, 10, -3, 8,
+        -7, 7, -6, 20, -10, 10, -5, 18, -6, 5, 15, -8, 27, 1, 10, 14,
+        14, 17, 14, 18, -1, 8, 13, -3, 22, -9, 11, 10, -2, 23, 5, 23,
+        10, 20, 14, 17, 17, 15, 3, 20, -5, 7, -2, 17, -4, 5, 0, -2,
+        19, -10, 12, -9, 7, 11, 12, 17, 13, 3, 3, 1, 16, 11, 1, 5,
+        13, -3, 21, -8, 25, -10, 9, -3, 16, -3, 2, 18, 6, 24, -9, 13,
+        8, 1, 20, 8, 21, -4, 25, 7, 4, 4, 13, 15, 14, 3, 3, 17,
+        9, 20, -4, 25, -10, 11, 11, -4, 8, 9, 1, 18, -5, 23, -8, 8,
+        13, -6, 10, -9, 8, 9, 15, -2, 6, 14, 12, 2, 3, 16, -6, 8,
+        11, 14, 0, 4, 0, 0, 1, -2, 17, -8, 9, 10, -2, 6, 12, 14,
+        15, 0, 21, -7, 25, -10, 10, -3, 0, 18, 5, 8, 13, -1, 20, -6,
+        24, -8, 8, -2, 15, 14, 13, 21, 10, 7, 0, 4, 13, -3, 21, -7,
+        8, 13, 11, 19, 11, 5, 1, 18, -7, 25, 5, 22, 13, 17, 18, -2,
+        26, 4, 24, 10, 4, 4, -2, 19, -9, 26, -12, 28, 4, 5, 5, 11,
+        1, 0, 19, -10, 29, -15, 31, 2, 23, -3, 21, -4, 4, 3, 11, 17,
+        -6, 28, -15, 32, 0, 10, 0, -1, 20, -11, 29, 0, 26, 9, 20, 16,
+        15, 20, -4, 27, -12, 14, -8, 5, 14, -7, 10, -8, 23, -12, 11, -6,
+        3, -1, -2, 3, 11, 15, 13, 19, 13, 19, -2, 24, -9, 11, 11, 13,
+        2, 18, 13, -1, 24, -11, 13, -8, 22, 7, 3, 21, -10, 13, -9, 23,
+        -11, 10, 11, -4, 25, 3, 26, -8, 12, 11, 14, 18, -3, 10, 10, 0,
+        4, 15, -5, 23, -10, 27, -11, 10, 12, 10, 5, -2, 5, 11, 16, -3,
+        9, 11, 15, 15, 0, 6, 14, -4, 7, 12, -3, 6, -4, 19, -8, 8,
+        12, 12, 2, 2, 2, -2, 19, 7, 21, 12, 3, 20, -7, 10, 10, 14,
+        0, 20, -5, 23, -8, 8, -2, -1, 19, 5, 8, 13, 15, 15, 1, 20,
+        -6, 8, -3, 17, 11, 15, 2, 19, 13, 15, 2, 2, 2, 13, -2, 4,
+        0, 15, 13, 15, 18, -3, 9, -5, 21, 7, 20, 13, 1, 7, 12, -1,
+        20, -6, 8, -3, 1, 17, -9, 27, 2, 25, 10, 20, 16, -1, 9, -5,
+        6, -5, 3, -3, 1, 15, -6, 24, 5, 6, 18, 10, 5, 1, 2, 15,
+        -5, 6, -3, 17, -6, 6, -2, 16, 12, -2, 24, 5, 24, 9, 21, 13,
+        18, 17, -1, 24, 6, 7, 17, -5, 25, -11, 12, -6, 19, -6, 21, -6,
+        5, 17, 7, 8, 13, 1, 18, 12, 0, 23, 6, 23, 10, 5, 19, 10,
+        20, 13, 19, -1, 7, 14, -5, 8, -5, 20, 7, 4, 19, 9, 21, 11,
+        20, -2, 23, 8, 4, 20, 8, 6, 16, -3, 22, 8, 4, 20, -8, 12,
+        -8, 6, -4, 17, 10, 16, 16, -2, 25, -11, 13, -8, 21, 8, 18, 0,
+        19, -3, 5, 1, -3, 5, 10, 0, 1, 1, 14, -3, 4, -1, -1, 17,
+        7, 5, 16, 12, 17, 15, 16, 17, 0, 7, 13, 13, 16, -1, 23, -8,
+        26, -10, 26, 7, 19, 1, 18, -1, 18, -2, 19, -3, 3, 19, -11, 30,
+        -1, 12, 12, -2, 7, -4, 20, 7, 4, 18, -6, 26, -12, 28, -12, 11,
+        12, -6, 27, 0, 28, 6, 8, 1, 1, 17, 8, 4, 17, -5, 8, -3,
+        2, 15, -7, 9, -7, 21, 7, 20, -2, 6, 0, -1, 3, 12, 14, 13,
+        2, 3, 1, -1, 1, 14, 12, 16, 16, -1, 7, -3, 3, 14, 11, 17,
+        14, 2, 21, -7, 25, -10, 27, -10, 25, -8, 22, -5, 3, 4, 9, 3,
+        -3, 6, -7, 7, -8, 6, 10, -2, 21, 8, 20, 13, 1, 22, -9, 12,
+        9, -1, 5, -4, 4, -3, 2, -2, 1, -1, 15, -6, 7, 13, -4, 24,
+        -11, 13, -8, 5, 14, -7, 26, -13, 14, 7, 16, 15, -2, 9, -6, 6,
+        -5, 19, 8, 19, 14, 16, 2, 4, 1, 15, 12, 15, 17, -2, 25, 6,
+        23, 11, 3, 5, -3, 4, 13, -3, 5, 14, 11, 2, 3, 16, -6, 24,
+        -11, 11, 10, -3, 24, -12, 14, -9, 23, 6, 19, 15, 14, 4, 17, 14,
+        15, 3, 18, -3, 6, 15, 9, 21, -6, 27, 4, 24, 11, 2, 6, 12,
+        15, 14, 2, 19, 11, 18, 0, 5, 16, 10, 4, 17, -4, 22, 8, 19,
+        15, -1, 25, -11, 14, 7, 17, 15, 15, 2, 3, 1, -1, 2, -3, 18,
+        7, 20, 12, 2, 21, -8, 27, 4, 6, 18, 9, 6, 16, -3, 6, -2,
+        16, 11, 16, 1, 4, 1, -2, 19, -9, 11, 9, 0, 5, -3, 3, -3,
+        17, -7, 8, 12, -4, 7, -6, 21, -10, 26, 5, 5, 20, -9, 13, -9,
+        24, 5, 21, -3, 6, 16, -7, 27, -14, 15, 6, 1, 5, -4, 5, 11,
+        14, 14, 17, 15, 17, -1, 7, 14, -3, 7, 12, -3, 22, 7, 5, 19,
+        10, 20, 12, 3, 4, -1, 18, -7, 24, -10, 10, 12, -4, 9, 8, 2,
+        1, 17, -7, 25, 5, 22, -4, 7, -1, -1, 3, -5, 4, 10, -1, 3,
+        15, -6, 9, 10, 15, -1, 5, 15, -5, 24, -11, 12, -6, 3, 15, -8,
+        11, -8, 23, 5, 21, 12, 1, 7, -4, 5, 11, 14, 15, 0, 5, 15,
+        -4, 23, -10, 27, -11, 27, -10, 8, -1, 13, 16, 10, 23, -8, 14, -10,
+        9, 10, -2, 22, -10, 12, 9, -1, 22, -10, 28, -13, 13, -7, 19, 11,
+        15, 3, 16, 15, -3, 10, 9, 2, 17, -5, 7, -2, 17, 11, 0, 23,
+        -10, 29, 2, 24, 11, 2, 23, -10, 30, 1, 26, 10, 19, 0, 4, 2,
+        -3, 4, 11, 15, -3, 8, 11, 15, 15, 0, 22, 8, 20, 14, 17, 1,
+        4, 1, 15, -4, 21, 9, 18, 0, 19, 12, 16, 2, 2, 19, -9, 12,
+        -9, 23, 6, 20, 14, 16, 2, 19, 13, 0, 24, 5, 8, -1, 19, 9,
+        19, -2, 22, -7, 8, -2, 0, 18, -10, 12, 7, 2, 18, -7, 9, -5,
+        3, -2, -1, 17, -9, 10, 9, 15, 15, 0, 7, 13, -2, 21, -8, 26,
+        -10, 26, 7, 2, 7, 10, 18, 10, 22, -6, 11, -6, 21, 7, 19, -2,
+        5, 16, 9, 5, 16, -2, 5, -1, 0, 1, -3, 18, -9, 10, 9, 15,
+        0, 4, 0, 15, -4, 21, -7, 23, -8, 23, -6, 6, 17, -10, 30, -18,
+        35, -18, 17, -9, 4, 17, 6, 9, 12, 18, -4, 10, 10, 0, 4, -1,
+        17, 10, 18, -2, 6, 15, -5, 25, -12, 29, 3, 7, 3, -2, 5, 10,
+        16, 12, 19, -3, 25, 6, 22, 12, 18, 1, 20, -5, 22, -6, 7, 15,
+        8, 7, 14, 16, -3, 9, 10, 0, 20, 9, 19, -2, 22, -7, 8, 14,
+        -6, 26, 2, 10, -2, 19, 9, 2, 5, 13, -2, 20, -7, 24, 8, 3,
+        6, -5, 6, -6, 21, 5, 22, -5, 24, 8, 19, 16, 14, 20, 12, 22,
+        -5, 11, 10, 15, 15, 0, 23, -9, 11, -6, 20, 9, 17, 1, 19, -3,
+        21, -5, 5, 0, 13, -1, 1, 3, 12, 0, 18, -4, 21, -6, 22, 10,
+        16, 19, 11, 23, -7, 29, -14, 15, -9, 21, -7, 6, 15, -8, 29, -16,
+        17, -12, 8, 11, 11, 19, -5, 11, 9, 17, 13, 1, 5, -2, 18, -7,
+        8, -4, 18, -6, 22, -7, 7, -1, -2, 20, 4, 25, 7, 23, -5, 26,
+        7, 5, 4, -3, 21, -11, 28, 2, 24, -5, 24, -7, 23, 10, 0, 25,
+        -14, 17, -13, 26, 3, 6, 18, 8, 23, -7, 28, -12, 13, 9, -2, 23,
+        4, 9, 14, 14, 16, 0, 6, 14, -4, 23, -10, 27, -11, 11, 12, 11,
+        5, 15, 16, 13, 20, -4, 11, 10, 16, 14, 1, 22, -8, 26, -11, 11,
+        11, 12, 4, 16, -1, 19, -4, 21, -6, 22, 11, 15, 4, 16, 16, 12,
+        5, 0, 4, -4, 21, -10, 27, 3, 23, 12, 17, 2, 3, 19, -9, 12,
+        -9, 7, -5, 2, 15, 9, 19, 12, 20, -3, 24, -9, 26, -10, 26, 7,
+        2, 24, 3, 27, -10, 15, 7, 1, 4, 13, 14, -1, 7, 12, 14, 0,
+        21, 8, 4, 3, 15, -3, 5, -2, 0, 1, 14, -3, 5, 15, -6, 25,
+        -12, 29, -13, 28, 5, 4, 22, -12, 16, 3, 21, -6, 9, -4, 18, 10,
+        0, 22, -10, 29, 2, 9, 0, 16, -3, 4, 16, 9, 21, 10, 22, 12,
+        20, -2, 24, -8, 9, 12, 11, 20, 11, 6, 1, 19, -8, 10, -6, 20,
+        8, 18, 15, -1, 25, 5, 24, -6, 26, 6, 5, 4, 13, -1, 2, 17,
+        8, 21, 10, 21, -3, 25, -9, 26, -10, 9, 13, 9, 22, 8, 24, -7,
+        13, 9, 0, 21, 8, 21, 12, 19, 15, 17, 17, 15, 18, 14, 3, 4,
+        0, 17, -6, 7, -3, 1, 0, -2, 18, 7, 5, 1, 17, 10, 18, -2,
+        22, -7, 25, 7, 19, 0, 3, 3, 12, 0, 17, -4, 20, 11, 0, 24,
+        -12, 15, -10, 24, -11, 26, -10, 25, 9, 0, 25, -14, 18, 2, 22, -6,
+        25, -9, 25, 7, 2, 23, -12, 32, -1, 12, 13, 13, 18, 13, 20, -3,
+        25, 6, 22, 12, 2, 7, 12, -1, 19, 10, 2, 21, 7, 6, 0, 18,
+        10, 19, 14, 1, 22, -9, 11, -6, 20, -8, 7, 14, 10, 5, -1, 4,
+        -4, 4, 12, 13, 15, 0, 21, -7, 9, 12, 12, 19, 12, 20, -4, 10,
+        11, -2, 6, 13, 13, 16, 15, 16, 16, 16, 17, 16, 1, 6, 15, 12,
+        18, 14, 2, 5, -1, 2, 15, 10, 18, -2, 23, 8, 4, 20, -8, 27,
+        -13, 30, -13, 12, 11, 11, 5, -2, 22, 4, 9, -2, 4, 13, 12, 17,
+        -1, 7, -2, 2, -1, -1, 17, -8, 9, -6, 4, -3, 0, 16, 8, 4,
+        17, -4, 23, 7, 4, 20, -8, 28, 2, 25, 10, 19, 16, 15, 20, -4,
+        27, 4, 24, -6, 9, 13, -5, 9, -7, 22, -11, 27, 4, 22, -2, 21,
+        12, -1, 25, 3, 27, -9, 13, -7, 21, 8, 17, 0, 3, 2, 13, 15,
+        -3, 9, -6, 6, -5, 3, -3, 0, 0, -1, 17, -8, 25, 5, 22, -4,
+        7, -1, -1, 3, 11, -1, 2, 1, -2, 18, -9, 11, 9, 15, 15, -1,
+        23, 7, 6, 1, 0, 17, -7, 25, 5, 6, 18, 9, 5, 17, 13, 1,
+        22, -8, 11, 10, -2, 6, -4, 4, -4, 2, -2, 17, -6, 23, -9, 9,
+        13, -5, 26, -14, 16, 6, 2, 4, 13, 14, 14, 1, 20, 11, 18, 16,
+        -1, 8, -5, 21, 6, 5, 18, 10, 20, -4, 9, 12, -3, 7, -4, 20,
+        7, 4, 19, 9, 5, 18, 11, 2, 20, 9, 4, 19, 10, 3, 3, 0,
+        1, -1, 0, -1, 0, 0, -1, 0, 15, 10, 18, 14, 1, 6, -3, 3,
+        -2, 1, 15, 10, 2, 19, -6, 25, -10, 26, 6, 4, 22, 5, 25, 7,
+        24, 10, 5, 3, 15, 12, 0, 6, 13, -3, 21, -8, 25, 6, 20, -1
+      },
+      {
+        8, 0, -4, 3, 0, 4, 10, 6, -2, 1, 10, -1, 4, 14, -3, -4,
+        15, -1, -8, 8, 8, 2, 10, 2, 4, 12, -1, 4, 7, 3, 8, 1,
+        -3, 3, 8, 6, -1, 1, 10, 7, 5, 10, 9, 6, 1, 0, 9, 1,
+        -4, 4, 8, 5, 7, 2, 6, 11, 6, 7, 3, 6, 10, -2, -2, 5,
+        6, 6, 8, 0, -2, 3, 7, -1, 6, 12, -4, -2, 6, -3, -3, 4,
+        -1, 5, 3, -4, 9, 11, 2, 9, 11, -3, -1, 13, -2, 2, 8, 4,
+        7, 10, 6, 7, 10, 7, 7, 9, 8, 0, 8, 4, -5, 10, 3, -8,
+        4, 3, -6, 9, 3, -8, 4, 11, -5, -2, 14, -2, 1, 16, -3, 2,
+        18, 4, 3, 15, -1, -5, 15, 0, -1, 8, -3, 4, 6, 3, 9, 9,
+        6, 9, 9, 7, 8, 9, -1, 7, 4, -5, 2, 11, -3, -4, 6, -2,
+        4, 4, -4, 0, 3, 5, 8, 7, 7, 1, -1, 2, 8, 7, -2, 0,
+        11, -1, 3, 6, 4, 0, 0, 1, 7, 0, -3, 11, 9, 2, 2, 1,
+        7, 1, 5, 12, 6, -2, 10, 11, -5, 0, 14, 5, 4, 5, -2, 7,
+        11, 4, 0, 10, 1, -5, 12, 2, -8, 13, 3, -2, 7, 7, -3, 0,
+        12, -2, -5, 6, -1, 3, 12, -2, -4, 14, 7, -7, 4, 12, -5, -3,
+        15, 6, -6, 4, 3, -6, 1, 2, 4, 1, -2, 9, 1, -5, 12, 10,
+        1, 3, 10, -1, 5, 5, -4, 0, 3, 5, 8, 0, 6, 4, 4, 2,
+        7, 1, -3, 2, 8, 6, 6, 10, 8, -1, 0, 3, 6, 0, 6, 3,
+        -4, 9, 11, 2, 9, 3, -4, 11, 3, 1, 13, 8, 3, 12, 9, -3,
+        9, 13, 2, 8, 4, -4, 2, 10, -3, 5, 6, 3, 9, 1, -4, 11,
+        1, -7, 13, 2, -1, 7, 7, 5, 9, 1, 6, 4, -4, 1, 10, 6,
+        -3, 10, 3, 1, 12, 0, -5, 6, 8, -4, 7, 13, 3, 7, 13, 5,
+        7, 11, -1, 6, 6, -5, 1, 4, 4, 0, -1, 1, 7, 0, -3, 3,
+        0, -3, 2, 0, 6, 10, 6, 7, 10, 7, -1, 9, 3, -5, 11, 11,
+        -7, 9, 15, -8, 7, 10, -9, 0, 15, 3, -4, 13, 2, -8, 6, 10,
+        -6, -1, 14, -3, 2, 16, 4, -4, 5, 9, 4, 8, 2, -3, 10, 2,
+        -6, 12, 2, -1, 6, 7, -2, 0, 11, 7, -4, 2, 3, 4, 9, 0,
+        -2, 12, 8, 3, 3, 1, 7, 1, -4, 10, 2, -7, 5, 10, -4, -2,
+        13, 6, -5, 4, 3, -5, 9, 11, 2, 9, 4, 4, 3, -2, 8, 10,
+        -4, 7, 6, 1, 2, 1, -1, 0, 8, 8, -3, 8, 12, 3, 0, 11,
+        1, -5, 5, 9, 4, 8, 2, 5, 11, 6, -2, 2, 2, 6, 1, -2,
+        2, 8, 7, 6, 9, 0, -2, 3, 7, 6, 7, 9, 0, -1, 11, 0,
+        2, 6, -3, -1, 3, 6, -1, 7, 11, 4, 7, 11, 6, -1, 1, 2,
+        -2, 0, 1, -2, -1, 9, 0, 4, 13, -2, 4, 15, -4, -4, 8, 5,
+        -4, 1, 3, 5, 1, -2, 1, 8, 7, -2, 8, 12, 3, 8, 12, 5,
+        7, 11, -1, 6, 14, -4, 5, 8, 2, 1, 2, -1, 7, 1, 4, 4,
+        -3, 8, 11, -5, 7, 7, 1, 10, 2, 3, 13, 7, 5, 4, 7, 9,
+        7, 8, 9, -1, -1, 11, 0, -6, 5, 8, 4, 0, 9, 10, 4, 9,
+        10, -2, 7, 13, -5, 6, 16, -6, 5, 10, 1, 8, 4, 3, 3, -1,
+        0, 1, -1, 7, 10, 5, 8, 2, 5, 3, -3, 1, 10, 7, 5, 2,
+        7, 2, -3, 2, 1, -3, 9, 2, -6, 4, 9, -4, -2, 5, -3, 5,
+        12, -4, 6, 15, 3, 6, 14, 6, -2, 3, 10, 6, 6, 2, 7, 2,
+        5, 3, 5, 10, 7, -1, 9, 3, 3, 4, 7, 0, -2, 10, 0, 2,
+        14, -2, 3, 8, -5, -1, 13, 6, -5, 11, 4, 0, 5, 7, -2, -1,
+        11, -1, 3, 14, 5, 4, 5, -1, -1, 10, 7, -4, 9, 4, -7, 3,
+        3, 3, 2, -1, 0, 8, 8, 5, 1, 0, 1, 0, -1, 8, 8, 5,
+        1, 1, 1, -1, -1, 8, 8, 5, 9, 1, -3, 3, 0, 5, 10, 6,
+        7, 2, 6, 2, 5, 3, 6, 2, 6, 2, 5, 2, -2, 1, 9, -1,
+        -3, 4, -1, -3, 2, 0, 5, 2, 5, 10, 7, 6, 2, 7, 2, -3,
+        10, 2, -6, 4, 2, -5, 2, 2, -4, 0, 9, -2, -4, 13, 0, 1,
+        7, -3, -3, 4, 6, -2, 7, 4, -5, 10, 11, 2, 1, 3, -1, -1,
+        1, 7, 8, 6, 8, 9, -1, -1, 3, 6, 7, 7, 8, 0, 7, 12,
+        5, 7, 3, -3, 2, 1, 5, 1, -3, 10, 9, -5, 1, 13, -3, 3,
+        8, -5, 7, 6, 1, 2, 1, -1, 8, 9, 4, 9, 10, -2, 7, 13,
+        3, -1, 11, 1, -6, 13, 10, 0, 3, 10, 7, 6, 10, 0, -2, 12,
+        8, 3, 3, 9, 8, 6, 1, 0, 9, 9, -4, 9, 5, 1, 11, 9,
+        4, 2, 9, 1, -3, 11, 9, 2, 11, 2, -5, 4, 1, -4, 1, 9,
+        6, 6, 10, 0, 6, 5, 4, 10, 0, 5, 13, -3, 5, 7, -5, 0,
+        12, 5, 4, 4, -1, 0, 2, 7, 0, -3, 11, 1, -6, 5, 1, -5,
+        10, 2, -7, 12, 3, -9, 5, 11, -6, 7, 15, -7, 6, 10, -8, 0,
+        14, 4, 4, 6, -2, 7, 4, 3, 3, -1, 8, 2, -5, 3, 1, 4,
+        10, 7, 6, 10, 8, -1, 0, 11, -1, -5, 13, 0, 0, 15, -1, 2,
+        17, 5, 3, 6, -2, -1, 11, 0, 3, 6, -3, 7, 4, -6, 10, 4,
+        -8, 12, 4, -1, 14, 9, -6, 3, 5, -5, 0, 3, -3, 7, 3, -6,
+        10, 3, -8, 12, 12, -8, 2, 15, -5, 3, 10, -7, -1, 6, 4, -2,
+        1, 1, 6, 9, 6, 8, 1, -2, 2, 0, 6, 10, 5, -1, 1, 9,
+        -1, 4, 5, 4, 1, 8, 2, -4, 3, 9, 6, 6, 10, -1, -2, 4,
+        -1, 5, 3, 4, 2, -2, 8, 2, 3, 4, 6, 0, -1, 2, 8, 7,
+        6, 1, 7, 11, -3, -1, 13, -2, 2, 8, -4, -2, 12, 6, -5, 11,
+        4, 0, 13, 9, 3, 3, 9, 0, 5, 12, 5, 6, 12, -1, -3, 5,
+        -1, -3, 11, 8, -5, 2, 12, 4, 5, 4, 6, 9, 7, 7, 9, 0,
+        -1, 3, 7, -1, 6, 12, 4, -1, 11, 10, 3, 2, 1, 7, 1, -3,
+        3, 8, 6, 7, 9, 8, -1, 8, 12, -4, 7, 15, -6, -2, 16, 5,
+        2, 6, 7, -1, -1, 3, -2, 6, 2, -4, 10, 3, 1, 5, -1, -2,
+        2, -1, -2, 9, 0, -5, 12, 10, 1, 3, 2, 6, 1, 5, 3, 5,
+        2, 6, 10, -2, -2, 12, 7, 3, 12, 1, -4, 5, 8, 5, 8, 2,
+        -2, 10, 9, -5, 9, 6, -8, 2, 4, -6, 0, 11, -3, -4, 14, 7,
+        -7, 4, 4, 2, 2, 8, 1, 5, 4, 5, 1, -1, 9, 1, 3, 5,
+        5, 0, -1, 2, -1, 6, 10, -3, 7, 14, -5, -2, 15, -3, -7, 8,
+        7, 3, 10, 1, -4, 12, 2, 1, 6, 6, 7, 1, -1, 2, 0, 6,
+        10, 5, 8, 2, 6, 11, 6, 7, 11, -1, 6, 5, 3, 2, 0, 8,
+        9, -3, 8, 13, -5, -2, 15, -3, 1, 17, 4, -5, 14, 3, -9, 14,
+        3, -3, 15, 1, -8, 15, 10, -9, 4, 14, -6, 5, 9, 1, 8, 4,
+        -5, 2, 2, -4, 9, 11, 3, 1, 10, 8, 4, 10, 9, 6, 9, 9,
+        -1, -1, 12, 7, 4, 3, 8, 1, -3, 3, 8, 6, 7, 1, 7, 3,
+        4, 3, -2, 1, 9, -1, -4, 4, 7, -3, 7, 5, 2, 3, 8, 8,
+        6, 8, 9, 7, 0, 8, 3, -5, 2, 10, -3, -3, 13, -1, 1, 8,
+        -3, -2, 4, 6, 6, 8, 0, -1, 11, 8, 3, 3, 1, 0, 8, 1,
+        -4, 3, 8, -3, 6, 5, -6, 1, 3, 4, 8, 8, 6, 9, 1, 6,
+        12, -3, -2, 6, 6, -2, 8, 11, 3, 0, 10, 1, 3, 13, -2, 4,
+        7, -5, -1, 12, 6, -4, 11, 12, 1, 2, 11, -1, -4, 13, 0, 0,
+        15, -2, 2, 16, 5, -5, 5, 10, -4, 6, 6, 2, 2, 1, 7, 9,
+        -3, 7, 13, 3, 7, 4, -3, 9, 11, 3, 1, 10, 0, 3, 5, -3,
+        7, 12, -5, 7, 7, 1, 2, 9, 0, 4, 13, 5, -2, 11, 10, 2,
+        2, 2, -1, 0, 9, 0, 4, 13, 6, 5, 12, -1, -3, 13, 0, -7,
+        6, 1, -6, 3, 9, 4, 7, 11, 7, -1, 9, 3, 3, 4, 6, 8,
+        -1, 7, 12, 4, -1, 3, 9, -1, -3, 12, 8, -6, 2, 12, 4, -3,
+        11, 10, -6, 1, 13, -4, -5, 7, -2, -5, 12, 0, -8, 14, 2, -2,
+        8, 7, -3, 8, 12, -5, 7, 7, -7, 9, 14, -8, -1, 8, 2, 6,
+        3, 5, 2, 6, 10, -2, -2, 12, -1, -6, 14, 9, 0, 12, 11, 3,
+        10, 3, 4, 4, -2, 8, 11, 4, 8, 3, -3, 10, 2, -7, 4, 10,
+        4, 7, 11, -2, 6, 14, 4, -2, 12, 9, -5, 2, 13, -4, -4, 15,
+        7, 1, 13, 9, -5, 10, 5, 0, 4, 0, 6, 10, 6, 7, 10, -1,
+        -2, 12, 0, 2, 15, 6, 4, 13, 8, 5, 11, 9, 5, 10, 1, -3,
+        3, 8, -2, -2, 4, -2, -2, 2, 7, 7, -1, 0, 11, 7, 4, 3,
+        8, 1, 5, 12, 6, -2, 2, 2, 5, 1, 6, 3, 5, 10, -1, 5,
+        6, -5, 0, 11, -3, 4, 7, 3, 8, 2, 5, 4, -3, 8, 11, -5,
+        8, 7, 1, 11, 2, 3, 5, 6, 8, 0, 6, 12, 5, 7, 11, -1,
+        6, 14, 4, 6, 5, -3, 9, 3, 2, 12, 0, 3, 14, -3, -4, 15,
+        7, 1, 13, 1, 2, 6, -3, -2, 11, -1, -6, 14, 9, -8, 3, 5,
+        -6, 0, 12, 5, 4, 4, 6, 1, -2, 10, 9, 3, 10, 10, -3, 0,
+        12, -2, -5, 14, 8, 1, 13, 10, 3, 11, 10, 5, 1, 1, 8, 8,
+        5, 9, 1, -2, 3, 0, 5, 10, 6, -1, 9, 11, -5, 8, 6, 1,
+        3, 9, -1, -3, 12, 8, -6, 2, 12, 4, -3, 3, 1, 5, 10, 6,
+        -1, 1, 2, -2, -1, 1, 6, 0, -3, 3, 0, -3, 1, 8, 7, -2,
+        8, 4, 2, 12, 0, 4, 6, 4, 8, 9, 7, 8, 9, 7, 8, 1,
+        7, 11, 5, -1, 2, 9, -1, -3, 4, 7, -2, 7, 12, 4, -1, 11,
+        9, -5, 9, 14, 1, 0, 4, -1, 6, 11, 5, -1, 2, 1, 6, 9,
+        -2, -1, 4, -2, -2, 2, -1, -2, 1, 0, 6, 2, 4, 11, 6, -2,
+        2, 2, -3, 0, 9, -1, -4, 5, 0, 4, 3, -3, 8, 11, 3, 1,
+        10, 9, -4, 1, 4, 5, 0, 7, 10, -3, 7, 14, -5, 6, 16, -6,
+        5, 10, -8, 7, 8, -8, 1, 5, -6, -1, 4, 4, -1, 7, 2, -4,
+        10, 2, 1, 5, -1, 6, 3, -4, 9, 11, 2, 1, 11, 8, 5, 10,
+        1, -3, 4, 8, 6, -1, 9, 11, 4, 0, 2, 8, 0, -3, 4, 8,
+        6, -1, 8, 11, -4, 7, 14, -6, 6, 17, -7, 5, 18, -7, -4, 10,
+        -4, -5, 7, -2, -5, 4, 0, -4, 10, 9, 2, 10, 2, -4, 3, 1,
+        -4, 1, 9, 6, -2, 9, 3, 2, 4, 7, 8, -1, 7, 12, 4, 7,
+        11, 6, -1, 2, 10, 7, -3, 1, 11, -2, 4, 6, 3, 8, 9, -2
+      },
+      {
+        8, 7, -1, -6, -4, 9, 19, 16, -1, -13, -1, 10, 17, 13, -2, -12,
+        0, 10, 7, -3, 0, 11, 17, 6, 0, 4, 5, 9, 4, 4, 9, 5,
+        -3, -6, 6, 18, 10, -6, -4, 10, 20, 17, 6, 1, -3, -2, 8, 9,
+        0, -7, 2, 15, 19, 4, -4, 3, 15, 18, 3, -3, 4, 6, 2, -4,
+        3, 14, 17, 3, -10, -10, 8, 15, 13, 7, -4, -8, -3, 3, 5, 0,
+        -4, 4, 7, 2, 4, 10, 14, 12, 7, -2, -7, 4, 9, 12, 2, 1,
+        7, 14, 14, 9, 5, 6, 10, 12, 11, 0, 0, 1, 1, 8, 6, -2,
+        -6, -4, 1, 12, 8, -3, -9, 3, 10, 5, 4, 0, 5, 13, 7, 4,
+        6, 11, 13, 10, -1, -8, 2, 9, 13, 4, -7, -1, 6, 13, 14, 10,
+        6, 6, 10, 12, 11, 8, -1, 1, 3, 1, -1, 6, 6, 0, -5, -4,
+        8, 10, 1, -7, -7, 8, 20, 18, 7, -7, -11, -2, 14, 21, 6, -12,
+        -6, 5, 17, 9, 2, -5, -5, 0, 11, 9, -2, -1, 9, 17, 7, -8,
+        -3, 4, 14, 16, 10, -3, -2, 10, 10, 0, 0, 8, 15, 6, -7, -2,
+        12, 20, 7, -2, -6, -3, 11, 11, 0, -1, 0, 9, 7, 7, 0, -5,
+        4, 7, 3, -4, -5, 7, 18, 9, -7, -4, 10, 12, 1, -1, -1, 0,
+        8, 15, 6, -7, -10, -2, 6, 6, 7, 2, -5, 3, 6, 3, 5, 10,
+        13, 3, 1, -1, 7, 7, 0, -6, -5, 8, 18, 8, 0, -6, 4, 8,
+        11, 3, -6, -7, 7, 20, 18, 8, 1, -4, -3, 1, 11, 8, 6, -1,
+        -5, 5, 16, 18, 10, -5, -11, 3, 12, 15, 10, 6, 5, 9, 12, 3,
+        2, 7, 14, 14, 1, -9, -8, 9, 14, 11, -1, -2, 8, 9, 0, 1,
+        1, 0, 7, 6, 7, 2, 4, 10, 14, 4, 0, -2, -1, 0, 9, 15,
+        6, 1, -3, 5, 15, 8, -5, -11, 4, 12, 14, 10, 6, 6, 9, 12,
+        11, 9, -1, 1, 2, 1, -1, -2, 7, 7, 0, -6, 3, 7, 3, -4,
+        -6, -2, 2, 3, 8, 12, 12, 9, 7, 7, 2, 4, 3, -1, 5, 13,
+        7, 3, 6, 3, 6, 3, -2, -4, 6, 17, 9, 2, -5, -5, 0, 11,
+        9, -2, -1, 1, 10, 15, 13, -1, -10, 1, 17, 22, 4, -13, -5, 7,
+        10, 10, 0, 1, 1, 8, 6, -2, 2, 11, 8, -2, -8, 3, 17, 12,
+        -5, -5, 9, 19, 9, -8, -5, 3, 6, 10, 4, -5, -7, 6, 11, 3,
+        2, 7, 5, -1, -5, -3, 9, 18, 15, 7, -6, -1, 4, 4, 8, 11,
+        3, 2, 0, 6, 6, 0, -5, -4, 9, 18, 8, 0, 3, 11, 8, 5,
+        -1, -5, -3, 9, 18, 15, -1, -4, 6, 17, 10, -6, -12, 3, 12, 7,
+        -5, -1, 11, 18, 15, -2, -13, -8, 12, 23, 18, 4, -9, -10, 8, 14,
+        13, -1, -10, -8, 2, 15, 10, 4, 4, 9, 13, 12, 9, -2, -8, -4,
+        2, 5, 1, -3, -4, 7, 9, 9, 9, 1, 2, 10, 7, -2, -7, 4,
+        9, 4, -4, 1, 5, 3, -2, 4, 13, 8, 4, 6, 10, 13, 11, 8,
+        7, 9, 3, 4, 10, 6, 5, 0, 4, 4, 0, -4, 5, 7, 9, 2,
+        -6, 2, 14, 10, 5, -4, 2, 13, 10, 6, 6, 9, 12, 3, 2, 8,
+        14, 14, 9, -2, -8, 3, 10, 5, -4, 1, 12, 10, 6, 6, 9, 11,
+        11, 1, 0, 9, 7, 7, 9, 2, 3, 2, 7, 13, 5, 2, -2, -3,
+        -1, 1, 1, 8, 13, 13, 9, -2, 0, 3, 2, 0, 6, 13, 15, 2,
+        -2, -2, 0, 1, 1, -1, 6, 6, 0, -5, 4, 8, 3, -4, -6, 7,
+        18, 9, 1, 3, 10, 15, 13, 8, -3, -8, 4, 18, 19, 2, -5, -5,
+        9, 11, 10, 7, 7, 1, 3, 3, 8, 4, 6, 2, -3, 4, 6, 9,
+        11, 2, 1, 0, -1, -1, 8, 15, 6, 1, -3, 5, 7, 10, 3, -5,
+        2, 6, 11, 13, 10, 7, -1, -6, -4, 10, 19, 8, 0, -6, -4, 1,
+        4, 9, 5, -4, -7, 5, 18, 18, 1, -13, -11, 2, 9, 13, 11, 7,
+        -2, -7, -4, 2, 4, 9, 12, 11, 8, -1, -7, -4, 2, 12, 17, 12,
+        5, -4, 1, 5, 11, 5, 4, -1, 5, 5, 8, 3, -4, -5, 7, 10,
+        2, -6, -7, -1, 4, 3, 7, 3, 5, 10, 13, 11, 0, -1, 1, 1,
+        8, 6, -2, -6, -4, 2, 4, 1, -3, -3, 7, 8, 1, 2, 1, 8,
+        5, -2, -6, -3, 9, 10, 8, -1, -7, 3, 17, 19, 3, -13, -12, 1,
+        9, 14, 12, 7, 5, 8, 3, -3, -5, 6, 17, 17, 9, -5, -3, 11,
+        20, 15, -2, -13, -8, 4, 17, 10, -5, -5, 9, 12, 2, 0, -1, 8,
+        7, 0, 2, 3, 8, 5, -3, -6, 5, 17, 18, 10, 2, -4, 3, 15,
+        18, 3, -3, -4, 0, 11, 17, 14, -2, -4, 7, 18, 17, 0, -12, -2,
+        17, 23, 6, -6, 0, 14, 12, -2, -2, 8, 9, 9, 0, 2, 10, 15,
+        13, -1, -2, 0, 2, 9, 14, 13, 7, -3, -8, -4, 3, 5, 1, 4,
+        11, 14, 11, -1, -1, 1, 10, 16, 5, 0, 5, 5, 8, 3, -4, -6,
+        6, 18, 17, 1, -13, -10, 2, 17, 12, -4, -5, 0, 4, 3, -2, -4,
+        6, 8, 1, 3, 2, -1, -2, 7, 7, 8, 9, 2, 2, 1, -1, -2,
+        7, 15, 15, 1, -11, -1, 8, 15, 6, -7, -2, 5, 5, 0, -4, 4,
+        15, 17, 10, 4, 4, 1, -2, 6, 6, 0, 3, 3, 8, 12, 5, 2,
+        7, 13, 14, 2, -9, -8, 9, 13, 12, -1, -10, 1, 9, 6, 5, 0,
+        -4, 5, 7, 10, 10, 9, 0, -7, -5, 1, 5, 2, -2, 4, 5, 1,
+        4, 3, -1, 5, 13, 7, -4, -1, 3, 11, 7, -4, -8, -4, 11, 12,
+        0, -9, 0, 16, 21, 13, -6, -14, -6, 6, 17, 17, 9, -5, -10, 4,
+        12, 14, 2, -1, -2, 8, 8, 0, -6, 3, 16, 19, 11, -5, -12, -5,
+        5, 16, 8, 2, -4, -5, 7, 10, 10, 0, 1, 1, 0, -1, 7, 14,
+        14, 1, -2, 6, 8, 1, 3, 2, 7, 5, -2, -5, 5, 17, 10, 3,
+        -5, 3, 14, 18, 12, -4, -4, 1, 12, 17, 13, 6, 4, 0, -3, -2,
+        0, 1, 8, 14, 5, -7, -1, 13, 20, 6, -3, 2, 13, 17, 12, -3,
+        -11, -7, 12, 14, 10, 5, 5, 1, 5, 12, 14, 3, -9, -1, 7, 6,
+        -1, 2, 11, 16, 12, 6, -3, 1, 12, 10, 6, 6, 1, -4, 4, 15,
+        17, 2, -3, -3, 0, 2, 1, 7, 4, -2, 3, 4, 9, 4, -4, -6,
+        -2, 3, 3, 8, 4, -3, 2, 13, 17, 4, -10, -3, 6, 15, 7, 2,
+        -3, 4, 15, 9, -4, -2, 10, 19, 15, -2, -13, -9, 11, 24, 18, -4,
+        -17, -2, 20, 18, 6, -9, -11, -2, 7, 6, -1, 2, 3, 1, 6, 13,
+        6, -5, -9, 5, 11, 13, 1, -1, -1, 8, 7, 0, 2, 2, 8, 5,
+        6, 1, -4, -4, 0, 10, 16, 5, 0, 4, 5, 1, 5, 4, -1, -4,
+        5, 16, 17, 2, -11, -2, 8, 16, 6, 1, 4, 4, 0, -3, -3, 8,
+        17, 15, 8, -5, -1, 12, 19, 15, 6, -6, 0, 5, 12, 6, -5, -1,
+        12, 11, 7, 6, 0, -4, 5, 7, 10, 11, 9, 0, 1, 2, 1, 7,
+        5, 7, 10, 3, -5, 2, 14, 10, -3, -2, 1, 11, 8, 6, 7, 2,
+        -4, -4, -1, 2, 10, 14, 12, -1, -2, 8, 17, 15, 8, 3, 6, 11,
+        5, -4, 1, 12, 18, 5, -2, -4, -2, 2, 11, 15, 12, -1, -2, 0,
+        10, 8, -2, -8, 3, 9, 4, -4, 1, 4, 10, 5, 4, 0, 5, 13,
+        15, 11, 6, 5, 1, 5, 4, -1, -4, 5, 8, 2, 3, 2, 7, 5,
+        -2, -5, -3, 9, 18, 15, -1, -13, -1, 18, 23, 5, -14, -14, 8, 18,
+        7, -8, -5, 4, 14, 9, -4, -10, -5, 12, 21, 16, 4, 0, -2, 7,
+        15, 8, -6, -11, 4, 12, 14, 10, 6, -2, 2, 4, 10, 13, 3, 1,
+        -1, -1, 0, 8, 15, 6, 1, 5, 12, 7, 4, -1, -4, 6, 8, 10,
+        10, 1, 1, 9, 15, 5, -7, -2, 5, 13, 7, 3, -2, -4, 7, 17,
+        9, 2, 3, 10, 15, 4, -8, -1, 14, 20, 6, -3, -6, 6, 10, 3,
+        2, 8, 5, 6, 1, 4, 3, 7, 4, 5, 10, 12, 3, 1, 7, 14,
+        6, -6, -9, -3, 13, 12, 7, 5, 7, 11, 12, 2, -7, 1, 7, 5,
+        -2, -6, -3, 2, 11, 16, 12, 6, 4, 0, 5, 5, 8, 3, 4, 10,
+        5, 5, 8, 12, 4, -6, 0, 6, 4, 6, 10, 4, -5, 1, 13, 10,
+        6, 5, 1, -3, 5, 7, 1, -5, -5, -1, 11, 9, -2, -1, 1, 10,
+        7, 6, 0, 3, 11, 7, 5, -1, -4, 5, 16, 9, -5, -11, 3, 20,
+        14, 3, -8, 0, 15, 12, -2, -3, 0, 2, 10, 14, 12, 7, 5, 8,
+        11, 4, 3, 0, -2, 6, 15, 15, 9, -4, -10, 4, 11, 6, -4, 0,
+        12, 18, 14, -3, -4, 8, 18, 9, 1, 3, 2, 0, 6, 5, -1, 3,
+        12, 15, 12, 6, -3, 1, 4, 11, 5, -4, 1, 12, 18, 13, 5, -5,
+        -7, 6, 11, 12, 9, 7, 7, 10, 11, 10, 9, 8, 9, 10, 2, -6,
+        -6, 8, 11, 2, -7, -8, -1, 5, 12, 14, 2, -9, 0, 15, 21, 5,
+        -4, -6, 7, 19, 18, 0, -13, -11, 10, 17, 13, -3, -4, 8, 10, 10,
+        0, -7, -6, 9, 12, 10, -1, 0, 9, 8, 7, 0, -6, 4, 16, 10,
+        4, -4, 2, 14, 10, 5, -3, 2, 13, 9, 5, 6, 9, 12, 11, 1,
+        0, 9, 16, 14, 0, -11, 0, 9, 15, 13, -1, -3, 7, 9, 1, 2,
+        9, 15, 13, 0, -2, 0, 1, 1, 8, 5, -2, 2, 12, 8, -3, -9,
+        -5, 3, 13, 16, 11, -3, -3, 1, 3, 9, 13, 12, 8, 6, 0, -4,
+        5, 8, 2, 4, 9, 13, 12, 8, 6, 8, 11, 11, 2, -7, 1, 15,
+        20, 12, -5, -13, -6, 5, 16, 17, 9, -5, -3, 11, 11, 8, -2, 0,
+        2, 10, 6, -3, 1, 11, 9, -2, 0, 10, 9, -1, -7, 3, 16, 19,
+        3, -12, -12, 0, 9, 6, 5, -1, -4, -3, 1, 3, 1, 6, 12, 6,
+        3, -1, 5, 14, 8, 3, -3, 4, 14, 17, 11, 5, 4, 9, 13, 4,
+        2, 7, 13, 6, -5, -1, 4, 4, -1, 4, 4, 8, 12, 12, 1, 0,
+        8, 7, 7, 9, 10, 2, -6, -6, 8, 19, 18, -1, -14, -10, 11, 25,
+        11, -10, -17, -5, 9, 10, 0, -8, -7, 1, 13, 10, 5, 5, 9, 4,
+        -3, -6, -2, 2, 11, 7, -3, -8, -4, 11, 12, 0, -1, 7, 15, 7,
+        2, 5, 3, -1, -3, 6, 8, 9, 10, 1, 2, 9, 7, 6, 8, 3,
+        4, 2, -1, 5, 6, 0, -5, -4, 0, 3, 2, 7, 4, 6, 2, -3,
+        4, 6, 10, 3, -5, 2, 6, 3, 6, 11, 13, 2, 0, 7, 14, 14,
+        1, -10, -9, 9, 22, 11, -1, 0, 10, 9, -1, 1, 2, 1, -1, 6,
+        14, 7, 2, 5, 3, 7, 11, 4, 3, 8, 5, 6, 10, 4, -4, -6,
+        -2, 3, 3, 0, -3, -3, 0, 2, 9, 14, 13, 8, -2, -8, -4, 3,
+        5, 1, 5, 11, 6, 4, -1, 5, 5, 8, 11, 3, 2, 8, 14, 13,
+        9, 6, -1, -5, 5, 17, 10, -5, -4, 2, 13, 9, 5, 6, 10, 4
+      },
+      {
+        4, 2, -2, -2, 1, 5, 5, 3, -1, -2, 5, 3, 1, 3, 2, -1,
+        2, 3, -1, -3, 4, 8, 4, -3, 1, 8, 3, -1, -1, 5, 7, -1,
+        -5, 0, 7, 7, -3, -5, 5, 10, 4, -1, 3, 8, 1, -5, 2, 6,
+        0, -5, 3, 9, 5, -4, 0, 9, 8, 1, -3, 4, 9, 1, -6, -2,
+        8, 8, 1, -4, -1, 3, 5, 0, 0, 6, 3, -3, -3, 2, 2, -2,
+        -3, 4, 4, -3, 0, 7, 7, 2, 1, 1, 0, 3, 2, 2, 0, 3,
+        6, 5, 3, 3, 5, 5, 4, 3, 4, 1, 2, 1, -1, 3, 2, -1,
+        -2, 0, 1, 3, 1, -2, -1, 5, 3, -3, 1, 4, 4, 3, -1, 2,
+        7, 6, 2, 2, 1, -1, 3, 2, 2, 0, -2, 4, 3, 2, 3, 5,
+        4, 3, 3, 5, 5, 4, 0, 2, 2, -1, -2, 4, 3, -2, -3, 0,
+        6, 2, -4, -2, 2, 6, 4, 2, 3, 1, -2, -1, 5, 7, -1, -5,
+        3, 6, 3, -3, 2, 4, 0, -3, 3, 4, -2, 0, 6, 7, -2, -5,
+        4, 6, 2, 1, 5, 2, 1, 4, 2, -2, 2, 7, 5, -3, -4, 5,
+        9, 3, -5, 1, 5, 0, 0, 1, 1, 3, 1, 2, 1, 3, 1, -2,
+        2, 3, -1, -3, 0, 5, 6, -2, -5, 4, 9, 0, -7, 2, 7, 0,
+        -2, 5, 4, -3, -4, 1, 3, -1, 1, 2, 0, 2, 2, -1, 2, 6,
+        5, -2, 0, 3, 5, 0, -3, -1, 2, 4, 4, -1, 1, 2, 4, 0,
+        1, 1, 0, -1, 4, 7, 4, 2, 3, 2, -1, -2, 4, 3, 1, -1,
+        -1, 4, 7, 4, 2, 0, -1, 4, 2, 1, 4, 5, 4, 3, 4, 1,
+        2, 5, 5, 3, -1, -2, 1, 5, 1, 0, 0, 4, 6, 0, -4, 3,
+        5, -1, 0, 2, 5, 1, 1, 5, 6, -1, 0, 2, 1, -2, 2, 7,
+        1, -1, 1, 5, 6, -1, -4, 0, 7, 2, -1, 3, 7, 5, 2, 3,
+        6, 5, -1, 1, 3, 0, -2, -1, 5, 3, -3, -3, 5, 4, -3, -4,
+        1, 3, -1, -3, 4, 8, 4, 1, 3, 6, 1, 0, 1, 1, 3, 5,
+        0, 0, 5, 3, 1, 0, 0, 0, 4, 6, 0, 0, 2, 1, -1, 3,
+        3, -2, 1, 3, 4, 4, 4, 0, -2, 4, 8, 4, -3, -3, 6, 5,
+        -3, -1, 4, 5, -1, 0, 2, 1, 2, 5, 1, -3, -1, 6, 7, -2,
+        -5, 4, 10, 4, -5, -4, 7, 5, -4, -1, 4, 2, -3, 1, 4, 0,
+        1, 5, 2, -3, -3, 2, 6, 5, 2, 3, 1, 3, 1, -1, 3, 7,
+        1, -1, 1, 5, 2, -3, -2, 2, 5, 5, -2, 1, 7, 7, -2, -1,
+        3, 2, -2, 2, 7, 6, -2, 0, 7, 7, -2, -5, 1, 8, 2, -6,
+        -3, 7, 9, 1, 0, 1, 1, -1, 3, 6, 5, 2, -1, -1, 5, 3,
+        1, -1, -1, 0, 0, 3, 1, 2, 5, 5, 4, 3, 4, 1, -2, -1,
+        1, 0, -1, -1, 0, 4, 2, 1, 4, 2, 2, 4, 2, -2, -2, 5,
+        3, -3, -4, 5, 5, -3, -5, 5, 9, -1, -3, 5, 9, 4, 0, 3,
+        7, 5, -2, 0, 8, 3, -1, -1, 5, 3, -3, -3, 5, 4, 1, -2,
+        -1, 5, 7, -1, -1, 2, 5, 5, -1, 1, 7, 7, 2, -3, 3, 8,
+        5, 1, 2, 2, -1, 2, 2, -1, -2, 4, 7, 0, -1, 5, 8, 4,
+        1, 0, 4, 7, 0, 0, 5, 3, 1, -1, 3, 7, 0, -1, 1, 1,
+        -1, -1, 0, 4, 6, 3, 2, 0, 3, 2, -2, -2, 4, 7, 4, -3,
+        1, 4, 0, -3, -1, 2, 5, 0, -3, -1, 6, 3, -4, -3, 2, 6,
+        5, -2, 0, 7, 7, 2, 1, 5, 2, -3, 2, 8, 6, -3, -1, 4,
+        5, 0, 0, 6, 7, -1, -1, 2, 6, 1, 0, 1, 0, 3, 1, 2,
+        5, 1, 1, 1, 0, -1, 4, 6, 0, -1, 1, 5, 1, 1, 1, 0,
+        3, 2, 2, 4, 5, 4, -1, -2, 0, 6, 6, -2, 0, 3, 1, -2,
+        -2, 5, 3, -3, -3, 5, 8, 3, -4, -3, 3, 2, -2, 1, 7, 6,
+        -2, -4, 1, 3, -1, 1, 6, 6, 3, -2, -2, 1, 1, 3, 4, 4,
+        3, -1, 2, 2, 3, 0, 2, 2, 3, 1, 2, 1, -1, -1, 4, 3,
+        -3, -3, 1, 2, -1, -2, 4, 3, 2, 3, 5, 5, -1, 1, 2, 0,
+        2, 1, -1, -2, 0, 1, -1, -1, -1, 0, 4, 1, -3, 2, 3, 3,
+        -1, -2, 0, 1, 4, 1, 1, 1, -1, 3, 6, 5, -2, -3, 1, 2,
+        -1, 1, 6, 6, 3, 2, 1, -1, -1, 4, 6, 4, 2, 0, 3, 6,
+        5, 2, -1, -1, 0, 0, 3, 1, -2, 2, 7, 1, -5, 2, 5, 4,
+        -2, -3, 5, 4, 1, -2, -1, 1, 4, 5, 3, 3, 4, 1, 2, 5,
+        6, -1, 0, 2, 1, 2, 5, 5, -1, 1, 6, 7, 2, -2, -2, 6,
+        7, 3, -3, 2, 8, 6, -3, -5, 6, 10, -1, -3, 2, 7, 6, 1,
+        2, 2, 3, 1, -2, 3, 7, 5, 1, -1, -1, 1, 0, -1, -1, 4,
+        6, 4, 2, 0, 3, 2, 2, 4, 1, 2, 5, 2, 1, 0, 0, -1,
+        4, 6, 4, -2, -3, 1, 2, 3, 0, -2, 3, 3, -2, -3, 0, 2,
+        3, 0, -3, 3, 4, -2, -4, 4, 4, 2, 2, 1, 3, 1, -2, -2,
+        5, 7, 3, -3, -3, 6, 4, 1, -2, 0, 5, 2, -3, -3, 2, 6,
+        5, 2, 3, 5, 5, -1, -3, 4, 5, -2, 0, 3, 5, 4, -1, 1,
+        7, 6, 2, -2, -1, 1, 5, 1, 0, 1, 0, 3, 2, -2, 2, 3,
+        -1, 1, 2, 4, 4, 4, -1, -2, 0, 1, 0, -2, -1, 5, 2, -3,
+        1, 4, 0, 1, 5, 2, -3, 2, 4, 4, -1, -3, 0, 2, 4, 0,
+        -3, -1, 5, 7, 3, 1, 0, 0, 0, 0, 4, 6, 4, -2, -3, 5,
+        4, 1, -2, 3, 3, 3, -1, -2, 0, 5, 6, 3, 2, 0, -1, 0,
+        0, 4, 2, 1, 0, -1, 3, 2, 2, 0, 3, 2, -1, -2, 4, 7,
+        4, -3, 1, 8, 3, -5, 1, 5, 4, -2, -4, 1, 6, 6, -2, 0,
+        3, 5, 4, 3, 4, 1, 2, 1, 3, 5, 4, 3, 3, 1, -2, -1,
+        1, 0, 3, 5, 1, -4, 3, 8, 5, -4, 0, 8, 8, 1, 1, 2,
+        1, -1, 3, 3, 2, 4, 5, 0, 1, 6, 6, -1, -4, 4, 5, -2,
+        -5, 4, 9, 4, -1, 3, 3, 3, 4, 0, 2, 6, 2, -4, 2, 8,
+        6, -3, 0, 4, 1, -3, -2, 5, 4, -4, 0, 4, 5, -1, -4, 0,
+        2, 0, -2, 3, 3, -2, 1, 6, 6, -2, -5, 4, 6, 2, -3, 2,
+        4, 3, 3, 0, -2, 4, 7, 4, 1, -1, 0, 1, 4, 5, 4, -1,
+        -2, 5, 8, 0, -2, 1, 2, -1, -2, 0, 1, 4, 1, -3, 3, 8,
+        1, -5, -2, 7, 4, -1, -2, 5, 4, 1, -1, -1, 5, 3, 1, -1,
+        3, 2, -2, -2, 0, 5, 6, -2, 0, 7, 3, -4, 1, 4, 1, -4,
+        2, 8, 5, -3, -4, 6, 5, 1, -3, 3, 8, 1, -6, -2, 4, 5,
+        3, 2, 4, 1, 2, 5, 5, 3, 3, 0, 3, 2, 3, 0, -2, 3,
+        7, 1, -1, 5, 4, -3, 1, 3, 4, 4, 3, 0, 2, 2, -1, 2,
+        2, 3, 4, 0, -3, 3, 8, 1, -5, 2, 6, 3, -3, 1, 8, 2,
+        -5, -3, 3, 2, 1, 3, 5, 0, 1, 5, 6, 3, 2, 4, 6, 4,
+        -1, -3, 5, 8, 4, -4, 1, 5, 0, -4, 3, 8, 5, -3, 0, 4,
+        5, -1, -4, 0, 6, 2, -5, -3, 6, 4, 0, -2, 4, 4, 2, 3,
+        5, 5, 3, 3, 0, 2, 2, -1, -2, 4, 3, -3, 1, 3, 4, 0,
+        -3, 0, 2, 4, 4, 3, -1, -2, 4, 8, 4, -3, -3, 2, 6, 1,
+        -5, -2, 7, 4, -1, -2, 0, 1, -1, 2, 6, 5, 2, 3, 1, 3,
+        5, 1, -3, -1, 6, 3, 0, 3, 6, 1, 0, 1, 5, 6, -1, 0,
+        2, 1, -2, 3, 7, 1, -1, 5, 7, 0, -1, 1, 1, 3, 1, 2,
+        5, 1, 1, 5, 6, 0, -4, 3, 5, 3, -2, 2, 3, -1, 1, 6,
+        2, 0, 4, 6, 4, -2, -3, 5, 8, 4, -4, 1, 5, 4, -2, -3,
+        4, 8, 0, -2, 1, 6, 2, 0, 0, 5, 6, 4, -2, 2, 7, 6,
+        -2, -4, 1, 3, 3, -1, 1, 6, 6, 2, 2, 1, -1, 3, 2, -2,
+        -2, 0, 1, -1, 2, 6, 5, 2, 3, 1, 3, 1, 2, 1, 3, 5,
+        1, 1, 5, 6, 0, -4, 4, 5, -2, -1, 6, 3, -4, 0, 8, 3,
+        -1, 3, 4, -1, 1, 2, 0, -2, -1, 1, 4, 1, -3, 2, 4, 3,
+        -1, 2, 3, 3, 4, 0, 1, 2, 0, 2, 6, 1, -4, -2, 6, 7,
+        -2, -2, 3, 6, 4, -2, -3, 5, 5, -3, 0, 7, 7, 2, 1, 5,
+        7, 0, 0, 2, 1, 3, 5, 5, 3, -1, -2, 4, 3, -2, -3, 5,
+        9, 4, 0, 0, 5, 7, 4, -2, 1, 8, 2, -5, 1, 5, 0, 0,
+        5, 7, 4, 2, 0, 4, 2, 2, 0, -1, 4, 7, 4, 2, 3, 2,
+        -1, 2, 3, 3, 4, 4, 4, 4, 4, 4, 4, 4, 4, 4, 0, -2,
+        -1, 5, 2, -4, -3, 2, 2, -2, 1, 6, 2, -4, 2, 9, 6, -4,
+        -1, 4, 6, 3, 2, 0, -1, 0, 4, 2, 1, 0, 3, 6, 0, 0,
+        1, 1, -1, 3, 2, 2, 0, 2, 6, 1, 0, 1, 0, 3, 5, 0,
+        0, 1, 4, 5, -1, 0, 2, 4, 5, -1, 1, 6, 6, 3, 2, 1,
+        4, 6, 4, 3, -1, -1, 4, 3, 2, 3, 1, 2, 5, 1, -3, 2,
+        8, 5, 1, -2, 4, 4, -2, -3, 4, 4, -3, 0, 7, 3, -4, -3,
+        2, 2, 2, 3, 5, 0, 1, 1, 0, 3, 6, 5, 3, 3, 1, -1,
+        3, 3, -2, 1, 7, 6, 2, 2, 5, 6, 4, 3, 0, -1, 4, 7,
+        4, 2, -1, -1, 0, 0, 3, 5, 4, -1, 1, 7, 2, 0, 0, 5,
+        3, 1, 0, -1, 4, 6, 0, -5, 3, 9, 1, -7, -2, 8, 8, 1,
+        -4, -1, 3, 1, -3, -2, 5, 3, -3, -3, 1, 2, -1, 1, 6, 2,
+        0, 0, 4, 6, 0, 0, 2, 5, 5, 3, 3, 5, 5, 4, 3, 0,
+        2, 6, 5, -1, -4, 4, 5, -2, -5, 4, 5, 2, 1, 5, 2, 1,
+        4, 2, 2, 4, 6, 0, -4, -1, 6, 7, 2, -3, -1, 2, 5, 5,
+        -1, -3, 0, 2, 0, -2, -1, 1, 0, -2, 3, 3, 2, 4, 5, 0,
+        -3, -1, 2, 0, 2, 1, -1, -1, 0, 4, 2, -3, 2, 8, 6, -3,
+        0, 8, 4, -5, -4, 7, 5, 0, 1, 2, 4, 5, 0, 1, 6, 2,
+        0, 0, 0, 4, 2, -3, -2, 1, 1, -1, -2, 4, 3, 2, -1, -1,
+        4, 3, 1, -1, -1, 4, 3, -3, 1, 7, 6, -2, -1, 7, 8, 2,
+        -3, -1, 2, 5, 4, -1, 1, 7, 6, -2, -5, 5, 6, -2, -5, 4,
+        10, 0, -3, 5, 5, 2, 2, 1, 3, 5, 0, 0, 5, 3, -3, -3,
+        2, 2, -2, -2, 0, 1, -1, -2, 3, 7, 4, 2, -1, -1, 0, 0,
+        -1, -1, 4, 6, 0, -1, 1, 5, 1, 1, 5, 2, 1, 4, 6, 4,
+        3, 4, 1, -2, 3, 7, 1, -5, 2, 5, 3, -2, 1, 7, 6, -2
+      },
+      {
+        8, 9, 4, -2, -6, 2, 13, 22, 15, 0, -4, -7, 2, 14, 14, 6,
+        3, -2, -6, -6, 4, 17, 24, 15, 7, 3, -3, 0, 1, 8, 16, 11,
+        1, -9, -4, 8, 12, 7, 7, 10, 13, 14, 14, 12, 2, -8, -5, -1,
+        2, 2, 9, 16, 19, 10, 4, 3, 7, 12, 8, 7, 9, 4, -3, -8,
+        1, 13, 22, 16, 1, -12, -8, -2, 11, 22, 17, 3, -10, -15, -12, -3,
+        5, 16, 15, 6, 3, 5, 11, 15, 17, 7, -6, -5, -4, 7, 10, 14,
+        16, 16, 13, 9, 8, 8, 10, 12, 13, 5, 2, -2, -6, 2, 5, 4,
+        1, -3, -5, 4, 8, 5, 0, 4, 3, 0, 5, 5, 9, 14, 9, 7,
+        8, 11, 13, 14, 5, -6, -4, -2, 8, 10, 5, 6, 2, 5, 11, 16,
+        17, 15, 11, 8, 7, 8, 3, 4, 1, -3, -5, 4, 7, 5, 0, -4,
+        2, 5, 3, 0, -3, 4, 14, 21, 21, 8, -8, -17, -7, 10, 17, 12,
+        9, 1, 1, -1, 5, 6, 2, -2, 3, 4, 2, 7, 14, 18, 10, -3,
+        -4, -4, 5, 16, 22, 13, 6, 4, -2, -7, 1, 13, 21, 15, 1, -3,
+        2, 11, 10, 11, 4, -4, -1, 0, 0, 8, 8, 11, 6, 6, 1, -4,
+        1, 3, 2, 0, -3, 5, 14, 13, 4, 2, 6, 4, 0, 3, 3, 0,
+        6, 13, 10, 2, -7, -10, -8, -2, 11, 14, 8, 7, 1, -5, 0, 11,
+        20, 14, 9, -1, -2, -3, -3, -2, -1, 8, 18, 14, 11, 1, 0, -3,
+        4, 6, 3, -1, 4, 12, 19, 20, 16, 2, -11, -16, -4, 6, 18, 16,
+        5, 2, 4, 10, 15, 9, -2, -2, -3, 5, 15, 21, 20, 15, 8, -3,
+        -4, 4, 14, 20, 12, -2, -12, -7, 0, 12, 14, 15, 14, 4, -7, -5,
+        -2, 0, 9, 10, 12, 6, 5, 8, 12, 7, 6, 0, -5, -7, 2, 15,
+        16, 14, 4, 1, 4, 3, -1, -4, 3, 6, 12, 17, 18, 15, 11, 7,
+        7, 8, 3, 4, 1, -3, -5, -4, 6, 10, 7, 0, 3, 2, -1, -3,
+        -3, -2, -1, 1, 9, 18, 21, 19, 13, 7, -3, -3, -3, -2, 7, 17,
+        14, 11, 10, 1, 1, -1, -4, -4, 5, 16, 15, 12, 2, -8, -12, -2,
+        6, 8, 13, 8, 8, 9, 12, 6, -4, -2, 7, 17, 13, 2, 0, -3,
+        -5, 4, 7, 13, 9, 8, 2, -5, -1, 10, 11, 5, -3, 0, 9, 9,
+        4, 5, 10, 14, 9, -2, -2, -2, -2, 6, 8, 5, -1, 2, 3, 1,
+        6, 14, 11, 1, -7, -11, 0, 15, 25, 25, 10, 0, -10, -13, -2, 15,
+        18, 18, 7, 1, -5, -8, -7, -3, 10, 21, 17, 12, 8, 7, 0, 2,
+        0, -2, -3, 5, 15, 22, 13, 6, 4, 6, 2, -3, -6, 2, 6, 5,
+        1, 5, 12, 17, 18, 7, -7, -15, -6, 11, 24, 28, 14, -6, -11, -10,
+        2, 10, 9, 3, -3, 1, 2, 9, 17, 19, 17, 12, 8, -2, -10, -12,
+        -7, 0, 5, 6, 4, 7, 5, 8, 12, 7, 6, 9, 4, -3, -8, 0,
+        5, 5, 2, 6, 5, 0, -4, 3, 13, 12, 12, 12, 12, 11, 10, 10,
+        10, 11, 3, 2, 7, 4, 7, 4, 6, 3, -2, -5, 2, 6, 13, 10,
+        2, 2, 7, 6, 9, 5, 6, 10, 6, 7, 10, 13, 15, 6, 3, 5,
+        10, 15, 16, 7, -6, -5, -3, -1, 1, 9, 18, 13, 10, 8, 9, 10,
+        12, 5, 3, 7, 4, 6, 11, 7, 7, 2, 3, 9, 7, 9, 3, -3,
+        -8, -7, -4, 9, 21, 25, 21, 5, -4, -10, -11, -6, 8, 22, 27, 15,
+        4, -8, -14, -12, -5, 3, 16, 16, 7, -4, -3, -2, -1, 0, 0, 8,
+        16, 13, 10, 9, 10, 11, 12, 12, 4, -6, -3, 7, 18, 14, 11, 1,
+        0, -3, 4, 13, 20, 12, 7, -3, -2, -2, 6, 8, 4, 6, 3, 6,
+        12, 8, 8, 2, -5, -8, 1, 15, 15, 15, 5, 2, -3, 1, 3, 2,
+        7, 6, 9, 13, 15, 15, 4, -7, -13, -3, 13, 17, 18, 8, -5, -13,
+        -13, 2, 11, 12, 5, 5, 9, 13, 8, -2, -9, -10, -6, 8, 22, 27,
+        15, -4, -17, -19, -11, 9, 26, 32, 26, 5, -15, -24, -18, 3, 25, 35,
+        30, 8, -6, -16, -8, 0, 14, 16, 16, 6, 2, -4, -7, -7, 5, 10,
+        8, 1, -5, -7, -6, -2, 10, 13, 15, 16, 14, 11, 1, -1, -3, -5,
+        4, 7, 5, 0, -4, -6, -4, -1, 2, 3, 10, 9, 3, 4, 1, 6,
+        5, 0, -4, -5, 4, 8, 14, 10, 1, 0, 7, 14, 10, 1, -8, -11,
+        -8, 6, 21, 27, 24, 15, -3, -16, -19, -3, 17, 30, 30, 12, -1, -5,
+        1, 11, 11, 4, -4, -9, 0, 5, 6, 11, 15, 9, -2, -2, -3, 6,
+        7, 4, 7, 4, 7, 4, -1, -5, 2, 13, 21, 22, 17, 2, -4, -1,
+        9, 9, 11, 5, -3, -1, 8, 17, 13, 10, 8, 9, 11, 4, -5, -2,
+        8, 17, 13, 10, 8, 9, 2, -5, -1, 9, 11, 13, 6, 5, 7, 12,
+        15, 7, 4, -2, -7, 0, 12, 21, 23, 10, -7, -17, -16, -8, 3, 17,
+        26, 26, 17, 0, -7, -11, -1, 14, 16, 16, 14, 3, 0, -4, -6, -5,
+        6, 18, 24, 14, -2, -15, -17, -2, 9, 13, 16, 9, -2, -10, -11, -7,
+        8, 14, 11, 10, 2, -5, -9, 0, 6, 15, 20, 12, 6, -3, -10, -10,
+        2, 18, 26, 17, 0, -6, -9, 0, 6, 7, 11, 7, -1, -7, -8, 2,
+        16, 25, 24, 17, 8, -5, -14, -6, 2, 6, 14, 11, 10, 11, 3, 3,
+        7, 13, 16, 8, -4, -12, -4, 2, 14, 14, 6, 4, -1, -5, 2, 5,
+        4, 8, 6, 8, 12, 15, 7, -4, -11, -11, -6, 1, 6, 14, 12, 3,
+        2, -1, -4, 3, 14, 13, 4, 3, -2, 3, 4, 1, -2, -4, 4, 7,
+        5, 0, 4, 11, 18, 19, 8, -6, -15, -14, 1, 19, 29, 20, 0, -7,
+        -11, -1, 6, 15, 13, 11, 3, -7, -11, -1, 14, 24, 26, 11, -8, -19,
+        -18, 0, 12, 23, 18, 3, -2, -7, 0, 4, 12, 10, 2, -6, -1, 9,
+        19, 14, 10, 8, 0, -7, -2, 2, 11, 11, 4, -4, -1, 9, 10, 12,
+        6, 5, 8, 12, 15, 7, 4, -2, 1, 9, 17, 20, 17, 4, -10, -16,
+        -13, -4, 13, 26, 21, 5, -3, -1, 7, 8, 11, 14, 15, 14, 11, 1,
+        -8, -12, -1, 7, 16, 22, 21, 7, -1, 0, 7, 6, 1, 4, 3, -1,
+        -4, 4, 14, 21, 21, 16, 1, -4, 0, 1, 8, 16, 11, 1, -1, 5,
+        13, 10, 10, 2, -6, -9, -8, 5, 11, 9, 10, 4, 4, 1, -4, -6,
+        -5, -2, 1, 10, 11, 5, 5, 9, 14, 8, -2, -1, -2, 6, 7, 11,
+        7, 7, 10, 5, -3, 0, 9, 17, 20, 10, -5, -14, -7, 9, 23, 20,
+        5, -1, 1, 0, 6, 6, 2, -3, -6, -5, -2, 9, 12, 7, 7, 10,
+        5, -2, -8, 0, 4, 13, 11, 11, 4, 3, -1, -4, 3, 5, 12, 9,
+        9, 3, -4, -8, -7, 5, 19, 18, 15, 11, 0, -9, -5, 0, 3, 3,
+        9, 16, 19, 9, -4, -5, -5, 5, 9, 14, 17, 8, -4, -12, -13, 1,
+        18, 28, 27, 10, -2, -4, 3, 12, 19, 12, 7, -3, -2, -2, -2, 6,
+        16, 13, 11, 10, 2, -7, -2, 1, 10, 18, 21, 10, 3, -6, -11, -1,
+        5, 15, 21, 13, -1, -4, 2, 4, 3, 7, 6, 8, 5, 6, 11, 6,
+        -1, -7, -9, -5, 8, 21, 26, 14, 5, 1, 3, 9, 15, 17, 15, 12,
+        0, -10, -6, 7, 20, 17, 13, 1, -10, -13, -2, 15, 26, 19, 10, -4,
+        -6, -6, -4, -1, 10, 11, 6, -2, 0, 1, 8, 8, 11, 6, 6, 9,
+        13, 15, 14, 12, 2, -1, -4, -5, -4, 6, 10, 7, 8, 3, 5, 2,
+        -2, -5, -5, 5, 17, 24, 14, -2, -6, 0, 11, 12, 5, -4, -1, 0,
+        0, 0, 7, 8, 11, 7, -1, -8, -9, 3, 17, 25, 24, 17, 0, -7,
+        -2, 1, 1, 0, 7, 7, 11, 14, 16, 6, 3, -3, 1, 10, 10, 12,
+        5, -4, -9, -1, 12, 15, 16, 14, 12, 2, -1, -4, -5, 4, 7, 13,
+        17, 9, 5, 5, 9, 5, -2, 1, 1, 8, 8, 10, 5, -2, 0, 9,
+        9, 11, 13, 14, 13, 3, -7, -5, 7, 18, 15, 12, 1, -1, -4, -5,
+        4, 15, 14, 13, 3, 1, -3, 3, 4, 10, 16, 18, 8, 3, 4, 8,
+        5, -1, -6, -7, 3, 8, 15, 19, 18, 14, 9, -2, -10, -4, 1, 4,
+        3, 1, -2, -3, 5, 16, 22, 21, 15, 0, -5, -8, 1, 5, 13, 19,
+        11, 6, 5, 8, 3, -3, 1, 2, 1, 7, 15, 11, 1, 0, 6, 5,
+        9, 13, 8, -2, -1, -1, -2, -2, -1, 0, 8, 9, 4, 6, 2, 6,
+        4, 7, 5, 7, 12, 7, 7, 1, -5, 0, 11, 11, 5, -4, -1, 9,
+        9, 12, 6, 5, 8, 4, -2, 1, 2, 0, 7, 14, 19, 19, 14, 9,
+        6, -2, 0, -1, -2, 6, 15, 20, 20, 7, -8, -8, -6, -1, 2, 11,
+        19, 21, 18, 3, -3, 0, 8, 8, 11, 13, 6, -4, -2, -1, -1, 7,
+        16, 21, 19, 14, 0, -4, -7, 2, 6, 5, 9, 14, 17, 16, 13, 1,
+        -10, -6, -1, 10, 20, 23, 19, 12, 6, 3, 6, 10, 14, 15, 6, -6,
+        -13, -4, 4, 7, 5, 1, -3, -5, 4, 16, 15, 5, 2, 5, 11, 8,
+        8, 2, 3, 9, 15, 9, -1, -9, -3, 2, 12, 12, 13, 13, 4, 2,
+        -2, -6, -6, 5, 9, 15, 10, 8, 9, 3, 3, 1, -3, 3, 13, 12,
+        12, 4, 3, 7, 4, 7, 4, 6, 11, 7, 7, 10, 13, 14, 14, 4,
+        1, 4, 11, 16, 9, -2, -3, -3, 5, 15, 13, 11, 10, 2, -7, -3,
+        8, 19, 23, 12, 4, -6, -12, -10, 4, 11, 11, 12, 13, 5, -5, -11,
+        -10, -5, 10, 22, 27, 14, 3, -8, -14, -4, 13, 25, 27, 21, 2, -15,
+        -13, -6, 2, 14, 23, 24, 18, 10, 4, 3, 6, 12, 7, -1, 0, 8,
+        16, 19, 10, -4, -13, -14, 0, 18, 29, 20, 9, 2, -6, -3, 0, 9,
+        10, 12, 6, -3, -1, 8, 8, 3, 5, 10, 7, 0, -7, 0, 11, 21,
+        15, 1, -11, -15, -11, -2, 13, 17, 10, -1, -10, -12, -7, 8, 22, 20,
+        15, 1, -3, 2, 3, 9, 7, 9, 12, 14, 14, 12, 10, 9, 9, 2,
+        2, 7, 14, 9, 0, 0, -2, -3, -3, 6, 9, 13, 16, 16, 5, 1,
+        3, 1, 6, 13, 17, 10, -3, -12, -5, 10, 22, 18, 4, -9, -8, 4,
+        10, 8, 1, -5, -7, -6, -2, 2, 4, 3, 8, 7, 10, 13, 15, 6,
+        -5, -12, -11, -6, 10, 15, 11, 1, -7, -2, 1, 3, 10, 17, 19, 9,
+        3, 3, -1, -4, -6, 4, 8, 14, 18, 9, 5, 5, 0, 4, 10, 8,
+        9, 3, -4, 0, 1, 1, 0, -2, -2, -2, -1, 8, 10, 13, 7, -2,
+        -1, -1, 7, 8, 3, 5, 3, -1, 3, 12, 18, 12, 7, 6, 8, 11,
+        6, -3, -9, -1, 12, 14, 15, 14, 12, 2, -8, -5, -1, 2, 2, 9,
+        16, 11, 9, 8, 2, 2, 8, 6, 8, 12, 6, 6, 8, 4, -3, -7,
+        -7, -4, 0, 3, 4, 2, -1, -3, 5, 15, 21, 21, 7, -8, -17, -15,
+        -6, 4, 17, 25, 17, 8, -5, -5, -4, 6, 17, 15, 12, 10, 9, 9,
+        10, 12, 4, -5, -2, 7, 9, 5, 6, 2, 5, 3, 7, 13, 16, 9
+      },
+      {
+        8, 10, 9, 6, 2, 6, 14, 22, 20, 13, 12, 6, 7, 11, 8, 3,
+        5, 2, -1, -5, 1, 10, 20, 20, 22, 24, 18, 15, 7, 6, 8, 5,
+        -1, -7, -2, 7, 9, 7, 11, 18, 24, 28, 29, 29, 19, 5, 0, -7,
+        -13, -16, -8, 5, 18, 21, 25, 29, 30, 30, 19, 13, 11, 2, -7, -14,
+        -9, 1, 13, 15, 13, 7, 9, 6, 9, 15, 13, 7, 0, -6, -10, -12,
+        -11, -1, 5, 7, 15, 24, 30, 34, 34, 24, 9, 3, -6, -5, -7, -1,
+        9, 19, 27, 31, 33, 32, 28, 24, 19, 7, 2, -6, -13, -9, -8, -7,
+        -6, -4, -3, 7, 11, 10, 8, 12, 10, 6, 9, 7, 10, 16, 14, 16,
+        19, 22, 24, 24, 16, 4, 1, -5, -2, -3, -5, 2, 4, 11, 20, 27,
+        31, 33, 31, 28, 23, 19, 7, 2, -6, -13, -17, -10, -6, -3, -1, 1,
+        9, 12, 10, 7, 2, 6, 14, 21, 27, 22, 12, 1, 0, 4, 2, -1,
+        3, 3, 9, 9, 13, 11, 6, 0, 3, 2, -1, 5, 13, 22, 20, 13,
+        12, 6, 7, 11, 16, 13, 14, 16, 11, 3, 3, 8, 14, 12, 6, 7,
+        12, 17, 14, 15, 10, 2, 2, -1, -4, 1, 2, 9, 9, 15, 13, 8,
+        9, 6, 1, -4, -8, -1, 9, 12, 10, 14, 20, 17, 9, 9, 4, -2,
+        1, 8, 8, 5, 1, -4, -6, -8, 0, 4, 5, 12, 13, 10, 13, 18,
+        23, 19, 18, 10, 9, 3, -4, -10, -13, -6, 7, 11, 19, 18, 21, 16,
+        15, 9, 1, -6, -4, 4, 14, 23, 29, 24, 14, 2, 0, -5, -1, -1,
+        -2, 4, 13, 23, 29, 25, 15, 11, 3, 3, 7, 13, 19, 23, 26, 19,
+        15, 14, 15, 16, 9, 0, -9, -6, -6, 1, 4, 12, 20, 19, 13, 13,
+        8, 1, 2, 0, 5, 5, 10, 17, 24, 20, 20, 12, 2, -7, -5, 2,
+        4, 10, 10, 15, 20, 17, 9, 1, 1, -1, 3, 11, 20, 26, 30, 31,
+        29, 26, 14, 8, -2, -11, -18, -20, -11, -4, 0, 3, 12, 15, 13, 8,
+        3, -2, -6, -8, 0, 11, 23, 31, 36, 36, 26, 18, 6, -7, -9, -4,
+        -3, 4, 13, 14, 18, 14, 7, 0, 1, 7, 7, 12, 10, 5, -1, 3,
+        2, 0, 5, 6, 12, 19, 26, 22, 13, 10, 11, 14, 10, 2, 3, 0,
+        -4, 0, 1, 8, 9, 14, 13, 8, 9, 14, 12, 6, -1, 1, 8, 8,
+        5, 8, 15, 21, 18, 10, 9, 4, -3, 0, -1, -3, -5, 2, 5, 4,
+        11, 19, 18, 12, 5, -3, 0, 7, 16, 23, 21, 21, 13, 3, 2, 6,
+        4, 7, 6, 9, 7, 3, -2, -6, -1, 9, 12, 18, 24, 28, 22, 19,
+        10, -1, -10, -8, 0, 11, 13, 18, 23, 27, 21, 10, -1, -3, -6, -9,
+        -11, -2, 10, 22, 31, 28, 19, 7, 4, 6, 11, 16, 13, 6, 6, 2,
+        5, 3, 0, -4, -7, 0, 3, 11, 20, 28, 33, 34, 32, 20, 5, -9,
+        -19, -24, -24, -20, -14, 2, 11, 23, 33, 31, 31, 29, 19, 5, -7, -9,
+        -11, -12, -12, -2, 3, 6, 6, 12, 21, 20, 22, 24, 26, 26, 25, 23,
+        20, 18, 8, 5, 5, 1, 3, 0, 4, 3, 0, -3, 3, 4, 10, 11,
+        7, 11, 17, 14, 16, 11, 12, 15, 10, 11, 14, 18, 21, 15, 14, 14,
+        16, 18, 20, 13, 3, 1, -4, -8, -11, -4, 8, 11, 19, 25, 30, 32,
+        31, 20, 14, 11, 2, 1, 4, 2, 5, 4, 8, 15, 13, 15, 11, 4,
+        -3, -9, -12, -5, 7, 20, 30, 28, 27, 18, 6, -5, -6, 0, 9, 10,
+        15, 12, 6, 0, -6, -10, -3, 0, 1, 1, 8, 10, 8, 5, 1, 5,
+        13, 13, 17, 22, 26, 27, 27, 26, 15, 2, -2, 0, 5, 4, 9, 7,
+        10, 8, 11, 16, 21, 17, 16, 9, 9, 3, 4, 1, -3, 1, 1, 8,
+        16, 16, 19, 14, 7, -2, 0, 6, 6, 11, 10, 13, 10, 12, 9, 2,
+        4, 2, 7, 14, 21, 26, 21, 11, 0, -1, 3, 2, 7, 6, 3, -2,
+        -5, 1, 3, 2, 1, 7, 16, 25, 23, 15, 5, -4, -11, -6, 3, 15,
+        17, 13, 7, 0, -5, -1, 8, 18, 26, 23, 15, 4, -5, -4, 3, 12,
+        21, 19, 20, 14, 13, 6, 6, 2, 4, 2, 6, 5, 2, -2, 3, 3,
+        2, -1, -3, -4, -5, -4, 4, 8, 16, 25, 31, 34, 26, 21, 9, -3,
+        -5, -9, -12, -13, -12, -9, -6, -2, 1, 3, 12, 15, 13, 16, 14, 16,
+        11, 4, -3, -8, -3, -2, 7, 9, 7, 12, 19, 25, 21, 12, 2, -7,
+        -13, -8, 3, 15, 26, 33, 28, 17, 4, 1, 3, 8, 15, 13, 14, 17,
+        21, 23, 16, 5, -5, -13, -9, -8, -6, 3, 15, 18, 15, 17, 13, 14,
+        9, 2, 3, 1, 5, 5, 2, -2, 3, 12, 21, 28, 32, 25, 20, 18,
+        16, 8, 5, -1, -8, -5, 4, 14, 14, 18, 23, 26, 27, 19, 7, 3,
+        4, 8, 6, 8, 14, 19, 15, 7, 7, 10, 7, 9, 6, 8, 14, 19,
+        24, 18, 17, 9, -1, -1, 4, 11, 18, 16, 9, 1, -6, -11, -13, -5,
+        8, 21, 31, 29, 28, 19, 14, 13, 6, 5, 8, 4, 7, 4, -1, -5,
+        0, 9, 19, 19, 13, 5, -2, 0, -1, -3, 3, 5, 4, 1, -1, -3,
+        4, 6, 5, 11, 11, 7, 3, 6, 5, 10, 17, 15, 17, 12, 5, -3,
+        -1, 6, 14, 14, 9, 11, 7, 9, 6, 1, 4, 3, 0, -3, -6, 1,
+        12, 22, 30, 35, 35, 25, 10, 3, -6, -13, -10, -8, 1, 13, 16, 21,
+        26, 29, 30, 21, 8, -5, -7, -10, -4, -2, -2, 6, 8, 7, 12, 11,
+        7, 10, 7, 11, 16, 22, 18, 9, 0, -8, -13, -15, -14, -3, 3, 7,
+        15, 17, 13, 16, 20, 16, 8, 7, 3, 5, 3, -1, -5, -8, 0, 3,
+        3, 2, 9, 18, 26, 31, 26, 14, 2, -9, -8, -1, 9, 11, 9, 12,
+        9, 12, 9, 11, 8, 10, 7, 1, -4, 0, 8, 18, 25, 22, 14, 4,
+        -6, -4, -5, 2, 3, 3, 9, 9, 14, 13, 16, 12, 5, -2, 0, 8,
+        16, 15, 18, 21, 16, 7, 5, 0, 3, 1, -2, -5, 1, 11, 13, 18,
+        16, 18, 20, 23, 25, 17, 13, 5, 3, 6, 11, 17, 21, 16, 7, -2,
+        -10, -15, -8, 4, 9, 9, 15, 22, 28, 23, 21, 20, 20, 19, 19, 11,
+        0, -10, -9, -9, -1, 10, 21, 21, 24, 26, 27, 18, 6, 2, -4, -10,
+        -14, -7, 5, 18, 28, 35, 29, 25, 22, 11, 7, 7, 1, -6, -3, 4,
+        13, 14, 17, 14, 6, -1, -8, -4, -2, -2, 5, 8, 15, 14, 10, 4,
+        -2, -6, -9, -2, 2, 3, 11, 20, 28, 25, 16, 13, 5, 5, 1, 3,
+        2, 6, 13, 13, 8, 9, 14, 19, 24, 18, 8, -2, -2, 3, 11, 10,
+        6, 9, 14, 12, 14, 10, 3, -4, -9, -12, -12, -2, 3, 5, 14, 23,
+        22, 16, 7, 7, 2, 5, 3, 7, 6, 11, 9, 4, 7, 5, 9, 8,
+        11, 9, 4, -2, -6, -1, 9, 11, 17, 23, 20, 12, 10, 4, -3, -9,
+        -4, 6, 16, 17, 13, 14, 10, 11, 7, 9, 13, 10, 4, -2, -8, -3,
+        7, 17, 26, 24, 24, 24, 23, 22, 21, 11, 7, -1, -1, -4, -8, -2,
+        8, 10, 16, 23, 20, 12, 10, 5, 6, 10, 16, 13, 14, 9, 2, 3,
+        0, 4, 12, 11, 7, 9, 15, 12, 6, 7, 4, 7, 5, 9, 15, 13,
+        7, 0, -6, -10, -4, 7, 19, 20, 24, 27, 28, 28, 26, 23, 20, 17,
+        7, -4, -6, -1, 6, 7, 12, 10, 5, -1, 2, 10, 18, 17, 19, 13,
+        13, 7, 0, -7, -4, -3, -4, -4, 4, 7, 14, 15, 19, 15, 16, 19,
+        22, 23, 24, 23, 14, 10, 1, -8, -14, -10, -7, -5, 5, 8, 16, 17,
+        12, 6, 0, 2, 9, 18, 16, 11, 11, 14, 19, 14, 6, -3, -2, -3,
+        -5, -7, 1, 4, 12, 13, 11, 6, 0, 4, 11, 19, 26, 30, 23, 19,
+        17, 8, -2, -11, -9, -8, 0, 11, 22, 22, 24, 18, 16, 16, 10, 9,
+        3, -4, -10, -5, 5, 8, 15, 22, 28, 23, 21, 12, 1, -1, -5, -1,
+        7, 8, 13, 20, 25, 20, 11, 8, 2, 3, 0, 4, 3, 0, 5, 13,
+        13, 17, 21, 25, 27, 19, 7, 3, 5, 9, 6, 9, 6, 8, 6, 1,
+        4, 11, 10, 14, 11, 13, 9, 11, 7, 9, 13, 19, 15, 15, 17, 19,
+        13, 4, -6, -13, -8, -6, 3, 15, 25, 33, 36, 27, 14, 7, -2, -11,
+        -16, -18, -17, -13, 0, 16, 29, 39, 43, 59, -36, -5, 26, 43, -48, -4,
+        28, 53, -34, 10, 38, -52, -3, 32, 53, -36, 9, 38, -50, -1, 43, -37,
+        16, 59, -25, 40, -13, -54, 24, -48, 7, 48, -23, 51, -5, -40, 40, -1,
+        -36, 52, 5, -25, -40, 54, 21, -12, -37, 59, 27, -7, -35, 52, 15, -11,
+        -34, -64, 22, -36, 33, -52, -8, 35, 59, -37, 5, 42, -36, 17, 58, -20,
+        54, -5, -45, 31, -46, 13, 61, -10, -61, 8, 58, -9, -63, 7, 60, -5,
+        -49, 32, -35, 17, 61, -14, 61, 2, -39, 43, -7, -48, 39, -6, -42, 47,
+        11, -15, -29, -57, 29, -31, 27, -55, -10, 26, 56, -28, 18, 55, -26, 14,
+        40, -43, 0, 40, -34, 20, 63, -14, 59, 7, -33, 48, 3, -30, 48, -5,
+        -47, 39, -7, -43, 39, -8, -43, 40, 3, -22, -40, 53, 21, -3, -17, -29,
+        -53, 36, 4, -18, -28, -61, 25, -42, 24, -60, -6, 35, -36, 22, 60, -18,
+        48, -12, -59, 25, -44, 19, 62, -12, -63, 7, -62, -5, 38, -31, 29, -62,
+        -13, 24, 55, -28, 10, 44, -44, 5, 46, -36, 14, 56, -21, 55, 4, -41,
+        40, -3, -32, 57, 9, -33, 50, 0, -32, 55, 7, -26, -42, 50, 9, -18,
+        -31, -57, 39, 0, -25, -44, 50, 10, -14, -34, 58, 24, -1, -25, -41, 55,
+        18, -15, -30, -57, 40, 1, -24, -43, 51, 20, -3, -17, -21, -17, -16, -15,
+        -5, 1, 4, 12, 22, 30, 34, 35, 33, 29, 24, 18, 6, -7, -9, -5,
+        4, 13, 14, 9, 3, -3, 0, 8, 17, 17, 20, 23, 17, 15, 8, 7,
+        1, 3, 1, -3, 2, 10, 11, 8, 11, 16, 14, 8, 0, 2, 8, 16,
+        14, 9, 2, -5, -9, -12, -3, 1, 3, 3, 3, 1, 0, 7, 16, 17,
+        21, 17, 17, 19, 13, 12, 5, 6, 9, 15, 20, 23, 25, 26, 25, 14,
+        10, 8, 10, 4, -3, -1, -3, -5, -7, 0, 3, 12, 21, 29, 25, 24,
+        23, 14, 10, 10, 12, 7, -1, -8, -5, 4, 14, 15, 11, 5, 6, 12,
+        10, 5, -1, -6, -9, -10, -10, -7, -5, -2, 9, 13, 21, 28, 33, 26,
+        15, 2, -9, -17, -12, -9, -6, -3, -1, 8, 12, 11, 16, 22, 27, 22,
+        20, 19, 11, 1, -9, -7, -8, 0, 11, 13, 19, 24, 20, 19, 20, 12,
+        10, 3, -4, -3, -4, -6, -7, -7, -6, -5, -3, 7, 11, 19, 19, 14,
+        15, 10, 11, 7, 1, 3, 1, -2, 3, 12, 21, 20, 21, 23, 24, 24,
+        15, 3, -8, -8, -1, 0, 7, 16, 24, 21, 13, 12, 5, -2, -9, -5,
+        5, 7, 14, 22, 19, 20, 22, 15, 13, 14, 7, 7, 10, 6, 0, -6,
+        -10, -12, -12, -10, -6, -3, 0, 3, 12, 23, 31, 36, 29, 16, 2, -10,
+        -18, -21, -13, 2, 9, 19, 20, 24, 19, 19, 19, 13, 11, 12, 15, 18,
+        20, 22, 14, 3, 1, 4, 2, -3, 1, 1, 7, 8, 13, 19, 25, 21
+      }
+    },
+
+    /* Generator registers at the table end */
+    {
+      { 15001, 3750, -112, 5235 },
+      { 15001, 3750, -814, 5030 },
+      { 15001, 3750, -531, 5098 },
+      { 15001, 3750, -112, 5235 },
+      { 15001, 3750, -2890, 4375 },
+      { 15001, 3750, -531, 5098 },
+      { 15001, 3750, -112, 5235 },
+      { 15001, 3750, -814, 5030 },
+      { 15001, 3750, 2355, 5192 },
+      { 15001, 3750, -1980, 6987 },
+      { 15001, 3750, 4649, 8661 },
+      { 15001, 3750, 10798, 13104 }
+    }
+  };
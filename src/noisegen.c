@@ -0,0 +1,83 @@
+/* noisegen.c -- Precomputed noise table generator
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Prints the noise.c source with the noise bank filled
+ * by the generator used in the synthesizer itself.
+ * Run "make noise-table" to regenerate it.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "soundscript.h"
+
+
+/* Local data */
+
+static noise_bank_t bank;
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  size_t i, k;
+
+  noise_bank_setup(&bank);
+
+  printf("/* noise.c -- Precomputed noise waveforms\n"
+         " *\n"
+         " * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk\n"
+         " * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>\n"
+         " * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>\n"
+         " * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>\n"
+         " *\n"
+         " * SPDX-License-Identifier: MIT\n"
+         " */\n"
+         "\n"
+         "/* This file is generated by noisegen. Do not edit. */\n"
+         "\n"
+         "#include <stdint.h>\n"
+         "\n"
+         "#include \"soundscript.h\"\n"
+         "\n"
+         "\n"
+         "const noise_bank_t noise_bank =\n"
+         "  {\n"
+         "    /* Slots */\n"
+         "    {");
+  for (i = 0; i < SYNTH_SOUNDS; i++)
+    printf("%s%s%u", i ? "," : "", (i % 12) ? " " : "\n      ", bank.slot[i]);
+  printf("\n    },\n"
+         "\n"
+         "    /* Samples */\n"
+         "    {\n");
+  for (i = 0; i < NOISE_SOUNDS; i++)
+    {
+      printf("      {");
+      for (k = 0; k < NOISE_TABLE_LENGTH; k++)
+        printf("%s%s%d", k ? "," : "", (k % 16) ? " " : "\n        ", bank.samples[i][k]);
+      printf("\n      }%s\n", (i < (NOISE_SOUNDS - 1)) ? "," : "");
+    }
+  printf("    },\n"
+         "\n"
+         "    /* Generator registers at the table end */\n"
+         "    {\n");
+  for (i = 0; i < NOISE_SOUNDS; i++)
+    printf("      { %u, %d, %d, %d }%s\n",
+           bank.registers[i].ax, bank.registers[i].var1,
+           bank.registers[i].var2, bank.registers[i].var3,
+           (i < (NOISE_SOUNDS - 1)) ? "," : "");
+  printf("    }\n"
+         "  };\n");
+
+  return 0;
+}
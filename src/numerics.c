@@ -158,6 +158,7 @@ void process_number(input_t *input, sink_t *consumer)
       uint8_t nc = 0;
       uint8_t n;
 
+      input_fetch(input);
       flags &= ~NON_ZERO;
       if (sink_last(consumer) != 43)
         sink_put(consumer, 43);
@@ -181,7 +182,7 @@ void process_number(input_t *input, sink_t *consumer)
       n = triplets * 3 + digits;
 
       s = input->start;
-      for (input->start += n; !consumer->status; s++)
+      for (input->start += n; !sink_stopped(consumer); s++)
         {
           c = s[0];
           nc = 0;
@@ -327,7 +328,7 @@ void process_number(input_t *input, sink_t *consumer)
             }
         }
 
-      if (consumer->status)
+      if (sink_stopped(consumer))
         break;
       else if (flags & NUMBER_FRACTION)
         {
@@ -0,0 +1,262 @@
+/* resampler.c -- Output sample rate conversion
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <math.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ru_tts.h"
+#include "resampler.h"
+
+
+/* Local macros */
+
+#define PI 3.14159265358979323846
+
+/* Kaiser window shape parameter */
+#define KAISER_BETA 7.0
+
+/* Passband edge relative to the Nyquist frequency of the lower rate */
+#define CUTOFF 0.84
+
+/* Filter coefficients scale */
+#define UNITY_SHIFT 14
+#define UNITY (1 << UNITY_SHIFT)
+
+
+/* Local subroutines */
+
+/* Greatest common divisor */
+static unsigned int gcd(unsigned int a, unsigned int b)
+{
+  while (b)
+    {
+      unsigned int r = a % b;
+      a = b;
+      b = r;
+    }
+  return a;
+}
+
+/* Zeroth order modified Bessel function of the first kind */
+static double bessel_i0(double x)
+{
+  double sum = 1.0;
+  double term = 1.0;
+  double k;
+  for (k = 1.0; term > (sum * 1e-12); k += 1.0)
+    {
+      double t = x / (2.0 * k);
+      term *= t * t;
+      sum += term;
+    }
+  return sum;
+}
+
+/*
+ * Compute polyphase filter table for the current conversion ratio.
+ *
+ * The prototype is a Kaiser windowed sinc low-pass filter
+ * of up * RESAMPLER_TAPS length. Every phase is stored
+ * in reversed order, so it may be applied directly
+ * to the history window. Each phase is normalized
+ * to unity gain separately.
+ */
+static void design_filter(resampler_t *resampler)
+{
+  unsigned int up = resampler->up;
+  double center = (double)(up * RESAMPLER_TAPS) / 2.0;
+  double cutoff = CUTOFF / (2.0 * ((up > resampler->down) ? up : resampler->down));
+  double norm = bessel_i0(KAISER_BETA);
+  unsigned int p, k;
+
+  for (p = 0; p < up; p++)
+    {
+      double row[RESAMPLER_TAPS];
+      double sum = 0.0;
+      int16_t *coefs = resampler->filter[p];
+      int total = 0;
+      unsigned int peak = 0;
+
+      for (k = 0; k < RESAMPLER_TAPS; k++)
+        {
+          double x = (double)(p + (RESAMPLER_TAPS - 1 - k) * up) - center;
+          double t = x / center;
+          double h = (x != 0.0) ? (sin(2.0 * PI * cutoff * x) / (PI * x)) : (2.0 * cutoff);
+          row[k] = h * bessel_i0(KAISER_BETA * sqrt(1.0 - t * t)) / norm;
+          sum += row[k];
+        }
+      for (k = 0; k < RESAMPLER_TAPS; k++)
+        {
+          coefs[k] = (int16_t)rint(row[k] * UNITY / sum);
+          total += coefs[k];
+          if (abs(coefs[k]) > abs(coefs[peak]))
+            peak = k;
+        }
+      coefs[peak] += UNITY - total;
+    }
+}
+
+/*
+ * Put next native sample into the history window
+ * and compute all output samples that become available.
+ */
+static void push(resampler_t *resampler, int16_t sample)
+{
+  resampler->history[resampler->pos] = sample;
+  resampler->history[resampler->pos + RESAMPLER_TAPS] = sample;
+  resampler->pos = (resampler->pos + 1) & (RESAMPLER_TAPS - 1);
+  resampler->ready = 0;
+  resampler->count = 0;
+  if (--(resampler->skip))
+    return;
+  do
+    {
+      const int16_t *window = resampler->history + resampler->pos;
+      const int16_t *coefs = resampler->filter[resampler->phase];
+      int32_t acc = 0;
+      unsigned int k;
+      for (k = 0; k < RESAMPLER_TAPS; k++)
+        acc += (int32_t)coefs[k] * window[k];
+      resampler->output[resampler->count++] = acc;
+      resampler->phase += resampler->down;
+      resampler->skip = resampler->phase / resampler->up;
+      resampler->phase -= resampler->skip * resampler->up;
+    }
+  while (!resampler->skip);
+}
+
+/* Store computed value at specified position in specified format */
+static void store(void *buffer, size_t n, int format, int32_t value)
+{
+  switch (format)
+    {
+    case SAMPLE_FORMAT_S16_LE:
+      {
+        uint8_t *frame = (uint8_t *)buffer + (n << 1);
+        value = (value + (1 << (UNITY_SHIFT - 9))) >> (UNITY_SHIFT - 8);
+        if (value > INT16_MAX)
+          value = INT16_MAX;
+        else if (value < INT16_MIN)
+          value = INT16_MIN;
+        frame[0] = (uint8_t)(value & 0xFF);
+        frame[1] = (uint8_t)((value >> 8) & 0xFF);
+      }
+      break;
+    case SAMPLE_FORMAT_F32:
+      {
+        float sample = ((float)value) / (128.0f * UNITY);
+        if (sample > 1.0f)
+          sample = 1.0f;
+        else if (sample < -1.0f)
+          sample = -1.0f;
+        memcpy((uint8_t *)buffer + (n << 2), &sample, sizeof(float));
+      }
+      break;
+    default:
+      value = (value + (UNITY >> 1)) >> UNITY_SHIFT;
+      if (value > INT8_MAX)
+        value = INT8_MAX;
+      else if (value < INT8_MIN)
+        value = INT8_MIN;
+      ((int8_t *)buffer)[n] = (int8_t)value;
+      break;
+    }
+}
+
+
+/* Global entry points */
+
+/* Check if specified output sample rate is supported */
+int resampler_supported(int rate)
+{
+  return (rate >= MIN_SAMPLE_RATE) && (rate <= MAX_SAMPLE_RATE) &&
+    ((rate / gcd(rate, NATIVE_SAMPLE_RATE)) <= RESAMPLER_MAX_PHASES);
+}
+
+/*
+ * Prepare resampler for a new sound stream of specified
+ * output sample rate.
+ *
+ * Returns non-zero value if the rate is not supported.
+ * The resampler is left inactive in this case.
+ */
+int resampler_setup(resampler_t *resampler, int rate)
+{
+  if (!resampler_supported(rate))
+    {
+      resampler->rate = 0;
+      resampler->active = 0;
+      return 1;
+    }
+  if (rate != resampler->rate)
+    {
+      unsigned int divisor = gcd(rate, NATIVE_SAMPLE_RATE);
+      resampler->rate = rate;
+      resampler->up = rate / divisor;
+      resampler->down = NATIVE_SAMPLE_RATE / divisor;
+      resampler->active = rate != NATIVE_SAMPLE_RATE;
+      if (resampler->active)
+        design_filter(resampler);
+    }
+
+  /* Output sample is centered in the history window */
+  resampler->phase = 0;
+  resampler->skip = (RESAMPLER_TAPS >> 1) + 1;
+  resampler->tail = 0;
+  resampler->pos = 0;
+  resampler->ready = 0;
+  resampler->count = 0;
+  memset(resampler->history, 0, sizeof(resampler->history));
+  return 0;
+}
+
+/*
+ * Mark the end of the sound stream, so the rest of it
+ * delayed by the filter will be passed out.
+ */
+void resampler_finish(resampler_t *resampler)
+{
+  if (resampler->active)
+    resampler->tail = RESAMPLER_TAPS >> 1;
+}
+
+/*
+ * Convert native samples to the output sample rate and format.
+ *
+ * The input sample count is pointed by the third argument.
+ * It is replaced by the number of actually consumed samples.
+ * Output buffer size is specified in samples.
+ *
+ * Returns number of stored samples. The value less than
+ * the output buffer size means that all the input is consumed.
+ */
+size_t resample(resampler_t *resampler, const int8_t *input, size_t *length,
+                void *buffer, size_t size, int format)
+{
+  size_t i = 0;
+  size_t n = 0;
+
+  while (n < size)
+    if (resampler->ready < resampler->count)
+      store(buffer, n++, format, resampler->output[resampler->ready++]);
+    else if (i < *length)
+      push(resampler, input[i++]);
+    else if (resampler->tail)
+      {
+        resampler->tail--;
+        push(resampler, 0);
+      }
+    else break;
+
+  *length = i;
+  return n;
+}
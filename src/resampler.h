@@ -0,0 +1,90 @@
+/* resampler.h -- Output sample rate conversion interface
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef RU_TTS_RESAMPLER_H
+#define RU_TTS_RESAMPLER_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+
+/* Sample rate of the generated sound stream */
+#define NATIVE_SAMPLE_RATE 10000
+
+/* Supported output sample rate range */
+#define MIN_SAMPLE_RATE 8000
+#define MAX_SAMPLE_RATE 96000
+
+/* Maximum number of filter phases (interpolation factor) */
+#define RESAMPLER_MAX_PHASES 441
+
+/* Number of filter taps per phase (must be a power of 2) */
+#define RESAMPLER_TAPS 32
+
+/* Maximum number of output samples per one input sample */
+#define RESAMPLER_MAX_BURST (MAX_SAMPLE_RATE / NATIVE_SAMPLE_RATE + 1)
+
+
+/*
+ * Streaming polyphase resampler state.
+ *
+ * The filter table is computed only when the sample rate
+ * is changed, so it is reused from transfer to transfer.
+ */
+typedef struct
+{
+  int rate; /* Output sample rate, 0 when the table is not computed */
+  int active; /* Non-zero when conversion is really needed */
+  unsigned int up; /* Interpolation factor */
+  unsigned int down; /* Decimation factor */
+  unsigned int phase;
+  unsigned int skip; /* Input samples to take before the next output */
+  unsigned int tail; /* Trailing silence samples to push */
+  unsigned int pos;
+  unsigned int ready;
+  unsigned int count;
+  int32_t output[RESAMPLER_MAX_BURST];
+  int16_t history[2 * RESAMPLER_TAPS];
+  int16_t filter[RESAMPLER_MAX_PHASES][RESAMPLER_TAPS];
+} resampler_t;
+
+
+/*
+ * Prepare resampler for a new sound stream of specified
+ * output sample rate.
+ *
+ * Returns non-zero value if the rate is not supported.
+ * The resampler is left inactive in this case.
+ */
+extern int resampler_setup(resampler_t *resampler, int rate);
+
+/* Check if specified output sample rate is supported */
+extern int resampler_supported(int rate);
+
+/*
+ * Mark the end of the sound stream, so the rest of it
+ * delayed by the filter will be passed out.
+ */
+extern void resampler_finish(resampler_t *resampler);
+
+/*
+ * Convert native samples to the output sample rate and format.
+ *
+ * The input sample count is pointed by the third argument.
+ * It is replaced by the number of actually consumed samples.
+ * Output buffer size is specified in samples.
+ *
+ * Returns number of stored samples. The value less than
+ * the output buffer size means that all the input is consumed.
+ */
+extern size_t resample(resampler_t *resampler, const int8_t *input, size_t *length,
+                       void *buffer, size_t size, int format);
+
+#endif
@@ -0,0 +1,309 @@
+/* ring.c -- Lock-free ring buffer for real-time playback
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#include "ru_tts.h"
+#include "soundscript.h"
+#include "engine.h"
+
+
+/* Local macros */
+
+/* Assumed cache line size */
+#define CACHE_LINE 64
+
+/* Blocked producer polling interval in milliseconds */
+#define RING_POLL_INTERVAL 2
+
+/* The largest sample size */
+#define MAX_FRAME 4
+
+/*
+ * Ring buffer indices and flags shared between threads.
+ *
+ * Data stored before releasing an index or a flag must be seen
+ * by the other thread after acquiring it, so plain volatile
+ * variables are not enough on weakly ordered processors.
+ */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+typedef atomic_size_t ring_index_t;
+typedef atomic_int ring_flag_t;
+#define LOAD_SHARED(var) atomic_load_explicit(&(var), memory_order_acquire)
+#define STORE_SHARED(var, value) atomic_store_explicit(&(var), (value), memory_order_release)
+#elif defined(__ATOMIC_ACQUIRE)
+typedef size_t ring_index_t;
+typedef int ring_flag_t;
+#define LOAD_SHARED(var) __atomic_load_n(&(var), __ATOMIC_ACQUIRE)
+#define STORE_SHARED(var, value) __atomic_store_n(&(var), (value), __ATOMIC_RELEASE)
+#else
+#error "Ring buffer requires C11 atomics or compatible compiler builtins"
+#endif
+
+
+/* Ring buffer structure */
+struct ru_tts_ring
+{
+  /* Constant after creation */
+  size_t size;
+  int policy;
+  char pad0[CACHE_LINE];
+
+  /* Read position, written by the consumer only */
+  ring_index_t head;
+  char pad1[CACHE_LINE];
+
+  /* Write position, written by the producer only */
+  ring_index_t tail;
+  char pad2[CACHE_LINE];
+
+  /* State flags */
+  ring_flag_t finished;
+  ring_flag_t closed;
+  char pad3[CACHE_LINE];
+
+  uint8_t data[];
+};
+
+
+/* Local subroutines */
+
+/* Let the blocked producer wait for the consumer */
+static void ring_wait(void)
+{
+#if defined(_WIN32) || defined(_WIN64)
+  Sleep(RING_POLL_INTERVAL);
+#else
+  struct timespec interval = { 0, RING_POLL_INTERVAL * 1000000L };
+  nanosleep(&interval, NULL);
+#endif
+}
+
+/*
+ * Get contiguous free room in the ring buffer of at least specified
+ * size or up to the buffer end waiting for the consumer if allowed.
+ * Returns zero when the ring is closed or is full and the producer
+ * should not wait.
+ */
+static size_t ring_room(ru_tts_ring_t *ring, size_t *offset, size_t needed, int wait)
+{
+  size_t tail = ring->tail;
+  size_t start = tail & (ring->size - 1);
+  size_t contiguous = ring->size - start;
+
+  if (needed > contiguous)
+    needed = contiguous;
+  while (!LOAD_SHARED(ring->closed))
+    {
+      size_t room = ring->size - (tail - LOAD_SHARED(ring->head));
+      if (room > contiguous)
+        room = contiguous;
+      if (room >= needed)
+        {
+          *offset = start;
+          return room;
+        }
+      if (!wait)
+        break;
+      ring_wait();
+    }
+  return 0;
+}
+
+
+/* Global entry points */
+
+/*
+ * Create new ring buffer of at least specified size in bytes.
+ *
+ * Returns NULL when memory allocation fails.
+ */
+RUTTS_EXPORT ru_tts_ring_t *ru_tts_ring_new(size_t size, int policy)
+{
+  ru_tts_ring_t *ring;
+  size_t capacity = CACHE_LINE;
+
+  while (capacity < size)
+    {
+      capacity <<= 1;
+      if (!capacity)
+        return NULL;
+    }
+  ring = malloc(sizeof(ru_tts_ring_t) + capacity);
+  if (ring)
+    {
+      ring->size = capacity;
+      ring->policy = policy;
+      ring->head = 0;
+      ring->tail = 0;
+      ring->finished = 0;
+      ring->closed = 0;
+    }
+  return ring;
+}
+
+/*
+ * Destroy ring buffer.
+ */
+RUTTS_EXPORT void ru_tts_ring_free(ru_tts_ring_t *ring)
+{
+  free(ring);
+}
+
+/*
+ * Put generated sound into the ring buffer.
+ *
+ * This function may be used as a callback for speech synthesis
+ * with the ring buffer passed as user data. It waits for the consumer
+ * when the ring is full regardless of the policy, since the sound
+ * passed to a callback cannot be taken later.
+ */
+RUTTS_EXPORT int ru_tts_ring_write(void *buffer, size_t size, void *user_data)
+{
+  ru_tts_ring_t *ring = user_data;
+  const uint8_t *data = buffer;
+
+  while (size)
+    {
+      size_t offset;
+      size_t n = ring_room(ring, &offset, 1, 1);
+      if (!n)
+        return 1;
+      if (n > size)
+        n = size;
+      memcpy(ring->data + offset, data, n);
+      STORE_SHARED(ring->tail, ring->tail + n);
+      data += n;
+      size -= n;
+    }
+  return 0;
+}
+
+/*
+ * Lend free room of the ring buffer for direct sound rendering.
+ *
+ * This function and ru_tts_ring_commit() may be used as callbacks
+ * for ru_tts_engine_transfer_direct() with the ring buffer
+ * passed as user data.
+ */
+RUTTS_EXPORT void *ru_tts_ring_get_buffer(void *user_data, size_t *size)
+{
+  ru_tts_ring_t *ring = user_data;
+  size_t offset;
+
+  /* Room for at least one whole sample */
+  *size = ring_room(ring, &offset, MAX_FRAME, 1);
+  return *size ? (ring->data + offset) : NULL;
+}
+
+/*
+ * Make the sound rendered in the lent room available to the consumer.
+ */
+RUTTS_EXPORT int ru_tts_ring_commit(void *user_data, size_t size)
+{
+  ru_tts_ring_t *ring = user_data;
+  STORE_SHARED(ring->tail, ring->tail + size);
+  return LOAD_SHARED(ring->closed);
+}
+
+/*
+ * Pull the speech prepared by ru_tts_read_begin() into the free room
+ * of the ring buffer without waiting for the consumer.
+ *
+ * Returns non-zero value while the speech is not over. In this case
+ * the ring is full and the call should be repeated later. Otherwise
+ * the ring is marked finished.
+ */
+RUTTS_EXPORT int ru_tts_ring_fill(ru_tts_ring_t *ring, ru_tts_engine_t *engine)
+{
+  size_t frame = sample_size(engine->ttscb.sample_format);
+  size_t offset;
+  size_t room;
+
+  while ((room = ring_room(ring, &offset, frame, ring->policy != RING_NONBLOCK)) >= frame)
+    {
+      size_t nsamples = room / frame;
+      size_t n = ru_tts_read(engine, ring->data + offset, nsamples);
+      STORE_SHARED(ring->tail, ring->tail + n * frame);
+      if (n < nsamples)
+        {
+          ru_tts_ring_finish(ring);
+          return 0;
+        }
+    }
+
+  if (LOAD_SHARED(ring->closed))
+    {
+      ru_tts_cancel(engine);
+      return 0;
+    }
+  return 1;
+}
+
+/*
+ * Mark the end of the sound stream written to the ring buffer.
+ */
+RUTTS_EXPORT void ru_tts_ring_finish(ru_tts_ring_t *ring)
+{
+  STORE_SHARED(ring->finished, 1);
+}
+
+/*
+ * Take up to specified number of bytes from the ring buffer.
+ *
+ * This function never blocks, so it may be called directly
+ * from a real-time audio callback.
+ *
+ * Returns number of bytes actually stored in the buffer.
+ */
+RUTTS_EXPORT size_t ru_tts_ring_read(ru_tts_ring_t *ring, void *buffer, size_t size)
+{
+  size_t head = ring->head;
+  size_t available = LOAD_SHARED(ring->tail) - head;
+  size_t start = head & (ring->size - 1);
+  size_t n;
+
+  if (size > available)
+    size = available;
+  n = ring->size - start;
+  if (n > size)
+    n = size;
+  memcpy(buffer, ring->data + start, n);
+  memcpy((uint8_t *)buffer + n, ring->data, size - n);
+  STORE_SHARED(ring->head, head + size);
+  return size;
+}
+
+/*
+ * Check if the sound stream is over and the ring buffer is empty.
+ */
+RUTTS_EXPORT int ru_tts_ring_finished(ru_tts_ring_t *ring)
+{
+  return LOAD_SHARED(ring->finished) && (LOAD_SHARED(ring->tail) == ring->head);
+}
+
+/*
+ * Stop accepting sound by the ring buffer.
+ *
+ * The producer is released if blocked and the speech
+ * synthesis writing to the ring buffer is stopped.
+ */
+RUTTS_EXPORT void ru_tts_ring_close(ru_tts_ring_t *ring)
+{
+  STORE_SHARED(ring->closed, 1);
+}
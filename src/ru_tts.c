@@ -31,6 +31,7 @@
 #endif
 
 #include "ru_tts.h"
+#include "unicode.h"
 
 #define WAVE_SIZE 4096
 
@@ -105,6 +106,9 @@ static const char *help_msg =
   "-d- -- Disable decimal separators treating.\n\n"
 
   "Other options:\n"
+  "-f format -- Output sample format: s8 (default), s16 or f32.\n"
+  "-o rate -- Output sample rate in Hz (10000 by default).\n"
+  "-u -- Input text is in UTF-8 (koi8-r by default).\n"
 #ifndef WITHOUT_DICTIONARY
   "-s path -- Pronunciation dictionary location.\n"
   "-l path -- Log unknown words in specified file\n"
@@ -164,6 +168,32 @@ static int getval(const char *s)
   return rint(value * 100.0);
 }
 
+#ifndef WITHOUT_DICTIONARY
+/*
+ * Recode UTF-8 text to koi8-r in place for dictionary search
+ * using the same character mapping as the library does.
+ */
+static void recode_utf8(char *text)
+{
+  const unsigned char *s = (const unsigned char *) text;
+  const unsigned char *end = s + strlen(text);
+  unsigned char *t = (unsigned char *) text;
+
+  while (s < end)
+    if (*s < 0x80)
+      *t++ = *s++;
+    else
+      {
+        size_t length;
+        uint32_t code = utf8_decode(s, end - s, &length);
+        s += length;
+        if (code)
+          t += unicode_koi8(code, t);
+      }
+  *t = 0;
+}
+#endif
+
 static void usage(const char* name)
 {
   fprintf(stderr, "Usage:\n");
@@ -177,14 +207,16 @@ int main(int argc, char **argv)
   int write_error;
   char c, *s, *text, *input = NULL;
   void *wave;
+  ru_tts_engine_t *engine;
 #ifndef WITHOUT_DICTIONARY
   FILE *slog = NULL;
   RULEXDB *db = NULL;
+  int recode = 0;
 #endif
   ru_tts_conf_t ru_tts_config;
 
   ru_tts_config_init(&ru_tts_config);
-  while ((c = getopt(argc, argv, "s:l:r:p:g:e:d:ahv")) != -1)
+  while ((c = getopt(argc, argv, "s:l:r:p:g:e:d:f:o:auhv")) != -1)
     {
       switch (c)
         {
@@ -209,6 +241,9 @@ int main(int argc, char **argv)
           case 'a':
             ru_tts_config.flags |= USE_ALTERNATIVE_VOICE;
             break;
+          case 'u':
+            ru_tts_config.flags |= INPUT_UTF8;
+            break;
           case 'r':
             ru_tts_config.speech_rate = getval(optarg);
             break;
@@ -265,6 +300,40 @@ int main(int argc, char **argv)
                 return EXIT_FAILURE;
               }
             break;
+          case 'f':
+            if (!strcmp(optarg, "s8"))
+              ru_tts_config.sample_format = SAMPLE_FORMAT_S8;
+            else if (!strcmp(optarg, "s16"))
+              ru_tts_config.sample_format = SAMPLE_FORMAT_S16_LE;
+            else if (!strcmp(optarg, "f32"))
+              ru_tts_config.sample_format = SAMPLE_FORMAT_F32;
+            else
+              {
+                fprintf(stderr, "Invalid output format \"%s\"\n\n", optarg);
+                usage(argv[0]);
+                return EXIT_FAILURE;
+              }
+            break;
+          case 'o':
+            {
+              ru_tts_compiled_conf_t *compiled = NULL;
+              char *t;
+              long rate = strtol(optarg, &t, 10);
+              if ((t != optarg) && !*t && (rate >= 8000) && (rate <= 96000))
+                {
+                  /* Let the library check if the rate is supported */
+                  ru_tts_config.sample_rate = (int)rate;
+                  compiled = ru_tts_config_compile(&ru_tts_config);
+                }
+              if (!compiled)
+                {
+                  fprintf(stderr, "Invalid output sample rate \"%s\"\n\n", optarg);
+                  usage(argv[0]);
+                  return EXIT_FAILURE;
+                }
+              ru_tts_compiled_conf_free(compiled);
+            }
+            break;
           case 'h':
             usage(argv[0]);
             return EXIT_SUCCESS;
@@ -289,6 +358,12 @@ int main(int argc, char **argv)
               if (!slog) perror(input);
             }
           alphabet = symbols + 2;
+          if (ru_tts_config.flags & INPUT_UTF8)
+            {
+              /* Dictionary is searched in koi8-r */
+              recode = 1;
+              ru_tts_config.flags &= ~INPUT_UTF8;
+            }
         }
       else
         {
@@ -308,6 +383,12 @@ int main(int argc, char **argv)
 #endif
 
   /* doing tts in the loop */
+  engine = ru_tts_engine_new();
+  if (!engine)
+    {
+      perror("Memory allocation error");
+      return EXIT_FAILURE;
+    }
   wave = xmalloc(WAVE_SIZE);
   text = xmalloc(size);
   s = text;
@@ -327,9 +408,12 @@ int main(int argc, char **argv)
 #ifndef WITHOUT_DICTIONARY
           if (db)
             {
-              char *stressed = xmalloc(strlen(text) << 1);
+              char *stressed;
               char *t;
               unsigned int n;
+              if (recode)
+                recode_utf8(text);
+              stressed = xmalloc(strlen(text) << 1);
               for (s = text; *s; s++)
                 if (isupper(*s))
                   *s = tolower(*s);
@@ -365,12 +449,12 @@ int main(int argc, char **argv)
                     }
                 }
               *t = 0;
-              ru_tts_transfer(&ru_tts_config, stressed, wave, WAVE_SIZE, wave_consumer, &write_error);
+              ru_tts_engine_transfer(engine, &ru_tts_config, stressed, wave, WAVE_SIZE, wave_consumer, &write_error);
               free(stressed);
             }
           else
 #endif
-            ru_tts_transfer(&ru_tts_config, text, wave, WAVE_SIZE, wave_consumer, &write_error);
+            ru_tts_engine_transfer(engine, &ru_tts_config, text, wave, WAVE_SIZE, wave_consumer, &write_error);
           if (write_error)
             break;
           s = text;
@@ -394,6 +478,7 @@ int main(int argc, char **argv)
 #endif
 #endif
 
+  ru_tts_engine_free(engine);
   free(text);
   free(wave);
   return write_error ? EXIT_FAILURE : EXIT_SUCCESS;
@@ -24,6 +24,18 @@
 #define DEC_SEP_POINT 1 /* Use point as a decimal separator */
 #define DEC_SEP_COMMA 2 /* Use comma as a decimal separator */
 #define USE_ALTERNATIVE_VOICE 4
+#define COALESCE_CLAUSES 8 /* Pass sound of short clauses together */
+#define INPUT_UTF8 16 /* Input text is in UTF-8 instead of koi8-r */
+
+/* Output sample formats */
+#define SAMPLE_FORMAT_S8 0 /* Signed 8-bit (default) */
+#define SAMPLE_FORMAT_S16_LE 1 /* Signed 16-bit little endian */
+#define SAMPLE_FORMAT_F32 2 /* 32-bit float in the range [-1..1] */
+
+
+/* Ring buffer producer policies */
+#define RING_BLOCK 0 /* Wait until the consumer frees enough room */
+#define RING_NONBLOCK 1 /* Leave the sound that does not fit for the next fill */
 
 
 /* BEGIN_C_DECLS should be used at the beginning of C declarations,
@@ -44,6 +56,30 @@ BEGIN_C_DECLS
 /* Callback function to utilize generated sound */
 typedef int (*ru_tts_callback)(void *buffer, size_t size, void *user_data);
 
+/*
+ * Callback function lending a buffer for generated sound.
+ * It should store the buffer size in bytes by the second argument.
+ * NULL return value causes immediate speech termination.
+ */
+typedef void *(*ru_tts_get_buffer_callback)(void *user_data, size_t *size);
+
+/*
+ * Callback function accepting specified number of bytes stored
+ * at the beginning of the last lent buffer. The buffer is returned
+ * to the consumer afterwards and is not used by the library anymore.
+ * Non-zero return value causes immediate speech termination.
+ */
+typedef int (*ru_tts_commit_callback)(void *user_data, size_t size);
+
+/* Opaque synthesis engine holding reusable working buffers */
+typedef struct ru_tts_engine ru_tts_engine_t;
+
+/* Opaque lock-free single producer single consumer ring buffer */
+typedef struct ru_tts_ring ru_tts_ring_t;
+
+/* Opaque immutable configuration prepared for synthesis */
+typedef struct ru_tts_compiled_conf ru_tts_compiled_conf_t;
+
 /* Speech parameters */
 typedef struct
 {
@@ -67,6 +103,19 @@ typedef struct
 
   /* Combination of TTS control flags */
   int flags;
+
+  /* One of the output sample formats */
+  int sample_format;
+
+  /* Output sample rate in Hz. Native rate is 10000. Other standard
+     rates in the range [8000..96000] are produced by resampling.
+     No speech is produced for unsupported values. */
+  int sample_rate;
+
+  /* Duration of the first sound chunk passed to the consumer
+     in milliseconds. Each next chunk is twice as long until
+     they fill the whole buffer. Zero means whole buffer chunks. */
+  int first_chunk;
 } ru_tts_conf_t;
 
 /*
@@ -74,12 +123,34 @@ typedef struct
  */
 extern RUTTS_EXPORT void ru_tts_config_init(ru_tts_conf_t *config);
 
+/*
+ * Compile configuration for repeated use.
+ *
+ * All speech parameters are converted once into the tables
+ * used by the synthesizer directly, so transfers with compiled
+ * configuration skip this preparation. The configuration structure
+ * is not referenced afterwards. Compiled configuration is never
+ * changed, so it may be shared by any number of engines working
+ * simultaneously in different threads. It must remain available
+ * until all the speech produced with it is over.
+ *
+ * Returns NULL when the sample rate is not supported
+ * or memory allocation fails.
+ */
+extern RUTTS_EXPORT ru_tts_compiled_conf_t *ru_tts_config_compile(const ru_tts_conf_t *config);
+
+/*
+ * Destroy compiled configuration.
+ */
+extern RUTTS_EXPORT void ru_tts_compiled_conf_free(ru_tts_compiled_conf_t *compiled);
+
 /*
  * Perform TTS transformation for specified text.
  *
  * The first argument points to a configuration structure.
  * The second argument points to a zero-terminated string to transfer.
- * This string must contain a Russian text in koi8-r.
+ * This string must contain a Russian text in koi8-r
+ * or in UTF-8 when INPUT_UTF8 flag is set.
  * The next two arguments specify a buffer that will be used
  * by the library for delivering produced wave data
  * chunk by chunk to the consumer specified by the fourth argument.
@@ -90,6 +161,301 @@ extern RUTTS_EXPORT void ru_tts_transfer(const ru_tts_conf_t *config,
                                          const char *text, void *wave_buffer, size_t wave_buffer_size,
                                          ru_tts_callback wave_consumer, void *user_data);
 
+/*
+ * Perform TTS transformation for the text of specified length.
+ *
+ * The text is not required to be zero-terminated. It is processed
+ * piece by piece and never copied as a whole, so memory usage
+ * does not depend on the text size. Thus, it can be taken directly
+ * from a memory mapped file. All other arguments have the same meaning
+ * as for ru_tts_transfer().
+ */
+extern RUTTS_EXPORT void ru_tts_transfer_n(const ru_tts_conf_t *config,
+                                           const char *text, size_t length,
+                                           void *wave_buffer, size_t wave_buffer_size,
+                                           ru_tts_callback wave_consumer, void *user_data);
+
+/*
+ * Create new synthesis engine.
+ *
+ * The engine owns all working buffers needed for speech synthesis,
+ * so transfers performed by the engine do not allocate memory.
+ * An engine must not be used by several threads simultaneously.
+ *
+ * Returns NULL when memory allocation fails.
+ */
+extern RUTTS_EXPORT ru_tts_engine_t *ru_tts_engine_new(void);
+
+/*
+ * Destroy synthesis engine and release all its resources.
+ */
+extern RUTTS_EXPORT void ru_tts_engine_free(ru_tts_engine_t *engine);
+
+/*
+ * Set the number of words whose transcriptions are kept
+ * by specified engine for reuse.
+ *
+ * Repeated words are not transcribed anew in the same context,
+ * that is helpful when the same prompts are spoken again and again.
+ * The speech is not affected in any way. The number is rounded up
+ * to a power of 2. Zero value disables the cache (default).
+ * It must not be called during a transfer.
+ *
+ * Returns non-zero value when memory allocation fails.
+ * The cache is disabled in this case.
+ */
+extern RUTTS_EXPORT int ru_tts_engine_word_cache(ru_tts_engine_t *engine, size_t size);
+
+/*
+ * Get word cache statistics of specified engine.
+ *
+ * The numbers of words taken from the cache and those transcribed
+ * anew are stored in the variables pointed by the last two arguments.
+ * Both are zero when the cache is disabled. The counters are reset
+ * when the cache size is set.
+ */
+extern RUTTS_EXPORT void ru_tts_engine_word_cache_stats(ru_tts_engine_t *engine,
+                                                        unsigned long *hits, unsigned long *misses);
+
+/*
+ * Perform TTS transformation for specified text by specified engine.
+ *
+ * The first argument points to the engine created by ru_tts_engine_new().
+ * All other arguments have the same meaning as for ru_tts_transfer().
+ */
+extern RUTTS_EXPORT void ru_tts_engine_transfer(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                                                const char *text, void *wave_buffer, size_t wave_buffer_size,
+                                                ru_tts_callback wave_consumer, void *user_data);
+
+/*
+ * Perform TTS transformation for the text of specified length
+ * by specified engine. See ru_tts_transfer_n() for details.
+ */
+extern RUTTS_EXPORT void ru_tts_engine_transfer_n(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                                                  const char *text, size_t length,
+                                                  void *wave_buffer, size_t wave_buffer_size,
+                                                  ru_tts_callback wave_consumer, void *user_data);
+
+/*
+ * Perform TTS transformation for the text of specified length
+ * by specified engine with compiled configuration.
+ * See ru_tts_engine_transfer_n() for details.
+ */
+extern RUTTS_EXPORT void ru_tts_engine_transfer_compiled(ru_tts_engine_t *engine, const ru_tts_compiled_conf_t *config,
+                                                         const char *text, size_t length,
+                                                         void *wave_buffer, size_t wave_buffer_size,
+                                                         ru_tts_callback wave_consumer, void *user_data);
+
+/*
+ * Start incremental text streaming by specified engine.
+ *
+ * The text is then passed chunk by chunk via ru_tts_stream_push()
+ * and the stream is finally closed by ru_tts_stream_finish().
+ * All arguments have the same meaning as for ru_tts_engine_transfer().
+ */
+extern RUTTS_EXPORT void ru_tts_stream_begin(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                                             void *wave_buffer, size_t wave_buffer_size,
+                                             ru_tts_callback wave_consumer, void *user_data);
+
+/*
+ * Start incremental text streaming by specified engine
+ * with compiled configuration. See ru_tts_stream_begin() for details.
+ */
+extern RUTTS_EXPORT void ru_tts_stream_begin_compiled(ru_tts_engine_t *engine, const ru_tts_compiled_conf_t *config,
+                                                      void *wave_buffer, size_t wave_buffer_size,
+                                                      ru_tts_callback wave_consumer, void *user_data);
+
+/*
+ * Perform TTS transformation for the text of specified length
+ * by specified engine rendering sound directly into the buffers
+ * lent by the consumer.
+ *
+ * Every buffer obtained by the get_buffer callback is passed back
+ * by the commit callback, even if nothing has been stored in it
+ * because of the speech termination. Thus, the consumer can lend
+ * ring buffer slots, memory mapped file pages or shared memory
+ * segments and get the sound there without further copying.
+ * Only whole samples are stored, so a lent buffer must be able
+ * to hold at least one of them.
+ */
+extern RUTTS_EXPORT void ru_tts_engine_transfer_direct(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                                                       const char *text, size_t length,
+                                                       ru_tts_get_buffer_callback get_buffer,
+                                                       ru_tts_commit_callback commit, void *user_data);
+
+/*
+ * Perform TTS transformation for the text of specified length
+ * by specified engine with compiled configuration rendering sound
+ * directly into the buffers lent by the consumer.
+ * See ru_tts_engine_transfer_direct() for details.
+ */
+extern RUTTS_EXPORT void ru_tts_engine_transfer_direct_compiled(ru_tts_engine_t *engine, const ru_tts_compiled_conf_t *config,
+                                                                const char *text, size_t length,
+                                                                ru_tts_get_buffer_callback get_buffer,
+                                                                ru_tts_commit_callback commit, void *user_data);
+
+/*
+ * Start incremental text streaming by specified engine
+ * rendering sound directly into the buffers lent by the consumer.
+ *
+ * See ru_tts_engine_transfer_direct() for the callbacks meaning.
+ */
+extern RUTTS_EXPORT void ru_tts_stream_begin_direct(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                                                    ru_tts_get_buffer_callback get_buffer,
+                                                    ru_tts_commit_callback commit, void *user_data);
+
+/*
+ * Start incremental text streaming by specified engine
+ * with compiled configuration rendering sound directly
+ * into the buffers lent by the consumer.
+ */
+extern RUTTS_EXPORT void ru_tts_stream_begin_direct_compiled(ru_tts_engine_t *engine, const ru_tts_compiled_conf_t *config,
+                                                             ru_tts_get_buffer_callback get_buffer,
+                                                             ru_tts_commit_callback commit, void *user_data);
+
+/*
+ * Push next text chunk of specified length to the stream.
+ *
+ * The text is buffered and every clause is synthesized as soon
+ * as its terminating punctuation followed by a blank arrives
+ * together with the first character of the next clause.
+ * A clause too long for the buffer is synthesized gradually
+ * as its text arrives, but it still sounds the same.
+ * Chunk boundaries may fall anywhere, even inside a word.
+ *
+ * Returns non-zero value when the stream is not started
+ * or is stopped by the consumer.
+ */
+extern RUTTS_EXPORT int ru_tts_stream_push(ru_tts_engine_t *engine, const char *chunk, size_t length);
+
+/*
+ * Synthesize the rest of streamed text and close the stream.
+ *
+ * Returns non-zero value when the stream is not started
+ * or is stopped by the consumer.
+ */
+extern RUTTS_EXPORT int ru_tts_stream_finish(ru_tts_engine_t *engine);
+
+/*
+ * Prepare specified engine for pulling speech for the text
+ * of specified length via ru_tts_read().
+ *
+ * The text is not copied, so it must remain available
+ * until the speech is over.
+ */
+extern RUTTS_EXPORT void ru_tts_read_begin(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                                           const char *text, size_t length);
+
+/*
+ * Prepare specified engine for pulling speech with compiled
+ * configuration for the text of specified length via ru_tts_read().
+ */
+extern RUTTS_EXPORT void ru_tts_read_begin_compiled(ru_tts_engine_t *engine, const ru_tts_compiled_conf_t *config,
+                                                    const char *text, size_t length);
+
+/*
+ * Get next portion of speech for the text specified by ru_tts_read_begin().
+ *
+ * Synthesis resumes exactly where it has been stopped by the previous call
+ * and proceeds only as far as needed to fill the buffer with specified
+ * number of samples. No memory is allocated here, so this function
+ * may be called directly from a real-time audio callback.
+ *
+ * Returns number of samples stored in the buffer. The value less than
+ * requested means that the speech is over.
+ */
+extern RUTTS_EXPORT size_t ru_tts_read(ru_tts_engine_t *engine, void *buffer, size_t nsamples);
+
+/*
+ * Cancel speech synthesis currently performed by specified engine.
+ *
+ * This function may be called from any thread or signal handler.
+ * The synthesis stops as soon as possible without passing
+ * any more data to the consumer. Pulled speech is finished as well.
+ * Transfers started afterwards are not affected.
+ */
+extern RUTTS_EXPORT void ru_tts_cancel(ru_tts_engine_t *engine);
+
+/*
+ * Create new ring buffer for passing generated sound from the
+ * synthesis thread to the playback one without any locks.
+ *
+ * The size is specified in bytes. It is rounded up to a power of 2.
+ * The policy argument defines behaviour of ru_tts_ring_fill() when
+ * the ring is full. It may be either RING_BLOCK or RING_NONBLOCK.
+ * Sound callbacks always wait for the consumer in this case.
+ *
+ * Returns NULL when memory allocation fails.
+ */
+extern RUTTS_EXPORT ru_tts_ring_t *ru_tts_ring_new(size_t size, int policy);
+
+/*
+ * Destroy ring buffer.
+ */
+extern RUTTS_EXPORT void ru_tts_ring_free(ru_tts_ring_t *ring);
+
+/*
+ * Put generated sound into the ring buffer passed as user data.
+ *
+ * This function may be used as a wave consumer callback
+ * for all transfer and streaming functions.
+ */
+extern RUTTS_EXPORT int ru_tts_ring_write(void *buffer, size_t size, void *user_data);
+
+/*
+ * Lend free room of the ring buffer passed as user data
+ * for direct sound rendering.
+ *
+ * This function and ru_tts_ring_commit() may be used as callbacks
+ * for ru_tts_engine_transfer_direct() and ru_tts_stream_begin_direct().
+ */
+extern RUTTS_EXPORT void *ru_tts_ring_get_buffer(void *user_data, size_t *size);
+
+/*
+ * Make the sound rendered in the lent room available to the consumer.
+ */
+extern RUTTS_EXPORT int ru_tts_ring_commit(void *user_data, size_t size);
+
+/*
+ * Pull the speech prepared by ru_tts_read_begin() into the ring buffer.
+ *
+ * With RING_NONBLOCK policy this function never waits for the consumer.
+ * It returns non-zero value when the ring is full before the speech
+ * is over, so the call should be repeated later. With RING_BLOCK policy
+ * it returns only when the speech is over or the ring is closed.
+ * The ring is marked finished when the speech is over.
+ */
+extern RUTTS_EXPORT int ru_tts_ring_fill(ru_tts_ring_t *ring, ru_tts_engine_t *engine);
+
+/*
+ * Mark the end of the sound stream written to the ring buffer.
+ * It should be called by the producer when the speech is over.
+ */
+extern RUTTS_EXPORT void ru_tts_ring_finish(ru_tts_ring_t *ring);
+
+/*
+ * Take up to specified number of bytes from the ring buffer.
+ *
+ * This function is wait-free, so it may be called directly
+ * from a real-time audio callback.
+ *
+ * Returns number of bytes actually stored in the buffer.
+ */
+extern RUTTS_EXPORT size_t ru_tts_ring_read(ru_tts_ring_t *ring, void *buffer, size_t size);
+
+/*
+ * Check if the sound stream is over and the ring buffer is empty.
+ * Otherwise a short read means an underrun.
+ */
+extern RUTTS_EXPORT int ru_tts_ring_finished(ru_tts_ring_t *ring);
+
+/*
+ * Stop accepting sound by the ring buffer. It may be called
+ * by the consumer to release a blocked producer and stop
+ * the speech synthesis writing to the ring buffer.
+ */
+extern RUTTS_EXPORT void ru_tts_ring_close(ru_tts_ring_t *ring);
+
 END_C_DECLS
 
 #endif
@@ -16,15 +16,43 @@
 #include "sink.h"
 
 
+/* Local subroutines */
+
+/* Get current chunk size limit */
+static size_t chunk_size(sink_t *consumer)
+{
+  return (consumer->chunk && (consumer->chunk < consumer->bufsize)) ?
+    consumer->chunk : consumer->bufsize;
+}
+
+/* Let the next chunk grow toward the whole buffer */
+static void chunk_grow(sink_t *consumer)
+{
+  if (consumer->chunk)
+    {
+      consumer->chunk <<= 1;
+      if (consumer->chunk >= consumer->bufsize)
+        consumer->chunk = 0;
+    }
+}
+
+
+/* Global entry points */
+
 /* Initialize sink control structure */
 void sink_setup(sink_t *consumer, void *buffer, size_t bufsize, ru_tts_callback function, void *user_data)
 {
   consumer->buffer = buffer;
   consumer->buffer_offset = 0;
   consumer->bufsize = bufsize;
+  consumer->chunk = 0;
+  consumer->coalesce = 0;
   consumer->status = 0;
+  consumer->cancel = NULL;
   consumer->user_data = user_data;
   consumer->function = function;
+  consumer->get_buffer = NULL;
+  consumer->commit = NULL;
   consumer->custom_reset = NULL;
 }
 
@@ -41,34 +69,112 @@ void sink_reset(sink_t *consumer)
   else consumer->buffer_offset = 0;
 }
 
-/* Pass data to the sink function */
+/*
+ * Pass data to the sink function.
+ *
+ * When the buffer is lent by the consumer,
+ * it is committed and returned back.
+ */
 void sink_flush(sink_t *consumer)
 {
-  if (consumer->function && consumer->buffer && consumer->buffer_offset)
-    consumer->status |= consumer->function(consumer->buffer, consumer->buffer_offset, consumer->user_data);
+  if (consumer->commit)
+    {
+      if (consumer->buffer)
+        {
+          if (consumer->buffer_offset)
+            chunk_grow(consumer);
+          consumer->status |= consumer->commit(consumer->user_data,
+                                               sink_stopped(consumer) ? 0 : consumer->buffer_offset);
+        }
+      consumer->buffer = NULL;
+      consumer->bufsize = 0;
+    }
+  else if (consumer->function && consumer->buffer && consumer->buffer_offset && !sink_stopped(consumer))
+    {
+      chunk_grow(consumer);
+      consumer->status |= consumer->function(consumer->buffer, consumer->buffer_offset, consumer->user_data);
+    }
   sink_reset(consumer);
 }
 
-/* Pass one byte of data */
-void sink_put(sink_t *consumer, int8_t byte)
+/*
+ * Pass data at the end of a clause. When clauses are coalesced,
+ * the data is kept until the buffer is at least half full.
+ */
+void sink_clause_end(sink_t *consumer)
 {
-  ((int8_t *)(consumer->buffer))[consumer->buffer_offset++] = byte;
-  if (consumer->buffer_offset >= consumer->bufsize)
+  if (!consumer->coalesce || (consumer->buffer_offset >= (chunk_size(consumer) >> 1)))
     sink_flush(consumer);
 }
 
+/*
+ * Check if the data transfer should be stopped
+ * either by the sink function or by the cancellation flag.
+ * Returns non-zero value in this case.
+ */
+int sink_stopped(sink_t *consumer)
+{
+  if (consumer->cancel && *(consumer->cancel))
+    consumer->status |= 1;
+  return consumer->status;
+}
+
+/*
+ * Get contiguous free room in the sink buffer for units
+ * of specified size flushing the buffer when it is full.
+ * A new buffer is borrowed from the consumer when necessary.
+ * Returns the room size in units or zero when nothing more
+ * can be passed to the sink.
+ */
+size_t sink_reserve(sink_t *consumer, size_t unit)
+{
+  while (!sink_stopped(consumer))
+    {
+      size_t room;
+      if (consumer->get_buffer && !consumer->buffer)
+        {
+          consumer->buffer_offset = 0;
+          consumer->bufsize = 0;
+          consumer->buffer = consumer->get_buffer(consumer->user_data, &(consumer->bufsize));
+          if (!consumer->buffer)
+            {
+              consumer->status |= 1;
+              break;
+            }
+        }
+      room = (chunk_size(consumer) - consumer->buffer_offset) / unit;
+      if (room)
+        return room;
+      if (!consumer->buffer_offset)
+        {
+          /* Too small buffer */
+          consumer->status |= 1;
+          break;
+        }
+      sink_flush(consumer);
+    }
+  return 0;
+}
+
 /*
  * Pass a block of data.
  *
- * Potentially may cause buffer overflow since this condition
- * is not checked during data transfer, but only afterwards.
+ * The block is split at the buffer boundary when necessary.
  */
 void sink_write(sink_t *consumer, const uint8_t *block, size_t size)
 {
-  memcpy((uint8_t *)consumer->buffer + consumer->buffer_offset, block, size);
-  consumer->buffer_offset += size;
-  if (consumer->buffer_offset >= consumer->bufsize)
-    sink_flush(consumer);
+  while (size)
+    {
+      size_t n = consumer->bufsize - consumer->buffer_offset;
+      if (n > size)
+        n = size;
+      memcpy((uint8_t *)consumer->buffer + consumer->buffer_offset, block, n);
+      consumer->buffer_offset += n;
+      block += n;
+      size -= n;
+      if (consumer->buffer_offset >= consumer->bufsize)
+        sink_flush(consumer);
+    }
 }
 
 /* Forget last byte if possible */
@@ -14,18 +14,36 @@
 #include <stdint.h>
 #include <stdlib.h>
 
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+#include <stdatomic.h>
+#else
+#include <signal.h>
+#endif
+
 #include "ru_tts.h"
 
 
+/* Flag that may be safely raised asynchronously */
+#if defined(__STDC_VERSION__) && (__STDC_VERSION__ >= 201112L) && !defined(__STDC_NO_ATOMICS__)
+typedef atomic_int sink_flag_t;
+#else
+typedef volatile sig_atomic_t sink_flag_t;
+#endif
+
 /* Sink control block definition */
 struct sink_cb
 {
   void *buffer;
   size_t buffer_offset;
   size_t bufsize;
+  size_t chunk;
+  int coalesce;
   int status;
+  const sink_flag_t *cancel;
   void *user_data;
   ru_tts_callback function;
+  ru_tts_get_buffer_callback get_buffer;
+  ru_tts_commit_callback commit;
   void (*custom_reset)(struct sink_cb *consumer);
 };
 typedef struct sink_cb sink_t;
@@ -42,20 +60,56 @@ extern void sink_setup(sink_t *consumer, void *buffer, size_t bufsize, ru_tts_ca
  */
 extern void sink_reset(sink_t *consumer);
 
-/* Pass data to the sink function */
+/*
+ * Pass data to the sink function.
+ *
+ * When the buffer is lent by the consumer,
+ * it is committed and returned back.
+ */
 extern void sink_flush(sink_t *consumer);
 
-/* Pass one byte of data */
-extern void sink_put(sink_t *consumer, int8_t byte);
+/*
+ * Pass data at the end of a clause. When clauses are coalesced,
+ * the data is kept until the buffer is at least half full.
+ */
+extern void sink_clause_end(sink_t *consumer);
+
+/*
+ * Check if the data transfer should be stopped
+ * either by the sink function or by the cancellation flag.
+ * Returns non-zero value in this case.
+ */
+extern int sink_stopped(sink_t *consumer);
+
+/*
+ * Get contiguous free room in the sink buffer for units
+ * of specified size flushing the buffer when it is full.
+ * A new buffer is borrowed from the consumer when necessary.
+ * Returns the room size in units or zero when nothing more
+ * can be passed to the sink.
+ */
+extern size_t sink_reserve(sink_t *consumer, size_t unit);
 
 /*
  * Pass a block of data.
  *
- * Potentially may cause buffer overflow since this condition
- * is not checked during data transfer, but only afterwards.
+ * The block is split at the buffer boundary when necessary.
  */
 extern void sink_write(sink_t *consumer, const uint8_t *block, size_t size);
 
+/*
+ * Pass one byte of data.
+ *
+ * Inlined, since it is called for every single byte,
+ * while the buffer is flushed rarely.
+ */
+static inline void sink_put(sink_t *consumer, int8_t byte)
+{
+  ((int8_t *)(consumer->buffer))[consumer->buffer_offset++] = byte;
+  if (consumer->buffer_offset >= consumer->bufsize)
+    sink_flush(consumer);
+}
+
 /* Forget last byte if possible */
 extern void sink_back(sink_t *consumer);
 
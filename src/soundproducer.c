@@ -10,10 +10,16 @@
 
 #include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+
+#ifdef __SSE2__
+#include <emmintrin.h>
+#endif
 
 #include "soundscript.h"
 #include "voice.h"
 #include "sink.h"
+#include "resampler.h"
 
 
 /* Local data */
@@ -57,6 +63,30 @@ static const int16_t synth_ctrl_data[][2] =
   };
 
 
+/* Local macros */
+
+/*
+ * Crossfade numerators are products of a sample difference
+ * and a sample index, so they fit in 23 bits.
+ */
+#define NUMERATOR_BITS 23
+
+/* Multiplier spreading sound ids over the grains cache slots */
+#define GRAIN_SPREAD 8
+
+/* Sound producer phases */
+#define PHASE_START 0
+#define PHASE_SILENCE 1
+#define PHASE_NOISE 2
+#define PHASE_COPY 3
+#define PHASE_PERIOD 4
+#define PHASE_PATTERN 5
+#define PHASE_GAP 6
+#define PHASE_FADING 7
+#define PHASE_GRAIN 8
+#define PHASE_DONE 9
+
+
 /* Local subroutines */
 
 /* Evaluate speech parameters according to the specified stage */
@@ -71,159 +101,679 @@ static int16_t eval(icb_t *icb)
   return res;
 }
 
+/* Store a sample at specified position in the producer output format */
+static void store(const sound_producer_t *producer, void *buffer, size_t n, int8_t sample)
+{
+  switch (producer->format)
+    {
+    case SAMPLE_FORMAT_S16_LE:
+      {
+        uint8_t *frame = (uint8_t *)buffer + (n << 1);
+        frame[0] = 0;
+        frame[1] = (uint8_t)sample;
+      }
+      break;
+    case SAMPLE_FORMAT_F32:
+      {
+        float value = ((float)sample) / 128.0f;
+        memcpy((uint8_t *)buffer + (n << 2), &value, sizeof(float));
+      }
+      break;
+    default:
+      ((int8_t *)buffer)[n] = sample;
+      break;
+    }
+}
+
+/* Pass native samples to the sink through the resampler */
+static void pass_resampled(resampler_t *resampler, const int8_t *input, size_t length,
+                           sink_t *consumer, int format)
+{
+  size_t frame = sample_size(format);
+  size_t room;
+
+  while ((room = sink_reserve(consumer, frame)))
+    {
+      size_t used = length;
+      size_t n = resample(resampler, input, &used,
+                          (uint8_t *)(consumer->buffer) + consumer->buffer_offset,
+                          room, format);
+      consumer->buffer_offset += n * frame;
+      if (n < room)
+        break;
+      input += used;
+      length -= used;
+    }
+}
+
+/* Store a block of voice samples from specified position in the producer output format */
+static void store_block(const sound_producer_t *producer, void *buffer, size_t n,
+                        const int8_t *samples, size_t count)
+{
+  if (producer->format == SAMPLE_FORMAT_S8)
+    memcpy((int8_t *)buffer + n, samples, count);
+  else while (count--)
+    store(producer, buffer, n++, *samples++);
+}
+
+/*
+ * Look for the next sound unit starting from the current one
+ * and prepare the producer to generate it.
+ */
+static void next_sound(soundscript_t *script, sound_producer_t *producer)
+{
+  for (; producer->index < script->length; producer->index++)
+    {
+      const sound_unit_t *sound = script->sounds + producer->index;
+      producer->length = sound->duration;
+      producer->id = ((uint16_t)(sound->id)) & 0xFF;
+      if (producer->id >= SYNTH_SOUNDS_START)
+        {
+          /* Fully synthetic sounds that are not voice dependent */
+          if (synth_ctrl_data[producer->id - SYNTH_SOUNDS_START][1] != -1)
+            {
+              producer->count = 0;
+              producer->phase = PHASE_NOISE;
+            }
+          else
+            {
+              producer->count = producer->length;
+              producer->phase = PHASE_SILENCE;
+            }
+          return;
+        }
+      else if (producer->length) /* Non-zero sound length check */
+        {
+          producer->sidx = script->voice->sound_offsets[producer->id];
+          producer->scnt = script->voice->sound_lengths[producer->id];
+          producer->stage = sound->stage;
+          if (producer->scnt > VOICE_THRESHOLD)
+            producer->phase = PHASE_COPY;
+          else
+            {
+              producer->mixed = producer->id < 132;
+              producer->ax = 0;
+              producer->dx = 0;
+              producer->phase = PHASE_PERIOD;
+              if (producer->mixed)
+                {
+                  /*
+                   * Reciprocal of the sound length for crossfading.
+                   * Rounded up with the precision of the numerator bits
+                   * plus the divisor bits, it gives exact quotients
+                   * and still fits in 32 bits.
+                   */
+                  uint32_t divisor = (producer->length < 0) ? -((int32_t)(producer->length)) : producer->length;
+                  uint8_t shift = NUMERATOR_BITS;
+                  while ((((uint32_t)1) << (shift - NUMERATOR_BITS)) < divisor)
+                    shift++;
+                  producer->shift = shift;
+                  producer->reciprocal = (uint32_t)(((((uint64_t)1) << shift) + divisor - 1) / divisor);
+                }
+            }
+          return;
+        }
+    }
+  producer->phase = PHASE_DONE;
+}
+
+/* Finish current sound unit and proceed to the next one */
+static void sound_done(soundscript_t *script, sound_producer_t *producer)
+{
+  producer->index++;
+  next_sound(script, producer);
+}
+
+/* Finish current pitch period and start the next one */
+static void period_done(soundscript_t *script, sound_producer_t *producer)
+{
+  int16_t ax = eval(&(script->icb[producer->stage]));
+  producer->ax = producer->mixed ? (producer->dx + ax) : ax;
+  producer->sidx = script->voice->sound_offsets[producer->id];
+  producer->scnt = script->voice->sound_lengths[producer->id];
+  producer->phase = PHASE_PERIOD;
+}
+
 /*
- * Make a silence of specified length.
- * Returns length.
+ * Generate next noise sample for fully synthetic sound
+ * according to specified control data.
  */
-static uint16_t silence(sink_t *consumer, uint16_t length)
+static int8_t noise_sample(const int16_t *ctrl, noise_registers_t *registers)
 {
-  uint16_t i;
-  for (i = 0; i < length; i++)
-    sink_put(consumer, 0);
-  return length;
+  int16_t bx = ctrl[0];
+  int16_t cx = ctrl[1];
+  uint16_t ax = registers->ax;
+  int16_t var1 = registers->var1;
+  int16_t var2 = registers->var2;
+  int16_t var3 = registers->var3;
+  int16_t si;
+  int16_t tmp = ax & 0x2D;
+
+  tmp ^= tmp >> 4;
+  tmp &= 0x0F;
+  if ((0x6996 >> tmp) & 0x01)
+    ax |= 0x8000;
+  ax >>= 1;
+  tmp = ax;
+  ax >>= 2;
+  var3 >>= 1;
+  var3 += var3 >> 2;
+  if (cx >= 0)
+    var3 += var3 >> 2;
+  si = var3;
+  var3 = (var2 << 1) - var1;
+  var1 = ax;
+  ax = (uint16_t)((((int32_t)var3) * ((int32_t)bx)) >> 15);
+  ax += var1 - si;
+  var3 = var2;
+  var2 = ax;
+
+  registers->ax = tmp;
+  registers->var1 = var1;
+  registers->var2 = var2;
+  registers->var3 = var3;
+  return (int8_t)(var2 >> ((cx & 0xFF) + 8));
 }
 
 /*
- * Make fading from specified sample index in the voice data.
- * Returns number of generated samples.
+ * Generate noise for fully synthetic sound storing it in the buffer
+ * from the specified position. Returns the position after generated samples.
+ *
+ * The precomputed beginning is simply copied
+ * and the rest is generated on the fly.
  */
-static uint16_t fading(sink_t *consumer, const voice_t *voice, uint16_t sidx)
+static size_t noise(sound_producer_t *producer, void *buffer, size_t n, size_t size)
 {
-  uint16_t i;
-  int8_t sample = voice->samples[sidx - 1];
-  for (i = 0; i < 3; i++)
+  uint8_t slot = noise_bank.slot[producer->id - SYNTH_SOUNDS_START];
+  const int16_t *ctrl = synth_ctrl_data[producer->id - SYNTH_SOUNDS_START];
+  int remaining = ((int)(producer->length)) + 1 - producer->count;
+
+  if ((remaining > 0) && (producer->count < NOISE_TABLE_LENGTH))
     {
-      sample >>= 1;
-      sink_put(consumer, sample);
+      size_t run = NOISE_TABLE_LENGTH - producer->count;
+      if (run > ((size_t)remaining))
+        run = remaining;
+      if (run > (size - n))
+        run = size - n;
+      store_block(producer, buffer, n, noise_bank.samples[slot] + producer->count, run);
+      n += run;
+      producer->count += run;
+      if (producer->count == NOISE_TABLE_LENGTH)
+        producer->noise = noise_bank.registers[slot];
     }
-  return 3;
-}
 
+  for (; (n < size) && (producer->count <= producer->length); n++, producer->count++)
+    store(producer, buffer, n, noise_sample(ctrl, &(producer->noise)));
 
-/* Global entry point */
+  return n;
+}
 
-/* Generate sound stream and feed it to the specified sink */
-void make_sound(soundscript_t *script, sink_t *consumer)
+/*
+ * Find pitch period grain for the current sound and specified
+ * stretch value building it when it is not in the cache yet.
+ *
+ * The grain consists of the voice pattern truncated to the stretch
+ * value and followed either by the zero gap up to this value
+ * or by the fading tail of three samples.
+ *
+ * Returns NULL when the period cannot be represented by a grain.
+ */
+static const grain_t *grain(soundscript_t *script, const sound_producer_t *producer, uint8_t stretch)
 {
-  int i;
+  grain_t *grain = script->grains->slots + ((producer->id * GRAIN_SPREAD + stretch) & (GRAIN_SLOTS - 1));
 
-  sink_put(consumer, 0);
-  for (i = 0; (i < script->length) && !consumer->status; i++)
+  if (!stretch || !producer->scnt)
+    return NULL;
+
+  if ((grain->voice != script->voice) || (grain->id != producer->id) || (grain->stretch != stretch))
     {
-      int16_t l = script->sounds[i].duration;
-      uint16_t j = ((uint16_t)(script->sounds[i].id)) & 0xFF;
-      uint16_t k;
-      if (j >= 169)
+      uint16_t n = (stretch < producer->scnt) ? stretch : producer->scnt;
+      memcpy(grain->samples, script->voice->samples + producer->sidx, n);
+      grain->length = n;
+      if (stretch < producer->scnt)
         {
-          /* Fully synthetic sounds that are not voice dependent */
-          int16_t bx;
-          int16_t cx;
-          j -= 169;
-          bx = synth_ctrl_data[j][0];
-          cx = synth_ctrl_data[j][1];
-          if (cx != -1)
+          int8_t sample = grain->samples[n - 1];
+          uint8_t k;
+          for (k = 0; k < 3; k++)
             {
-              uint16_t ax = 205;
-              int16_t sample_shift = (cx & 0xFF) + 8;
-              int16_t var1 = 0;
-              int16_t var2 = 0;
-              int16_t var3 = 0;
-              for (k = 0; k <= l; k++)
-                {
-                  int16_t si;
-                  int16_t tmp = ax & 0x2D;
-                  tmp ^= tmp >> 4;
-                  tmp &= 0x0F;
-                  if ((0x6996 >> tmp) & 0x01)
-                    ax |= 0x8000;
-                  ax >>= 1;
-                  tmp = ax;
-                  ax >>= 2;
-                  var3 >>= 1;
-                  var3 += var3 >> 2;
-                  if (cx >= 0)
-                    var3 += var3 >> 2;
-                  si = var3;
-                  var3 = (var2 << 1) - var1;
-                  var1 = ax;
-                  ax = (uint16_t)((((int32_t)var3) * ((int32_t)bx)) >> 15);
-                  ax += var1 - si;
-                  var3 = var2;
-                  var2 = ax;
-                  sink_put(consumer, (int8_t)(var2 >> sample_shift));
-                  ax = tmp;
-                }
+              sample >>= 1;
+              grain->samples[grain->length++] = sample;
             }
-          else silence(consumer, l);
         }
-      else if (l) /* Non-zero sound length check */
+      else
+        {
+          memset(grain->samples + n, 0, stretch - n);
+          grain->length = stretch;
+        }
+      grain->voice = script->voice;
+      grain->id = producer->id;
+      grain->stretch = stretch;
+    }
+
+  return grain;
+}
+
+/*
+ * Truncating division by the sound length using
+ * the fixed-point reciprocal prepared by next_sound().
+ */
+static int32_t divide(const sound_producer_t *producer, int32_t numerator)
+{
+  uint64_t magnitude = (numerator < 0) ? -((int64_t)numerator) : numerator;
+  int32_t quotient = (int32_t)((magnitude * producer->reciprocal) >> producer->shift);
+  return ((numerator < 0) != (producer->length < 0)) ? -quotient : quotient;
+}
+
+#ifdef __SSE2__
+/* Sign extend four samples to 32-bit lanes */
+static __m128i load4(const int8_t *samples)
+{
+  int32_t word;
+  __m128i v;
+  memcpy(&word, samples, sizeof(word));
+  v = _mm_cvtsi32_si128(word);
+  v = _mm_srai_epi16(_mm_unpacklo_epi8(v, v), 8);
+  return _mm_srai_epi32(_mm_unpacklo_epi16(v, v), 16);
+}
+
+/*
+ * Mix four samples of the current pattern with the next sound ones
+ * storing the result in the buffer. It is the same as four steps
+ * of the scalar loop in crossfade() taken while the pattern lasts.
+ */
+static void crossfade4(const int8_t *pattern, const int8_t *sound, int16_t dx,
+                       __m128i reciprocal, __m128i shift, __m128i sign, int8_t *buffer)
+{
+  __m128i current = load4(sound);
+  __m128i diff = _mm_sub_epi32(load4(pattern), current);
+  __m128i index = _mm_set_epi32((uint16_t)(dx + 3), (uint16_t)(dx + 2), (uint16_t)(dx + 1), (uint16_t)dx);
+  __m128i numerator = _mm_madd_epi16(diff, index);
+  __m128i negative = _mm_srai_epi32(numerator, 31);
+  __m128i magnitude = _mm_sub_epi32(_mm_xor_si128(numerator, negative), negative);
+  __m128i even = _mm_srl_epi64(_mm_mul_epu32(magnitude, reciprocal), shift);
+  __m128i odd = _mm_srl_epi64(_mm_mul_epu32(_mm_srli_epi64(magnitude, 32), reciprocal), shift);
+  __m128i quotient = _mm_or_si128(even, _mm_slli_epi64(odd, 32));
+  __m128i result;
+  int32_t word;
+
+  negative = _mm_xor_si128(negative, sign);
+  quotient = _mm_sub_epi32(_mm_xor_si128(quotient, negative), negative);
+  result = _mm_add_epi32(quotient, current);
+  result = _mm_srai_epi32(_mm_slli_epi32(result, 24), 24);
+  result = _mm_packs_epi32(result, result);
+  result = _mm_packs_epi16(result, result);
+  word = _mm_cvtsi128_si32(result);
+  memcpy(buffer, &word, sizeof(word));
+}
+#endif
+
+/*
+ * Mix current pattern with the next sound one
+ * storing specified number of samples in the buffer.
+ */
+static void crossfade(const int8_t *samples, sound_producer_t *producer, int8_t *buffer, size_t count)
+{
+  int16_t ax = producer->ax;
+  int16_t dx = producer->dx;
+  uint16_t sidx = producer->sidx;
+  uint16_t pattern = producer->pattern;
+  size_t i = 0;
+
+#ifdef __SSE2__
+  if (count > 4)
+    {
+      __m128i reciprocal = _mm_set1_epi32(producer->reciprocal);
+      __m128i shift = _mm_cvtsi32_si128(producer->shift);
+      __m128i sign = _mm_set1_epi32((producer->length < 0) ? -1 : 0);
+
+      /* The first sample is mixed with the kept one */
+      ax -= (int16_t)(samples[sidx]);
+      ax = (int16_t)divide(producer, ((int32_t)ax) * ((int32_t)(dx++)));
+      ax += (int16_t)(samples[sidx++]);
+      buffer[i++] = (int8_t)ax;
+      pattern++;
+
+      /* Then four samples at once while the pattern lasts */
+      for (; ((i + 4) <= count) && ((((uint32_t)pattern) + 4) <= producer->pattern_end); i += 4)
+        {
+          crossfade4(samples + pattern, samples + sidx, dx, reciprocal, shift, sign, buffer + i);
+          pattern += 4;
+          sidx += 4;
+          dx += 4;
+        }
+      ax = (pattern < producer->pattern_end) ? ((int16_t)(samples[pattern])) : 0;
+    }
+#endif
+
+  for (; i < count; i++)
+    {
+      ax -= (int16_t)(samples[sidx]);
+      ax = (int16_t)divide(producer, ((int32_t)ax) * ((int32_t)(dx++)));
+      ax += (int16_t)(samples[sidx++]);
+      buffer[i] = (int8_t)ax;
+      ax = ((++pattern) < producer->pattern_end) ? ((int16_t)(samples[pattern])) : 0;
+    }
+
+  producer->ax = ax;
+  producer->dx = dx;
+  producer->sidx = sidx;
+  producer->pattern = pattern;
+}
+
+/*
+ * Generate next part of a pitch period pattern storing it in the buffer
+ * from the specified position. Returns the position after generated samples.
+ *
+ * Samples are generated in runs up to the nearest of the pattern end,
+ * the period end or the buffer end.
+ */
+static size_t pattern(soundscript_t *script, sound_producer_t *producer, void *buffer, size_t n, size_t size)
+{
+  const int8_t *samples = script->voice->samples;
+  size_t count = producer->count ? producer->count : (UINT16_MAX + 1);
+  size_t scnt = producer->scnt ? producer->scnt : (UINT16_MAX + 1);
+  size_t run = size - n;
+
+  if (run > count)
+    run = count;
+  if (run > scnt)
+    run = scnt;
+
+  if (producer->mixed)
+    {
+      /* Mixed and transitional sounds */
+      int8_t block[SOUND_SLICE];
+      size_t i;
+      for (i = 0; i < run; i += SOUND_SLICE)
+        {
+          size_t k = ((run - i) < SOUND_SLICE) ? (run - i) : SOUND_SLICE;
+          crossfade(samples, producer, block, k);
+          store_block(producer, buffer, n + i, block, k);
+        }
+    }
+  else
+    {
+      /* Transition of a prepared pattern */
+      store_block(producer, buffer, n, samples + producer->sidx, run);
+      producer->sidx += run;
+      producer->length -= run;
+    }
+  n += run;
+
+  if (run == count)
+    {
+      /* Period is over before the pattern end check */
+      producer->count = 0;
+      producer->scnt -= run - 1;
+      if (producer->scnt > 1)
+        {
+          producer->count = 3;
+          producer->sample = samples[producer->sidx - 1];
+          producer->phase = PHASE_FADING;
+        }
+      else
+        {
+          period_done(script, producer);
+          return n;
+        }
+    }
+  else
+    {
+      producer->count -= run;
+      producer->scnt -= run;
+      if (run < scnt)
+        return n;
+      producer->phase = PHASE_GAP;
+    }
+
+  if (producer->mixed)
+    producer->dx += producer->count;
+  else producer->length -= producer->count;
+
+  return n;
+}
+
+
+/* Global entry points */
+
+/*
+ * Generate noise waveforms for all fully synthetic sounds.
+ * It is used only to produce and check the precomputed noise bank.
+ */
+void noise_bank_setup(noise_bank_t *bank)
+{
+  uint8_t i;
+  uint8_t slot = 0;
+
+  for (i = 0; i < SYNTH_SOUNDS; i++)
+    if (synth_ctrl_data[i][1] != -1)
+      {
+        noise_registers_t registers = { 205, 0, 0, 0 };
+        size_t k;
+        for (k = 0; k < NOISE_TABLE_LENGTH; k++)
+          bank->samples[slot][k] = noise_sample(synth_ctrl_data[i], &registers);
+        bank->registers[slot] = registers;
+        bank->slot[i] = slot++;
+      }
+    else bank->slot[i] = 0;
+}
+
+/* Make pitch period grains cache empty */
+void grain_cache_reset(grain_cache_t *cache)
+{
+  size_t i;
+  for (i = 0; i < GRAIN_SLOTS; i++)
+    cache->slots[i].voice = NULL;
+}
+
+/* Get size of one sample in specified output format */
+size_t sample_size(int format)
+{
+  switch (format)
+    {
+    case SAMPLE_FORMAT_S16_LE:
+      return 2;
+    case SAMPLE_FORMAT_F32:
+      return sizeof(float);
+    default:
+      break;
+    }
+  return 1;
+}
+
+/* Prepare sound producer for a new sound script and output format */
+void sound_start(sound_producer_t *producer, int format)
+{
+  producer->index = 0;
+  producer->format = format;
+  producer->phase = PHASE_START;
+}
+
+/*
+ * Generate next portion of the sound stream for specified script
+ * and store it in the buffer of specified size in samples.
+ *
+ * The producer keeps all the state needed to resume generation
+ * exactly where it has been stopped.
+ *
+ * Returns number of generated samples. The value less than
+ * the buffer size means that the sound script is exhausted.
+ */
+size_t sound_produce(soundscript_t *script, sound_producer_t *producer, void *buffer, size_t size)
+{
+  size_t frame = sample_size(producer->format);
+  size_t n = 0;
+
+  while (n < size)
+    switch (producer->phase)
+      {
+      case PHASE_START:
+        store(producer, buffer, n++, 0);
+        next_sound(script, producer);
+        break;
+      case PHASE_SILENCE:
+      case PHASE_GAP:
         {
-          int16_t ax = 0;
-          uint16_t sidx = script->voice->sound_offsets[j];
-          uint16_t scnt = script->voice->sound_lengths[j];
-          uint8_t stage = script->sounds[i].stage;
-          if (scnt > VOICE_THRESHOLD)
+          size_t count = size - n;
+          if (count > producer->count)
+            count = producer->count;
+          memset((uint8_t *)buffer + n * frame, 0, count * frame);
+          n += count;
+          producer->count -= count;
+          if (!producer->count)
             {
-              /* Simply copy prepared pattern from the voice data */
-              do sink_put(consumer, script->voice->samples[sidx++]);
-              while ((--scnt) && (--l));
+              if (producer->phase == PHASE_GAP)
+                period_done(script, producer);
+              else sound_done(script, producer);
             }
-          else if (j >= 132)
+        }
+        break;
+      case PHASE_NOISE:
+        n = noise(producer, buffer, n, size);
+        if (producer->count > producer->length)
+          sound_done(script, producer);
+        break;
+      case PHASE_COPY:
+        /* Simply copy prepared pattern from the voice data */
+        {
+          size_t run = producer->scnt;
+          if ((producer->length > 0) && (((size_t)(producer->length)) < run))
+            run = producer->length;
+          if (run > (size - n))
             {
-              /* Make a transition of a prepared pattern */
-              while (l > ax)
-                {
-                  k = script->icb[stage].stretch;
-                  do
-                    {
-                      sink_put(consumer, script->voice->samples[sidx++]);
-                      l--;
-                    }
-                  while ((--k) && (--scnt));
-                  if (k)
-                    l -= silence(consumer, k);
-                  else if (scnt > 1)
-                    l -= fading(consumer, script->voice, sidx);
-                  ax = eval(&(script->icb[stage]));
-                  sidx = script->voice->sound_offsets[j];
-                  scnt = script->voice->sound_lengths[j];
-                }
+              run = size - n;
+              store_block(producer, buffer, n, script->voice->samples + producer->sidx, run);
+              n += run;
+              producer->sidx += run;
+              producer->scnt -= run;
+              producer->length -= run;
             }
           else
             {
-              /* Mixed and transitional sounds */
-              int16_t dx = 0;
-              while (l >= ax)
-                {
-                  uint16_t next_pattern_offset;
-                  k = script->icb[stage].stretch;
-                  j = ((uint16_t)(script->sounds[i + 1].id)) & 0xFF;
-                  next_pattern_offset = script->voice->sound_offsets[j + 1];
-                  j = script->voice->sound_offsets[j];
-                  sink_put(consumer, 0);
-                  ax = (int16_t)(script->voice->samples[j]);
-                  do
-                    {
-                      ax -= (int16_t)(script->voice->samples[sidx]);
-                      ax = (int16_t)(((int32_t)ax) * ((int32_t)(dx++)) / ((int32_t)l));
-                      ax += (int16_t)(script->voice->samples[sidx++]);
-                      sink_put(consumer, (int8_t)ax);
-                      ax = ((++j) < next_pattern_offset) ? ((int16_t)(script->voice->samples[j])) : 0;
-                    }
-                  while ((--k) && (--scnt));
-                  if (k)
-                    dx += silence(consumer, k);
-                  else if (scnt > 1)
-                    dx += fading(consumer, script->voice, sidx);
-                  ax = dx + eval(&(script->icb[stage]));
-                  j = ((uint16_t)(script->sounds[i].id)) & 0xFF;
-                  sidx = script->voice->sound_offsets[j];
-                  scnt = script->voice->sound_lengths[j];
-                }
+              store_block(producer, buffer, n, script->voice->samples + producer->sidx, run);
+              n += run;
+              sound_done(script, producer);
             }
         }
+        break;
+      case PHASE_PERIOD:
+        if (producer->mixed ? (producer->length >= producer->ax) : (producer->length > producer->ax))
+          {
+            producer->count = script->icb[producer->stage].stretch;
+            if (!producer->mixed)
+              {
+                producer->grain = grain(script, producer, script->icb[producer->stage].stretch);
+                if (producer->grain)
+                  {
+                    /* Whole period is taken from the grains cache */
+                    producer->count = producer->grain->length;
+                    producer->length -= producer->grain->length;
+                    producer->sidx = 0;
+                    producer->phase = PHASE_GRAIN;
+                    break;
+                  }
+              }
+            else
+              {
+                uint16_t j = ((uint16_t)(script->sounds[producer->index + 1].id)) & 0xFF;
+                producer->pattern_end = script->voice->sound_offsets[j + 1];
+                producer->pattern = script->voice->sound_offsets[j];
+                store(producer, buffer, n++, 0);
+                producer->ax = (int16_t)(script->voice->samples[producer->pattern]);
+              }
+            producer->phase = PHASE_PATTERN;
+          }
+        else sound_done(script, producer);
+        break;
+      case PHASE_PATTERN:
+        n = pattern(script, producer, buffer, n, size);
+        break;
+      case PHASE_GRAIN:
+        {
+          size_t run = size - n;
+          if (run > producer->count)
+            run = producer->count;
+          store_block(producer, buffer, n, producer->grain->samples + producer->sidx, run);
+          n += run;
+          producer->sidx += run;
+          producer->count -= run;
+          if (!producer->count)
+            period_done(script, producer);
+        }
+        break;
+      case PHASE_FADING:
+        do
+          {
+            producer->sample >>= 1;
+            store(producer, buffer, n++, producer->sample);
+          }
+        while ((--(producer->count)) && (n < size));
+        if (!producer->count)
+          period_done(script, producer);
+        break;
+      default:
+        return n;
+      }
+
+  return n;
+}
+
+/*
+ * Generate sound stream in specified format
+ * and feed it to the specified sink.
+ *
+ * The sound stream is passed through the resampler
+ * when the output sample rate differs from the native one.
+ * The sink always gets whole samples, so its buffer
+ * must be able to hold at least one of them.
+ */
+void make_sound(soundscript_t *script, resampler_t *resampler, sink_t *consumer, int format)
+{
+  sound_producer_t producer;
+  size_t room;
+  size_t n;
+
+  if (resampler->active)
+    {
+      int8_t slice[SOUND_SLICE];
+      sound_start(&producer, SAMPLE_FORMAT_S8);
+      do
+        {
+          n = sound_produce(script, &producer, slice, SOUND_SLICE);
+          pass_resampled(resampler, slice, n, consumer, format);
+        }
+      while ((n == SOUND_SLICE) && !sink_stopped(consumer));
     }
+  else
+    {
+      size_t frame = sample_size(format);
+      sound_start(&producer, format);
+      while ((room = sink_reserve(consumer, frame)))
+        {
+          if (room > SOUND_SLICE)
+            room = SOUND_SLICE;
+          n = sound_produce(script, &producer, (uint8_t *)(consumer->buffer) + consumer->buffer_offset, room);
+          consumer->buffer_offset += n * frame;
+          if (n < room)
+            break;
+        }
+    }
+
+  /* Flush output buffer at the clause end */
+  sink_clause_end(consumer);
+}
 
-  /* Flush output buffer */
+/*
+ * Pass the rest of the sound stream delayed by the resampler
+ * or kept in the sink buffer to the specified sink
+ * at the end of speech.
+ */
+void finish_sound(resampler_t *resampler, sink_t *consumer, int format)
+{
+  if (resampler->active)
+    {
+      resampler_finish(resampler);
+      pass_resampled(resampler, NULL, 0, consumer, format);
+    }
   sink_flush(consumer);
 }
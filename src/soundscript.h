@@ -18,22 +18,67 @@
 #include "sink.h"
 #include "timing.h"
 #include "modulation.h"
+#include "resampler.h"
 
 
 /* Data size definition */
 #define MAX_SOUNDS 1000
-#define NSTAGES 12
 
 /* Number of time plan rows */
 #define TIME_PLAN_ROWS 9
 
+/* Phoncode property bits for the time planner */
+#define RANK_MASK 0x0007
+#define SET6 0x0008
+#define SET7 0x0010
+#define SET8_HEAD 0x0020
+#define SET8 0x0040
+#define SET9_HEAD 0x0080
+#define SET9 0x0100
+#define SET10_HEAD 0x0200
+#define SET10 0x0400
+#define BOUNDARY 0x0800
+#define BOUNDARY_KIND(x) (((x) >> 12) & 0x03)
+
 /* Voice sample length threshold for processing differentiation */
 #define VOICE_THRESHOLD 105
 
+/* Maximum number of samples generated between cancellation checks */
+#define SOUND_SLICE 256
+
+/* Fully synthetic sounds */
+#define SYNTH_SOUNDS_START 169
+#define SYNTH_SOUNDS 33
+
+/* Number of noise sounds among the fully synthetic ones */
+#define NOISE_SOUNDS 12
+
+/* Number of precomputed samples for each noise sound */
+#define NOISE_TABLE_LENGTH 2048
 
-/* Time plan pointer definition */
+/* Number of pitch period grains kept in the cache (must be a power of 2) */
+#define GRAIN_SLOTS 64
+
+/* Maximum pitch period grain length */
+#define GRAIN_MAX_LENGTH UINT8_MAX
+
+
+/* Time plan definitions */
+typedef uint8_t time_plan_t[TIME_PLAN_ROWS][100];
 typedef uint8_t (*time_plan_ptr_t)[100];
 
+/* Time planner scratch data */
+typedef struct
+{
+  uint8_t value;
+  uint8_t delta;
+  uint8_t flag;
+  uint8_t ndx1;
+  uint8_t ndx2;
+  uint8_t itercount;
+  uint8_t area[5][UINT8_MAX + 3];
+} planner_workspace_t;
+
 /* Sound unit structure */
 typedef struct
 {
@@ -51,49 +96,175 @@ typedef struct
   uint8_t period;
 } icb_t;
 
+/* Noise generator registers */
+typedef struct
+{
+  uint16_t ax;
+  int16_t var1;
+  int16_t var2;
+  int16_t var3;
+} noise_registers_t;
+
+/*
+ * Precomputed noise waveforms.
+ *
+ * Noise depends only on the sound id and the sample index,
+ * so its beginning is generated in advance by noisegen. Generator
+ * registers are saved at the table end for producing longer sounds.
+ */
+typedef struct
+{
+  uint8_t slot[SYNTH_SOUNDS];
+  int8_t samples[NOISE_SOUNDS][NOISE_TABLE_LENGTH];
+  noise_registers_t registers[NOISE_SOUNDS];
+} noise_bank_t;
+
+/*
+ * Fully formed pitch period of a prepared voice pattern
+ * for the particular sound id and stretch value.
+ */
+typedef struct
+{
+  const voice_t *voice; /* NULL when the slot is empty */
+  uint16_t id;
+  uint8_t stretch;
+  uint16_t length;
+  int8_t samples[GRAIN_MAX_LENGTH];
+} grain_t;
+
+/*
+ * Pitch period grains cache.
+ *
+ * Grains are built lazily when they are needed
+ * and replace each other in case of slot collision.
+ */
+typedef struct
+{
+  grain_t slots[GRAIN_SLOTS];
+} grain_cache_t;
+
 /* Sound mastering script */
 typedef struct
 {
   const voice_t *voice;
+  grain_cache_t *grains;
   size_t length;
   sound_unit_t sounds[MAX_SOUNDS];
   icb_t icb[NSTAGES];
 } soundscript_t;
 
 
+/* Sound stream generator state */
+typedef struct
+{
+  size_t index;
+  int format;
+  uint8_t phase;
+  uint8_t stage;
+  uint8_t mixed;
+  int8_t sample;
+  int16_t length;
+  int16_t ax;
+  int16_t dx;
+  uint16_t id;
+  uint16_t count;
+  uint16_t sidx;
+  uint16_t scnt;
+  uint16_t pattern;
+  uint16_t pattern_end;
+  uint32_t reciprocal;
+  uint8_t shift;
+  const grain_t *grain;
+
+  noise_registers_t noise;
+} sound_producer_t;
+
+
 /* Available voices */
 extern const voice_t male;
 extern const voice_t female;
 
+/* Precomputed noise for fully synthetic sounds */
+extern const noise_bank_t noise_bank;
+
+/* Phoncode properties for the time planner */
+extern const uint16_t phoncode_properties[256];
+
 
 /* Related functions */
 
-/* Build utterance according to phonetic transcription */
-extern void build_utterance(uint8_t *transcription, soundscript_t *script);
+/*
+ * Build utterance according to phonetic transcription
+ * taken from TRANSCRIPTION_START up to the specified end.
+ */
+extern void build_utterance(uint8_t *transcription, uint16_t end, soundscript_t *script);
 
 /*
- * Build timing draft for specified phonetic transcription.
+ * Fill timing draft for specified phonetic transcription
+ * taken from TRANSCRIPTION_START up to the specified end.
  *
  * This draft is used for speechrate applying.
+ * The scratch argument points to the working space
+ * provided by the caller.
  *
- * Returns pointer to the time draft or NULL when failure.
- *
- * This procedure allocates memory, thus, the non-null pointer returned
- * must be finally passed to free().
+ * Returns non-zero value if the draft is successively filled.
  */
-extern time_plan_ptr_t plan_time(uint8_t *transcription);
+extern int plan_time(uint8_t *transcription, uint16_t end, time_plan_ptr_t draft, planner_workspace_t *scratch);
 
 /*
  * Apply speechrate parameters to the soundscript
  * according to specified timing data.
  */
-extern void apply_speechrate(soundscript_t *script, timing_t *timing, time_plan_ptr_t draft);
+extern void apply_speechrate(soundscript_t *script, const timing_t *timing, time_plan_ptr_t draft);
+
+/*
+ * Apply intonation parameters to the sound script according
+ * to the transcription from TRANSCRIPTION_START up to the specified end.
+ */
+extern void apply_intonation(uint8_t *transcription, uint16_t end, soundscript_t *soundscript,
+                             const modulation_t *modulation, uint8_t clause_type);
+
+/*
+ * Generate noise waveforms for all fully synthetic sounds.
+ * It is used only to produce and check the precomputed noise bank.
+ */
+extern void noise_bank_setup(noise_bank_t *bank);
+
+/* Make pitch period grains cache empty */
+extern void grain_cache_reset(grain_cache_t *cache);
+
+/* Get size of one sample in specified output format */
+extern size_t sample_size(int format);
 
-/* Apply intonation parameters to the sound script */
-extern void apply_intonation(uint8_t *transcription, soundscript_t *soundscript,
-                             modulation_t *modulation, uint8_t clause_type);
+/* Prepare sound producer for a new sound script and output format */
+extern void sound_start(sound_producer_t *producer, int format);
 
-/* Generate sound stream and feed it to the specified sink */
-extern void make_sound(soundscript_t *script, sink_t *consumer);
+/*
+ * Generate next portion of the sound stream for specified script
+ * and store it in the buffer of specified size in samples.
+ *
+ * The producer keeps all the state needed to resume generation
+ * exactly where it has been stopped.
+ *
+ * Returns number of generated samples. The value less than
+ * the buffer size means that the sound script is exhausted.
+ */
+extern size_t sound_produce(soundscript_t *script, sound_producer_t *producer, void *buffer, size_t size);
+
+/*
+ * Generate sound stream in specified format
+ * and feed it to the specified sink.
+ *
+ * The sound stream is passed through the resampler
+ * when the output sample rate differs from the native one.
+ */
+extern void make_sound(soundscript_t *script, resampler_t *resampler, sink_t *consumer, int format);
+
+/*
+ * Pass the rest of the sound stream delayed by the resampler
+ * or kept in the sink buffer to the specified sink
+ * at the end of speech.
+ */
+extern void finish_sound(resampler_t *resampler, sink_t *consumer, int format);
 
 #endif
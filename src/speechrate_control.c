@@ -112,6 +112,17 @@ static const uint8_t elements[][6] =
   };
 
 
+/* Local subroutines */
+
+/* Compute final duration of the pause specified by sound id */
+static void set_pause(timing_t *timing, uint8_t j)
+{
+  int k = j - 191;
+  uint8_t gaplen = ((k >= 0) && (k < CLAUSE_SEPARATORS)) ? timing->gaplen[k] : top[j];
+  timing->pauses[j - VOICED_SOUNDS] = (uint16_t)((unsigned int)timing->gap_factor * gaplen * 100 / timing->rate_factor);
+}
+
+
 /* Global functions */
 
 /*
@@ -131,6 +142,19 @@ void timing_setup(timing_t *timing, int speech_rate, int gap_factor)
   timing->gap_factor = (uint8_t) ((gap_factor << 2) / 5);
   for (i = 0; i < CLAUSE_SEPARATORS; i++)
     timing->gaplen[i] = top[i + 191];
+
+  /*
+   * Rounding the reciprocal up keeps the quotient exact,
+   * since the dividend never reaches 2^RATE_SHIFT / rate_factor.
+   */
+  timing->reciprocal = ((((uint64_t) 100) << RATE_SHIFT) + timing->rate_factor - 1) / timing->rate_factor;
+  for (i = 0; i < VOICED_SOUNDS; i++)
+    {
+      timing->scale[i] = ((uint32_t) (top[i] - bottom[i])) * 120;
+      timing->offset[i] = (((uint32_t) bottom[i]) << 14) + 2048;
+    }
+  for (i = VOICED_SOUNDS; i < VOICE_DIMENSION; i++)
+    set_pause(timing, i);
 }
 
 /*
@@ -149,6 +173,7 @@ void adjust_gaplen(timing_t *timing, char separator, int gap_factor)
       else if (gaplen > 150)
         timing->gaplen[i] = 150;
       else timing->gaplen[i] = (uint8_t) gaplen;
+      set_pause(timing, i + 191);
     }
 }
 
@@ -156,7 +181,7 @@ void adjust_gaplen(timing_t *timing, char separator, int gap_factor)
  * Apply speechrate parameters to the soundscript
  * according to specified timing data.
  */
-void apply_speechrate(soundscript_t *script, timing_t *timing, time_plan_ptr_t draft)
+void apply_speechrate(soundscript_t *script, const timing_t *timing, time_plan_ptr_t draft)
 {
   uint16_t i;
   uint8_t n = 1;
@@ -164,40 +189,37 @@ void apply_speechrate(soundscript_t *script, timing_t *timing, time_plan_ptr_t d
   for (i = 0; i < script->length; i++)
     {
       uint8_t j = script->sounds[i].id;
-      if (j < 189)
+      if (j < VOICED_SOUNDS)
         {
-          if ((draft[1][n] != 4) || (script->sounds[i].stage != 3))
+          /* Sounds beyond the plan get the empty column 0 */
+          uint8_t m = (n < sizeof(*draft)) ? n : 0;
+          if ((draft[1][m] != 4) || (script->sounds[i].stage != 3))
             {
               uint32_t s = 0;
               uint8_t k;
               for (k = 0; k < TIME_PLAN_ROWS; k++)
-                s += elements[k][draft[k][n]];
-              s *= top[j] - bottom[j];
-              s *= 120;
-              s += (((uint32_t) bottom[j]) << 14) + 2048;
-              s >>= 12;
-              if ((draft[1][n] == 5) && (script->sounds[i].stage == 2))
+                s += elements[k][draft[k][m]];
+              s = (s * timing->scale[j] + timing->offset[j]) >> 12;
+              if ((draft[1][m] == 5) && (script->sounds[i].stage == 2))
                 s += s >> 1;
-              script->sounds[i].duration = (uint16_t)(s * 100 / timing->rate_factor);
+              script->sounds[i].duration = (uint16_t)((s * timing->reciprocal) >> RATE_SHIFT);
             }
           else script->sounds[i].duration = 0;
           if (script->sounds[i].stage >= script->sounds[i + 1].stage)
-            if (draft[1][n++] == 5)
-              {
-                while ((++i) < script->length)
-                  {
-                    script->sounds[i].duration = 0;
-                    if (script->sounds[i].stage >= script->sounds[i + 1].stage)
-                      break;
-                  }
-                n++;
-              }
-        }
-      else
-        {
-          int k = j - 191;
-          uint8_t gaplen = ((k >= 0) && (k < CLAUSE_SEPARATORS)) ? timing->gaplen[k] : top[j];
-          script->sounds[i].duration = (uint16_t)((unsigned int)timing->gap_factor * gaplen * 100 / timing->rate_factor);
+            {
+              n++;
+              if (draft[1][m] == 5)
+                {
+                  while ((++i) < script->length)
+                    {
+                      script->sounds[i].duration = 0;
+                      if (script->sounds[i].stage >= script->sounds[i + 1].stage)
+                        break;
+                    }
+                  n++;
+                }
+            }
         }
+      else script->sounds[i].duration = timing->pauses[j - VOICED_SOUNDS];
     }
 }
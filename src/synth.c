@@ -149,91 +149,197 @@ static const uint8_t seqlist5[] =
     0
   };
 
+/* All the lists in order of their numbers */
+static const uint8_t *const seqlists[SEQLISTS] =
+  {
+    seqlist1,
+    seqlist2,
+    seqlist3,
+    seqlist4,
+    seqlist5
+  };
+
 
 /* Local subroutines */
 
 /*
- * Test a phoncode sequence pointed by ptr against specified list.
+ * Test a phoncode sequence pointed by ptr against the list
+ * of specified number. The first list item being a prefix
+ * of the sequence is taken, so it must be followed by a separator.
  * Returns non-zero when succeeded.
  */
-static int test_list(const uint8_t *ptr, const uint8_t *lst)
+static int test_list(const seq_matcher_t *matcher, const uint8_t *ptr, uint8_t list)
 {
-  const uint8_t *item;
-  for (item = lst; item[0] && memcmp(ptr, item + 1, item[0]); item += item[0] + 1);
-  return (item[0] != 0) && (ptr[item[0]] > 42) && (ptr[item[0]] < 53);
-}
+  const seq_node_t *node = matcher->nodes;
+  uint8_t order = 0;
+  uint8_t length = 0;
+  uint8_t depth;
 
-/* Shift clause transcription one point left */
-static void shift(uint8_t *buf)
-{
-  size_t i = 0;
-  do
+  for (depth = 1; node->child; depth++)
     {
-      buf[i] = buf[i + 1];
-      i++;
+      uint8_t k;
+      for (k = node->child; k && (matcher->nodes[k].phoncode != ptr[depth - 1]); k = matcher->nodes[k].sibling);
+      if (!k)
+        break;
+      node = matcher->nodes + k;
+      if (node->order[list - 1] && (!order || (node->order[list - 1] < order)))
+        {
+          order = node->order[list - 1];
+          length = depth;
+        }
     }
-  while ((buf[i] < 44) || (buf[i] > 52));
-  buf[i] = 43;
+  return order && (ptr[length] > 42) && (ptr[length] < 53);
 }
 
 /*
- * Advance transcription up to the specified point.
- * Returns pointer to the transcription start.
+ * Advance phrase start up to the specified point.
+ * Two points before the new start are replaced by pauses
+ * serving as guards for backward lookups.
+ * Returns pointer to the phrase start.
  */
-static uint8_t *transcription_advance(uint8_t *transcription, uint8_t *point)
+static uint8_t *phrase_advance(uint8_t *start, uint8_t *point)
 {
-  if (point > (transcription + TRANSCRIPTION_START))
+  if (point > start)
     {
-      size_t length = (point < (transcription + TRANSCRIPTION_BUFFER_SIZE)) ? (transcription + TRANSCRIPTION_BUFFER_SIZE - point) : 0;
-      if (length)
-        memmove(transcription + TRANSCRIPTION_START, point, length);
-      memset(transcription + TRANSCRIPTION_START + length, 43, TRANSCRIPTION_BUFFER_SIZE - TRANSCRIPTION_START - length);
+      start = point;
+      start[-1] = 43;
+      start[-2] = 43;
     }
-  return transcription + TRANSCRIPTION_START;
+  return start;
+}
+
+/*
+ * Remove specified point from the clause transcription.
+ * The phrase part before this point is moved one point right,
+ * so the rest of the clause stays in place.
+ * Returns pointer to the new phrase start.
+ */
+static uint8_t *phrase_remove(uint8_t *start, uint8_t *point)
+{
+  memmove(start + 1, start, point - start);
+  return phrase_advance(start, start + 1);
 }
 
-/* Synthesize speech for specified clause phonetic transcription */
-static void synth_clause(uint8_t *transcription, ttscb_t *ttscb, uint8_t clause_type)
+/*
+ * Prepare sound script for the clause phonetic transcription
+ * residing in specified buffer from the phrase start.
+ */
+static void compose_clause(uint8_t *transcription, uint8_t *start, ttscb_t *ttscb, uint8_t clause_type)
 {
-  soundscript_t *soundscript = malloc(sizeof(soundscript_t));
-  if (soundscript)
+  soundscript_t *soundscript = &(ttscb->soundscript);
+  uint16_t end = transcription + TRANSCRIPTION_BUFFER_SIZE + TRANSCRIPTION_START - start;
+  memset(soundscript, 0, sizeof(soundscript_t));
+  soundscript->voice = (ttscb->flags & USE_ALTERNATIVE_VOICE) ? &female : &male;
+  soundscript->grains = &(ttscb->grains);
+  transcription = start - TRANSCRIPTION_START;
+  build_utterance(transcription, end, soundscript);
+  if (plan_time(transcription, end, ttscb->time_plan, &(ttscb->planner_workspace)))
+    apply_speechrate(soundscript, ttscb->timing, ttscb->time_plan);
+  apply_intonation(transcription, end, soundscript, ttscb->modulation, clause_type);
+}
+
+
+/* Global entry points */
+
+/* Compile phoncode sequence lists for phrase splitting */
+void seq_matcher_setup(seq_matcher_t *matcher)
+{
+  uint8_t list;
+
+  memset(matcher->nodes, 0, sizeof(seq_node_t));
+  matcher->size = 1;
+  for (list = 0; list < SEQLISTS; list++)
     {
-      time_plan_ptr_t draft;
-      memset(soundscript, 0, sizeof(soundscript_t));
-      soundscript->voice = (ttscb->flags & USE_ALTERNATIVE_VOICE) ? &female : &male;
-      build_utterance(transcription, soundscript);
-      draft = plan_time(transcription);
-      if (draft)
+      const uint8_t *item;
+      uint8_t order = 0;
+      for (item = seqlists[list]; item[0]; item += item[0] + 1)
         {
-          apply_speechrate(soundscript, &(ttscb->timing), draft);
-          free(draft);
+          uint8_t node = 0;
+          uint8_t i;
+          order++;
+          for (i = 1; i <= item[0]; i++)
+            {
+              uint8_t k;
+              for (k = matcher->nodes[node].child; k && (matcher->nodes[k].phoncode != item[i]); k = matcher->nodes[k].sibling);
+              if (!k)
+                {
+                  if (matcher->size >= SEQ_MATCHER_NODES)
+                    return;
+                  k = matcher->size++;
+                  memset(matcher->nodes + k, 0, sizeof(seq_node_t));
+                  matcher->nodes[k].phoncode = item[i];
+                  matcher->nodes[k].sibling = matcher->nodes[node].child;
+                  matcher->nodes[node].child = k;
+                }
+              node = k;
+            }
+          if (!matcher->nodes[node].order[list])
+            matcher->nodes[node].order[list] = order;
         }
-      apply_intonation(transcription, soundscript, &(ttscb->modulation), clause_type);
-      make_sound(soundscript, &(ttscb->wave_consumer));
-      free(soundscript);
     }
 }
 
-/* Synthesize speech clause by clause for specified phonetic transcription */
-static void synth(uint8_t *transcription, ttscb_t *ttscb)
+/*
+ * Finalize transcription of specified length passed by the transcriber
+ * and update transcription state accordingly.
+ *
+ * Returns non-zero value if there is something to synthesize.
+ */
+int synth_prepare(uint8_t *transcription, size_t length, ttscb_t *ttscb)
+{
+  if (length <= TRANSCRIPTION_START)
+    return 0;
+  if (ttscb->transcription_state.flags & CLAUSE_DONE)
+    ttscb->transcription_state.flags &= ~CLAUSE_DONE;
+  else
+    {
+      transcription[length] = 50;
+      ttscb->transcription_state.clause_type = 0;
+    }
+  return 1;
+}
+
+/* Start splitting specified transcription into phrases */
+void synth_start(uint8_t *transcription, ttscb_t *ttscb)
+{
+  ttscb->splitter.transcription = transcription;
+  ttscb->splitter.start = transcription + TRANSCRIPTION_START;
+  ttscb->splitter.tptr = transcription + TRANSCRIPTION_START;
+  ttscb->splitter.sptr = transcription + TRANSCRIPTION_START;
+  ttscb->splitter.count = 0;
+  ttscb->splitter.flags = 4;
+}
+
+/*
+ * Find next phrase in the transcription being split
+ * and prepare sound script for it.
+ *
+ * Returns non-zero value when the sound script is ready
+ * or zero when the transcription is exhausted.
+ */
+int synth_next(ttscb_t *ttscb)
 {
-  uint8_t *tptr;
-  uint8_t *sptr = transcription + TRANSCRIPTION_START;
-  uint8_t count = 0;
-  uint8_t flags = 4;
+  uint8_t *transcription = ttscb->splitter.transcription;
+  uint8_t *start = ttscb->splitter.start;
+  uint8_t *tptr = ttscb->splitter.tptr;
+  uint8_t *sptr = ttscb->splitter.sptr;
+  uint8_t count = ttscb->splitter.count;
+  uint8_t flags = ttscb->splitter.flags;
+  int ready = 0;
 
-  for (tptr = transcription + TRANSCRIPTION_START; tptr < transcription + TRANSCRIPTION_BUFFER_SIZE; tptr++)
+  for (; !ready && (tptr < transcription + TRANSCRIPTION_BUFFER_SIZE); tptr++)
     {
       if (flags & 4)
         {
           flags &= ~4;
-          if (test_list(tptr, seqlist1))
+          if (test_list(&(ttscb->matcher), tptr, 1))
             {
               if (flags & 1)
                 {
                   *sptr = 50;
-                  synth_clause(transcription, ttscb, 0);
-                  tptr = transcription_advance(transcription, tptr);
+                  compose_clause(transcription, start, ttscb, 0);
+                  ready = 1;
+                  tptr = start = phrase_advance(start, tptr);
                   count = 0;
                   flags &= ~1;
                   sptr = tptr;
@@ -241,17 +347,17 @@ static void synth(uint8_t *transcription, ttscb_t *ttscb)
               flags |= 2;
               continue;
             }
-          else if (test_list(tptr, seqlist2))
+          else if (test_list(&(ttscb->matcher), tptr, 2))
             {
               flags |= 2;
               continue;
             }
-          else if (test_list(tptr, seqlist3) &&
-                   (tptr > (transcription + TRANSCRIPTION_START)) &&
+          else if (test_list(&(ttscb->matcher), tptr, 3) &&
+                   (tptr > start) &&
                    (*(tptr - 1) == 43))
             {
-              sptr = --tptr;
-              shift(sptr);
+              start = phrase_remove(start, tptr - 1);
+              sptr = tptr;
               flags &= ~2;
               continue;
             }
@@ -260,16 +366,19 @@ static void synth(uint8_t *transcription, ttscb_t *ttscb)
         {
           if ((*tptr > 43) && (*tptr < 53))
             {
-              synth_clause(transcription, ttscb, ttscb->transcription_state.clause_type);
+              compose_clause(transcription, start, ttscb, ttscb->transcription_state.clause_type);
+              ready = 1;
+              tptr = transcription + TRANSCRIPTION_BUFFER_SIZE;
               break;
             }
         }
       else if (flags & 2)
         {
-          shift(tptr--);
+          start = phrase_remove(start, tptr);
+          sptr++;
           flags = 4;
         }
-      else if (((++count) != 3) || test_list(tptr + 1, seqlist1))
+      else if (((++count) != 3) || test_list(&(ttscb->matcher), tptr + 1, 1))
         {
           sptr = tptr;
           flags |= 5;
@@ -279,7 +388,7 @@ static void synth(uint8_t *transcription, ttscb_t *ttscb)
           uint8_t *next;
           uint8_t perspective = 20;
           uint8_t k;
-          if ((!test_list(tptr - 3, seqlist4)) && (!test_list(tptr - 2, seqlist5)))
+          if ((!test_list(&(ttscb->matcher), tptr - 3, 4)) && (!test_list(&(ttscb->matcher), tptr - 2, 5)))
             sptr = tptr;
           next = memchr(tptr + 1, 43, perspective);
           if (next)
@@ -288,11 +397,13 @@ static void synth(uint8_t *transcription, ttscb_t *ttscb)
           for (k = 1; k <= perspective; k++)
             if ((tptr[k] > 43) && (tptr[k] < 53))
               break;
-          if ((k > perspective) && !test_list(next, seqlist1))
+          if ((k > perspective) && !test_list(&(ttscb->matcher), next, 1))
             {
               *sptr = 50;
-              synth_clause(transcription, ttscb, 0);
-              tptr = transcription_advance(transcription, sptr + 1) - 1;
+              compose_clause(transcription, start, ttscb, 0);
+              ready = 1;
+              start = phrase_advance(start, sptr + 1);
+              tptr = start - 1;
               count = 0;
               flags &= ~2;
             }
@@ -300,10 +411,14 @@ static void synth(uint8_t *transcription, ttscb_t *ttscb)
           sptr = tptr;
         }
     }
-}
 
-
-/* Global entry point */
+  ttscb->splitter.start = start;
+  ttscb->splitter.tptr = tptr;
+  ttscb->splitter.sptr = sptr;
+  ttscb->splitter.count = count;
+  ttscb->splitter.flags = flags;
+  return ready;
+}
 
 /*
  * Transcription callback function.
@@ -317,16 +432,11 @@ static void synth(uint8_t *transcription, ttscb_t *ttscb)
 int synth_function(void *buffer, size_t length, void *user_data)
 {
   ttscb_t *ttscb = user_data;
-  if (length > TRANSCRIPTION_START)
+  if (synth_prepare(buffer, length, ttscb))
     {
-      if (ttscb->transcription_state.flags & CLAUSE_DONE)
-        ttscb->transcription_state.flags &= ~CLAUSE_DONE;
-      else
-        {
-          ((uint8_t *)buffer)[length] = 50;
-          ttscb->transcription_state.clause_type = 0;
-        }
-      synth(buffer, ttscb);
+      synth_start(buffer, ttscb);
+      while (synth_next(ttscb))
+        make_sound(&(ttscb->soundscript), &(ttscb->resampler), &(ttscb->wave_consumer), ttscb->sample_format);
     }
   return ttscb->wave_consumer.status;
 }
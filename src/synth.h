@@ -11,31 +11,105 @@
 #ifndef RU_TTS_SYNTH_H
 #define RU_TTS_SYNTH_H
 
+#include <stdint.h>
 #include <stdlib.h>
 
 #include "transcription.h"
 #include "sink.h"
 #include "timing.h"
 #include "modulation.h"
+#include "soundscript.h"
 
 
+/* Number of phoncode sequence lists used for phrase splitting */
+#define SEQLISTS 5
+
+/* Maximum number of the phoncode sequence matcher nodes */
+#define SEQ_MATCHER_NODES 256
+
+
+/*
+ * Phoncode sequence trie node. Children and siblings are referred
+ * by their indices. Zero index means none since it belongs to the root.
+ */
+typedef struct
+{
+  uint8_t phoncode;
+  uint8_t child;
+  uint8_t sibling;
+  uint8_t order[SEQLISTS]; /* Sequence position in each list plus 1 or 0 if absent */
+} seq_node_t;
+
+/* Phoncode sequence lists compiled into a trie */
+typedef struct
+{
+  size_t size;
+  seq_node_t nodes[SEQ_MATCHER_NODES];
+} seq_matcher_t;
+
+/* Transcription splitting state */
+typedef struct
+{
+  uint8_t *transcription;
+  uint8_t *start; /* Current phrase start */
+  uint8_t *tptr;
+  uint8_t *sptr;
+  uint8_t count;
+  uint8_t flags;
+} splitter_t;
+
 /* TTS control data structure */
 typedef struct
 {
   transcription_state_t transcription_state;
   sink_t wave_consumer;
   int flags;
+  int sample_format;
+
+  /* Output sample rate conversion */
+  resampler_t resampler;
 
   /* Speechrate parameters */
-  timing_t timing;
+  const timing_t *timing;
 
   /* Pitch and intonation control */
-  modulation_t modulation;
+  const modulation_t *modulation;
+
+  /* Working storage reused from clause to clause */
+  grain_cache_t grains;
+  seq_matcher_t matcher;
+  soundscript_t soundscript;
+  time_plan_t time_plan;
+  planner_workspace_t planner_workspace;
+  splitter_t splitter;
 } ttscb_t;
 
 
 /* Function prototypes */
 
+/* Compile phoncode sequence lists for phrase splitting */
+extern void seq_matcher_setup(seq_matcher_t *matcher);
+
+/*
+ * Finalize transcription of specified length passed by the transcriber
+ * and update transcription state accordingly.
+ *
+ * Returns non-zero value if there is something to synthesize.
+ */
+extern int synth_prepare(uint8_t *transcription, size_t length, ttscb_t *ttscb);
+
+/* Start splitting specified transcription into phrases */
+extern void synth_start(uint8_t *transcription, ttscb_t *ttscb);
+
+/*
+ * Find next phrase in the transcription being split
+ * and prepare sound script for it.
+ *
+ * Returns non-zero value when the sound script is ready
+ * or zero when the transcription is exhausted.
+ */
+extern int synth_next(ttscb_t *ttscb);
+
 /*
  * Transcription callback function.
  *
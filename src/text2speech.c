@@ -18,6 +18,216 @@
 #include "modulation.h"
 #include "transcription.h"
 #include "synth.h"
+#include "soundscript.h"
+#include "engine.h"
+
+
+/* Local subroutines */
+
+/* Initialize newly allocated engine */
+static void engine_init(ru_tts_engine_t *engine)
+{
+  engine->streaming = 0;
+  engine->pulling = 0;
+  engine->input.cache = NULL;
+  engine->ttscb.resampler.rate = 0;
+  grain_cache_reset(&(engine->ttscb.grains));
+  seq_matcher_setup(&(engine->ttscb.matcher));
+}
+
+/* Compile speech parameters */
+static void config_compile(ru_tts_compiled_conf_t *compiled, const ru_tts_conf_t *config)
+{
+  const voice_t *voice = (config->flags & USE_ALTERNATIVE_VOICE) ? &female : &male;
+
+  compiled->flags = config->flags;
+  compiled->sample_format = config->sample_format;
+  compiled->sample_rate = config->sample_rate;
+  compiled->first_chunk = config->first_chunk;
+
+  /* Adjust speech rate */
+  timing_setup(&(compiled->timing), config->speech_rate, config->general_gap_factor);
+  adjust_gaplen(&(compiled->timing), ',', config->comma_gap_factor);
+  adjust_gaplen(&(compiled->timing), '.', config->dot_gap_factor);
+  adjust_gaplen(&(compiled->timing), ';', config->semicolon_gap_factor);
+  adjust_gaplen(&(compiled->timing), ':', config->colon_gap_factor);
+  adjust_gaplen(&(compiled->timing), '?', config->question_gap_factor);
+  adjust_gaplen(&(compiled->timing), '!', config->exclamation_gap_factor);
+  adjust_gaplen(&(compiled->timing), '-', config->intonational_gap_factor);
+
+  /* Adjust voice pitch and intonation */
+  modulation_setup(&(compiled->modulation), config->voice_pitch, config->intonation, voice->pitch_factor);
+}
+
+/* Prepare engine for a new text transfer */
+static void engine_setup(ru_tts_engine_t *engine, const ru_tts_compiled_conf_t *config,
+                         void *wave_buffer, size_t wave_buffer_size,
+                         ru_tts_callback consumer, void *user_data)
+{
+  ttscb_t *ttscb = &(engine->ttscb);
+
+  /* Initialize data structures */
+  sink_setup(&(ttscb->wave_consumer), wave_buffer, wave_buffer_size, consumer, user_data);
+  sink_setup(&(engine->transcription_consumer), engine->transcription, TRANSCRIPTION_MAXLEN, synth_function, ttscb);
+  ttscb->wave_consumer.cancel = &(engine->cancelled);
+  engine->transcription_consumer.cancel = &(engine->cancelled);
+  engine->cancelled = 0;
+  input_reset(&(engine->input), config->flags);
+  engine->streaming = 0;
+  engine->pulling = 0;
+  ttscb->flags = config->flags;
+  ttscb->sample_format = config->sample_format;
+  ttscb->timing = &(config->timing);
+  ttscb->modulation = &(config->modulation);
+  if (resampler_setup(&(ttscb->resampler), config->sample_rate))
+    engine->cancelled = 1;
+
+  /* Output chunking policy */
+  ttscb->wave_consumer.coalesce = config->flags & COALESCE_CLAUSES;
+  if (config->first_chunk > 0)
+    {
+      size_t frame = sample_size(config->sample_format);
+      size_t rate = ttscb->resampler.active ? ttscb->resampler.rate : NATIVE_SAMPLE_RATE;
+      size_t duration = (config->first_chunk < 10000) ? config->first_chunk : 10000;
+      size_t samples = duration * rate / 1000;
+      ttscb->wave_consumer.chunk = (samples ? samples : 1) * frame;
+    }
+}
+
+/*
+ * Transcription callback used when the speech is pulled.
+ *
+ * Finalizes provided transcription and stores it in the engine log
+ * for further synthesis. Transcriptions already synthesized earlier
+ * are skipped. Returns non-zero value when the log is full.
+ */
+static int log_function(void *buffer, size_t length, void *user_data)
+{
+  ru_tts_engine_t *engine = user_data;
+  uint8_t *transcription = buffer;
+
+  if (engine->log_overflow)
+    return 1;
+
+  if (synth_prepare(transcription, length, &(engine->ttscb)))
+    {
+      if (engine->log_count >= engine->log_skip)
+        {
+          uint8_t *entry = engine->log + engine->log_length;
+          size_t n;
+          for (n = TRANSCRIPTION_BUFFER_SIZE; n && (transcription[n - 1] == 43); n--);
+          if ((engine->log_length + n + 3) > TRANSCRIPTION_LOG_SIZE)
+            {
+              engine->log_overflow = 1;
+              return 1;
+            }
+          entry[0] = n & 0xFF;
+          entry[1] = n >> 8;
+          entry[2] = engine->ttscb.transcription_state.clause_type;
+          memcpy(entry + 3, transcription, n);
+          engine->log_length += n + 3;
+        }
+      engine->log_count++;
+    }
+
+  return 0;
+}
+
+/*
+ * Transcribe next piece of the pulled text collecting result in the log.
+ *
+ * Pieces are cut at clause ends whenever possible. A longer clause
+ * is transcribed piece by piece as far as the known text allows,
+ * so it is split only where the transcription length demands.
+ * When the log is not large enough, the same piece is transcribed
+ * again and again from the saved state continuing from the first
+ * lost transcription.
+ *
+ * Returns zero when the text is exhausted.
+ */
+static int pull_piece(ru_tts_engine_t *engine)
+{
+  sink_t *consumer = &(engine->transcription_consumer);
+
+  if (engine->log_overflow)
+    {
+      engine->log_skip = engine->log_count;
+      engine->input = engine->piece_input;
+      engine->ttscb.transcription_state = engine->piece_state;
+    }
+  else
+    {
+      const char *text;
+      size_t length;
+
+      engine->source_offset += engine->piece_length;
+      if (engine->source_offset >= engine->source_length)
+        return 0;
+      text = engine->source + engine->source_offset;
+      length = engine->source_length - engine->source_offset;
+      engine->piece_partial = 0;
+      if (length > STREAM_BUFFER_SIZE)
+        {
+          size_t cut = 0;
+          size_t offset = engine->pull_started ? 0 : text_start(text, STREAM_BUFFER_SIZE, &(engine->input));
+          if (offset < STREAM_BUFFER_SIZE)
+            {
+              engine->pull_started = 1;
+              cut = clause_end(text, offset, STREAM_BUFFER_SIZE, &(engine->input));
+            }
+          engine->piece_partial = !cut;
+          length = cut ? cut : STREAM_BUFFER_SIZE;
+        }
+      engine->piece_length = length;
+      engine->piece_input = engine->input;
+      engine->piece_state = engine->ttscb.transcription_state;
+      engine->log_skip = 0;
+    }
+
+  /* The transcription buffer is shared with the log replay */
+  if (engine->piece_transcription_length)
+    {
+      memcpy(engine->transcription, engine->piece_transcription, TRANSCRIPTION_BUFFER_SIZE);
+      consumer->buffer_offset = engine->piece_transcription_length;
+    }
+
+  engine->log_overflow = 0;
+  engine->log_count = 0;
+  engine->log_length = 0;
+  engine->log_offset = 0;
+  consumer->status = 0;
+  if (engine->piece_partial)
+    {
+      size_t taken = process_text_part(engine->source + engine->source_offset, engine->piece_length,
+                                       &(engine->input), consumer);
+      if (taken && !engine->log_overflow)
+        engine->piece_length = taken;
+    }
+  else process_text(engine->source + engine->source_offset, engine->piece_length,
+                    &(engine->input), consumer);
+
+  /* Unfinished clause transcription is kept for the next piece */
+  if (!engine->log_overflow)
+    {
+      memcpy(engine->piece_transcription, engine->transcription, TRANSCRIPTION_BUFFER_SIZE);
+      engine->piece_transcription_length = consumer->buffer_offset;
+    }
+  return 1;
+}
+
+/* Restore next logged transcription and start splitting it into phrases */
+static void replay_transcription(ru_tts_engine_t *engine)
+{
+  const uint8_t *entry = engine->log + engine->log_offset;
+  size_t length = entry[0] | (((size_t)(entry[1])) << 8);
+
+  memset(engine->transcription, 43, TRANSCRIPTION_BUFFER_SIZE);
+  memcpy(engine->transcription, entry + 3, length);
+  engine->ttscb.transcription_state.clause_type = entry[2];
+  engine->log_offset += length + 3;
+  synth_start(engine->transcription, &(engine->ttscb));
+  engine->phrase_pending = 1;
+}
 
 
 /* Common entry points */
@@ -39,6 +249,35 @@ RUTTS_EXPORT void ru_tts_config_init(ru_tts_conf_t *config)
   config->exclamation_gap_factor = 100;
   config->intonational_gap_factor = 100;
   config->flags = DEC_SEP_POINT | DEC_SEP_COMMA;
+  config->sample_format = SAMPLE_FORMAT_S8;
+  config->sample_rate = NATIVE_SAMPLE_RATE;
+  config->first_chunk = 0;
+}
+
+/*
+ * Compile configuration for repeated use.
+ *
+ * Returns NULL when the sample rate is not supported
+ * or memory allocation fails.
+ */
+RUTTS_EXPORT ru_tts_compiled_conf_t *ru_tts_config_compile(const ru_tts_conf_t *config)
+{
+  ru_tts_compiled_conf_t *compiled;
+
+  if (!resampler_supported(config->sample_rate))
+    return NULL;
+  compiled = malloc(sizeof(ru_tts_compiled_conf_t));
+  if (compiled)
+    config_compile(compiled, config);
+  return compiled;
+}
+
+/*
+ * Destroy compiled configuration.
+ */
+RUTTS_EXPORT void ru_tts_compiled_conf_free(ru_tts_compiled_conf_t *compiled)
+{
+  free(compiled);
 }
 
 /*
@@ -46,7 +285,8 @@ RUTTS_EXPORT void ru_tts_config_init(ru_tts_conf_t *config)
  *
  * The first argument points to a configuration structure.
  * The second argument points to a zero-terminated string to transfer.
- * This string must contain a Russian text in koi8-r.
+ * This string must contain a Russian text in koi8-r
+ * or in UTF-8 when INPUT_UTF8 flag is set.
  * The next two arguments specify a buffer that will be used
  * by the library for delivering produced wave data
  * chunk by chunk to the consumer specified by the fourth argument.
@@ -58,33 +298,455 @@ RUTTS_EXPORT void ru_tts_transfer(const ru_tts_conf_t *config,
                                   const char *text, void *wave_buffer, size_t wave_buffer_size,
                                   ru_tts_callback consumer, void *user_data)
 {
-  uint8_t *transcription_buffer = malloc(TRANSCRIPTION_BUFFER_SIZE);
+  ru_tts_transfer_n(config, text, strlen(text), wave_buffer, wave_buffer_size, consumer, user_data);
+}
+
+/*
+ * Perform TTS transformation for the text of specified length.
+ *
+ * The text is not required to be zero-terminated and is never
+ * copied as a whole, so it can be taken directly from a memory
+ * mapped file of any size.
+ */
+RUTTS_EXPORT void ru_tts_transfer_n(const ru_tts_conf_t *config,
+                                    const char *text, size_t length,
+                                    void *wave_buffer, size_t wave_buffer_size,
+                                    ru_tts_callback consumer, void *user_data)
+{
+  ru_tts_engine_t *engine = ru_tts_engine_new();
+  if (engine)
+    {
+      ru_tts_engine_transfer_n(engine, config, text, length, wave_buffer, wave_buffer_size, consumer, user_data);
+      ru_tts_engine_free(engine);
+    }
+}
+
+/*
+ * Create new synthesis engine.
+ *
+ * Returns NULL when memory allocation fails.
+ */
+RUTTS_EXPORT ru_tts_engine_t *ru_tts_engine_new(void)
+{
+  ru_tts_engine_t *engine = malloc(sizeof(ru_tts_engine_t));
+  if (engine)
+    engine_init(engine);
+  return engine;
+}
+
+/*
+ * Destroy synthesis engine and release all its resources.
+ */
+RUTTS_EXPORT void ru_tts_engine_free(ru_tts_engine_t *engine)
+{
+  if (engine)
+    {
+      free(engine->input.cache);
+      free(engine);
+    }
+}
+
+/*
+ * Set the number of words whose transcriptions are kept
+ * by specified engine for reuse. The number is rounded up
+ * to a power of 2. Zero value disables the cache.
+ *
+ * Returns non-zero value when memory allocation fails.
+ * The cache is disabled in this case.
+ */
+RUTTS_EXPORT int ru_tts_engine_word_cache(ru_tts_engine_t *engine, size_t size)
+{
+  size_t capacity = 1;
+
+  free(engine->input.cache);
+  engine->input.cache = NULL;
+  if (!size)
+    return 0;
+
+  while (capacity < size)
+    {
+      capacity <<= 1;
+      if (!capacity)
+        return 1;
+    }
+  if (capacity > ((SIZE_MAX - sizeof(word_cache_t)) / sizeof(word_t)))
+    return 1;
+  engine->input.cache = malloc(sizeof(word_cache_t) + capacity * sizeof(word_t));
+  if (!engine->input.cache)
+    return 1;
+  engine->input.cache->size = capacity;
+  word_cache_reset(engine->input.cache);
+  return 0;
+}
+
+/*
+ * Get word cache statistics of specified engine, i.e. the numbers
+ * of words taken from the cache and those transcribed anew.
+ * Both are zero when the cache is disabled.
+ */
+RUTTS_EXPORT void ru_tts_engine_word_cache_stats(ru_tts_engine_t *engine,
+                                                 unsigned long *hits, unsigned long *misses)
+{
+  *hits = engine->input.cache ? engine->input.cache->hits : 0;
+  *misses = engine->input.cache ? engine->input.cache->misses : 0;
+}
+
+/*
+ * Perform TTS transformation for specified text by specified engine.
+ *
+ * All working buffers are taken from the engine,
+ * so no memory is allocated here.
+ */
+RUTTS_EXPORT void ru_tts_engine_transfer(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                                         const char *text, void *wave_buffer, size_t wave_buffer_size,
+                                         ru_tts_callback consumer, void *user_data)
+{
+  ru_tts_engine_transfer_n(engine, config, text, strlen(text), wave_buffer, wave_buffer_size, consumer, user_data);
+}
+
+/*
+ * Perform TTS transformation for the text of specified length
+ * by specified engine.
+ */
+RUTTS_EXPORT void ru_tts_engine_transfer_n(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                                           const char *text, size_t length,
+                                           void *wave_buffer, size_t wave_buffer_size,
+                                           ru_tts_callback consumer, void *user_data)
+{
+  config_compile(&(engine->conf), config);
+  ru_tts_engine_transfer_compiled(engine, &(engine->conf), text, length,
+                                  wave_buffer, wave_buffer_size, consumer, user_data);
+}
+
+/*
+ * Perform TTS transformation for the text of specified length
+ * by specified engine with compiled configuration.
+ */
+RUTTS_EXPORT void ru_tts_engine_transfer_compiled(ru_tts_engine_t *engine, const ru_tts_compiled_conf_t *config,
+                                                  const char *text, size_t length,
+                                                  void *wave_buffer, size_t wave_buffer_size,
+                                                  ru_tts_callback consumer, void *user_data)
+{
+  ttscb_t *ttscb = &(engine->ttscb);
+  engine_setup(engine, config, wave_buffer, wave_buffer_size, consumer, user_data);
+  process_text(text, length, &(engine->input), &(engine->transcription_consumer));
+  finish_sound(&(ttscb->resampler), &(ttscb->wave_consumer), ttscb->sample_format);
+}
+
+/*
+ * Perform TTS transformation for the text of specified length
+ * by specified engine rendering sound directly into the buffers
+ * lent by the consumer.
+ */
+RUTTS_EXPORT void ru_tts_engine_transfer_direct(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                                                const char *text, size_t length,
+                                                ru_tts_get_buffer_callback get_buffer,
+                                                ru_tts_commit_callback commit, void *user_data)
+{
+  config_compile(&(engine->conf), config);
+  ru_tts_engine_transfer_direct_compiled(engine, &(engine->conf), text, length,
+                                         get_buffer, commit, user_data);
+}
+
+/*
+ * Perform TTS transformation for the text of specified length
+ * by specified engine with compiled configuration rendering sound
+ * directly into the buffers lent by the consumer.
+ */
+RUTTS_EXPORT void ru_tts_engine_transfer_direct_compiled(ru_tts_engine_t *engine, const ru_tts_compiled_conf_t *config,
+                                                         const char *text, size_t length,
+                                                         ru_tts_get_buffer_callback get_buffer,
+                                                         ru_tts_commit_callback commit, void *user_data)
+{
+  ttscb_t *ttscb = &(engine->ttscb);
+  engine_setup(engine, config, NULL, 0, NULL, user_data);
+  ttscb->wave_consumer.get_buffer = get_buffer;
+  ttscb->wave_consumer.commit = commit;
+  process_text(text, length, &(engine->input), &(engine->transcription_consumer));
+  finish_sound(&(ttscb->resampler), &(ttscb->wave_consumer), ttscb->sample_format);
+}
+
+/*
+ * Start incremental text streaming by specified engine.
+ *
+ * All arguments have the same meaning as for ru_tts_engine_transfer().
+ */
+RUTTS_EXPORT void ru_tts_stream_begin(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                                      void *wave_buffer, size_t wave_buffer_size,
+                                      ru_tts_callback consumer, void *user_data)
+{
+  config_compile(&(engine->conf), config);
+  ru_tts_stream_begin_compiled(engine, &(engine->conf), wave_buffer, wave_buffer_size, consumer, user_data);
+}
+
+/*
+ * Start incremental text streaming by specified engine
+ * with compiled configuration.
+ */
+RUTTS_EXPORT void ru_tts_stream_begin_compiled(ru_tts_engine_t *engine, const ru_tts_compiled_conf_t *config,
+                                               void *wave_buffer, size_t wave_buffer_size,
+                                               ru_tts_callback consumer, void *user_data)
+{
+  engine_setup(engine, config, wave_buffer, wave_buffer_size, consumer, user_data);
+  engine->streaming = 1;
+  engine->stream_started = 0;
+  engine->stream_checked = 0;
+  engine->stream_length = 0;
+}
+
+/*
+ * Start incremental text streaming by specified engine
+ * rendering sound directly into the buffers lent by the consumer.
+ */
+RUTTS_EXPORT void ru_tts_stream_begin_direct(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                                             ru_tts_get_buffer_callback get_buffer,
+                                             ru_tts_commit_callback commit, void *user_data)
+{
+  config_compile(&(engine->conf), config);
+  ru_tts_stream_begin_direct_compiled(engine, &(engine->conf), get_buffer, commit, user_data);
+}
+
+/*
+ * Start incremental text streaming by specified engine
+ * with compiled configuration rendering sound directly
+ * into the buffers lent by the consumer.
+ */
+RUTTS_EXPORT void ru_tts_stream_begin_direct_compiled(ru_tts_engine_t *engine, const ru_tts_compiled_conf_t *config,
+                                                      ru_tts_get_buffer_callback get_buffer,
+                                                      ru_tts_commit_callback commit, void *user_data)
+{
+  ru_tts_stream_begin_compiled(engine, config, NULL, 0, NULL, user_data);
+  engine->ttscb.wave_consumer.get_buffer = get_buffer;
+  engine->ttscb.wave_consumer.commit = commit;
+}
+
+/*
+ * Push next text chunk to the stream.
+ *
+ * Every clause is synthesized as soon as its termination arrives.
+ * Returns non-zero value when the stream is stopped by the consumer.
+ */
+RUTTS_EXPORT int ru_tts_stream_push(ru_tts_engine_t *engine, const char *chunk, size_t length)
+{
+  sink_t *consumer = &(engine->transcription_consumer);
+
+  if (!engine->streaming)
+    return 1;
 
-  if (transcription_buffer)
+  while (length && !consumer->status)
     {
-      ttscb_t ttscb;
-      sink_t transcription_consumer;
-
-      /* Initialize data structures */
-      sink_setup(&(ttscb.wave_consumer), wave_buffer, wave_buffer_size, consumer, user_data);
-      sink_setup(&transcription_consumer, transcription_buffer, TRANSCRIPTION_MAXLEN, synth_function, &ttscb);
-      ttscb.flags = config->flags;
-
-      /* Adjust speech rate */
-      timing_setup(&(ttscb.timing), config->speech_rate, config->general_gap_factor);
-      adjust_gaplen(&(ttscb.timing), ',', config->comma_gap_factor);
-      adjust_gaplen(&(ttscb.timing), '.', config->dot_gap_factor);
-      adjust_gaplen(&(ttscb.timing), ';', config->semicolon_gap_factor);
-      adjust_gaplen(&(ttscb.timing), ':', config->colon_gap_factor);
-      adjust_gaplen(&(ttscb.timing), '?', config->question_gap_factor);
-      adjust_gaplen(&(ttscb.timing), '!', config->exclamation_gap_factor);
-      adjust_gaplen(&(ttscb.timing), '-', config->intonational_gap_factor);
-
-      /* Adjust voice pitch and intonation */
-      modulation_setup(&(ttscb.modulation), config->voice_pitch, config->intonation);
-
-      /* Process text */
-      process_text(text, &transcription_consumer);
-      free(transcription_buffer);
+      size_t n = STREAM_BUFFER_SIZE - engine->stream_length;
+      size_t cut = 0;
+
+      if (n > length)
+        n = length;
+      memcpy(engine->stream + engine->stream_length, chunk, n);
+      engine->stream_length += n;
+      chunk += n;
+      length -= n;
+
+      /* Nothing can be spoken until the first letter or digit */
+      if (!engine->stream_started)
+        {
+          engine->stream_checked += text_start(engine->stream + engine->stream_checked,
+                                               engine->stream_length - engine->stream_checked,
+                                               &(engine->input));
+          engine->stream_started = engine->stream_checked < engine->stream_length;
+        }
+
+      if (engine->stream_started)
+        cut = clause_end(engine->stream, engine->stream_checked,
+                         engine->stream_length, &(engine->input));
+
+      if (cut)
+        process_text(engine->stream, cut, &(engine->input), consumer);
+
+      /* Too long clause is transcribed as far as its known text allows */
+      else if (engine->stream_length == STREAM_BUFFER_SIZE)
+        {
+          cut = process_text_part(engine->stream, STREAM_BUFFER_SIZE, &(engine->input), consumer);
+
+          /* The text having nothing to speak is dropped */
+          if (!cut)
+            cut = STREAM_BUFFER_SIZE;
+        }
+
+      if (cut)
+        {
+          engine->stream_length -= cut;
+          memmove(engine->stream, engine->stream + cut, engine->stream_length);
+          engine->stream_checked = 0;
+          engine->stream_started = 1;
+        }
+
+      /* Clause termination pair may be not known yet after trailing blanks */
+      if (engine->stream_started)
+        {
+          size_t i;
+          for (i = engine->stream_length; (i > engine->stream_checked) &&
+                 ((engine->stream[i - 1] == ' ') || (engine->stream[i - 1] == '\t')); i--);
+          if (i > (engine->stream_checked + 1))
+            engine->stream_checked = i - 1;
+        }
     }
+
+  return consumer->status;
+}
+
+/*
+ * Synthesize the rest of streamed text and finish the stream.
+ * Returns non-zero value when the stream is stopped by the consumer.
+ */
+RUTTS_EXPORT int ru_tts_stream_finish(ru_tts_engine_t *engine)
+{
+  ttscb_t *ttscb = &(engine->ttscb);
+  sink_t *consumer = &(engine->transcription_consumer);
+
+  if (!engine->streaming)
+    return 1;
+
+  if (!consumer->status)
+    process_text(engine->stream, engine->stream_length, &(engine->input), consumer);
+  finish_sound(&(ttscb->resampler), &(ttscb->wave_consumer), ttscb->sample_format);
+  engine->streaming = 0;
+  engine->stream_length = 0;
+  return consumer->status;
+}
+
+/*
+ * Prepare specified engine for pulling speech for the text
+ * of specified length via ru_tts_read().
+ *
+ * The text is not copied, so it must remain available
+ * until the speech is over.
+ */
+RUTTS_EXPORT void ru_tts_read_begin(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                                    const char *text, size_t length)
+{
+  config_compile(&(engine->conf), config);
+  ru_tts_read_begin_compiled(engine, &(engine->conf), text, length);
+}
+
+/*
+ * Prepare specified engine for pulling speech with compiled
+ * configuration for the text of specified length via ru_tts_read().
+ */
+RUTTS_EXPORT void ru_tts_read_begin_compiled(ru_tts_engine_t *engine, const ru_tts_compiled_conf_t *config,
+                                             const char *text, size_t length)
+{
+  engine_setup(engine, config, NULL, 0, NULL, NULL);
+  engine->transcription_consumer.function = log_function;
+  engine->pulling = 1;
+  engine->pull_started = 0;
+  engine->phrase_pending = 0;
+  engine->sound_pending = 0;
+  engine->text_done = 0;
+  engine->source = text;
+  engine->source_length = length;
+  engine->source_offset = 0;
+  engine->piece_length = 0;
+  engine->piece_partial = 0;
+  engine->piece_transcription_length = 0;
+  engine->log_overflow = 0;
+  engine->log_length = 0;
+  engine->log_offset = 0;
+}
+
+/*
+ * Get next portion of speech for the text specified by ru_tts_read_begin().
+ *
+ * Synthesis resumes exactly where it has been stopped by the previous call
+ * and proceeds only as far as needed to fill the buffer with specified
+ * number of samples. No memory is allocated here, so this function
+ * may be called directly from a real-time audio callback.
+ *
+ * Returns number of samples stored in the buffer. The value less than
+ * requested means that the speech is over.
+ */
+RUTTS_EXPORT size_t ru_tts_read(ru_tts_engine_t *engine, void *buffer, size_t nsamples)
+{
+  ttscb_t *ttscb = &(engine->ttscb);
+  resampler_t *resampler = &(ttscb->resampler);
+  size_t frame = sample_size(ttscb->sample_format);
+  size_t n = 0;
+
+  if (engine->cancelled)
+    engine->pulling = 0;
+
+  while (engine->pulling && (n < nsamples))
+    if (engine->sound_pending)
+      {
+        size_t room = nsamples - n;
+        void *output = (uint8_t *)buffer + n * frame;
+        if (!resampler->active)
+          {
+            size_t count = sound_produce(&(ttscb->soundscript), &(engine->producer), output, room);
+            n += count;
+            if (count < room)
+              engine->sound_pending = 0;
+          }
+        else if (engine->slice_offset < engine->slice_length)
+          {
+            size_t used = engine->slice_length - engine->slice_offset;
+            n += resample(resampler, engine->slice + engine->slice_offset, &used,
+                          output, room, ttscb->sample_format);
+            engine->slice_offset += used;
+          }
+        else if (engine->slice_length < SOUND_SLICE)
+          engine->sound_pending = 0;
+        else
+          {
+            engine->slice_length = sound_produce(&(ttscb->soundscript), &(engine->producer),
+                                                 engine->slice, SOUND_SLICE);
+            engine->slice_offset = 0;
+          }
+      }
+    else if (engine->phrase_pending)
+      {
+        engine->phrase_pending = synth_next(ttscb);
+        if (engine->phrase_pending)
+          {
+            if (resampler->active)
+              {
+                sound_start(&(engine->producer), SAMPLE_FORMAT_S8);
+                engine->slice_length = SOUND_SLICE;
+                engine->slice_offset = SOUND_SLICE;
+              }
+            else sound_start(&(engine->producer), ttscb->sample_format);
+            engine->sound_pending = 1;
+          }
+      }
+    else if (engine->log_offset < engine->log_length)
+      replay_transcription(engine);
+    else if (engine->text_done)
+      {
+        /* Pass the rest of the sound delayed by the resampler */
+        size_t room = nsamples - n;
+        size_t used = 0;
+        size_t count = resample(resampler, NULL, &used, (uint8_t *)buffer + n * frame,
+                                room, ttscb->sample_format);
+        n += count;
+        if (count < room)
+          engine->pulling = 0;
+      }
+    else if (!pull_piece(engine))
+      {
+        resampler_finish(resampler);
+        engine->text_done = 1;
+      }
+
+  return n;
+}
+
+/*
+ * Cancel speech synthesis currently performed by specified engine.
+ *
+ * This function may be called from any thread or signal handler.
+ * The synthesis stops as soon as possible without passing
+ * any more data to the consumer. Pulled speech is finished as well.
+ * Transfers started afterwards are not affected.
+ */
+RUTTS_EXPORT void ru_tts_cancel(ru_tts_engine_t *engine)
+{
+  engine->cancelled = 1;
 }
@@ -21,56 +21,71 @@
 #define DISCRIMINANT(x, y) ((x != y) ? ((x != 1) ? 3 : 2) : 1)
 
 
-/* Scratch data structure */
-typedef struct
-{
-  uint8_t value;
-  uint8_t delta;
-  uint8_t flag;
-  uint8_t ndx1;
-  uint8_t ndx2;
-  uint8_t itercount;
-  uint8_t area[5][50];
-} workspace_t;
-
-
 /* Static data */
 
-/* Phoncode sets for classification */
-static const uint8_t set0[] = { 44, 45, 48, 49, 46, 47, 50, 51 };
-static const uint8_t set1[] = { 10, 15, 18, 16, 19, 8, 13, 14, 17 };
-static const uint8_t set2[] = { 6, 11, 7, 12, 9 };
-static const uint8_t set3[] = { 20, 23, 21, 24, 22, 25 };
-static const uint8_t set4[] = { 34, 37, 35, 38, 32, 36, 39, 33, 40, 41 };
-static const uint8_t set5[] = { 26, 29, 27, 30, 28, 31 };
-static const uint8_t set6[] = { 10, 14, 17, 15, 18, 16, 19, 8, 13 };
-static const uint8_t set7[] = { 6, 11, 7, 12, 9, 20, 23, 21, 24, 22, 25 };
-static const uint8_t set8[] = { 20, 23, 26, 29, 15, 18, 6, 11, 34, 37 };
-static const uint8_t set9[] = { 21, 24, 27, 30, 14, 17, 16, 19, 7, 12, 35, 38, 36, 39, 32, 33, 9 };
-static const uint8_t set10[] = { 22, 25, 28, 31, 40, 41 };
+/*
+ * Phoncode properties for classification.
+ *
+ * Bits 0-2 hold the phoncode rank (1-5 or 0 if none). Following bits
+ * mark members of the phoncode sets 6-10 and, for the sets 8-10,
+ * members of their leading four items. Clause boundaries (set 0)
+ * carry their kind in bits 12-13.
+ *
+ * The table is derived from these sets (the order is significant):
+ *
+ * set0: 44, 45, 48, 49, 46, 47, 50, 51 (only first four are distinct kinds)
+ * set1: 10, 15, 18, 16, 19, 8, 13, 14, 17 (rank 1)
+ * set2: 6, 11, 7, 12, 9 (rank 2)
+ * set3: 20, 23, 21, 24, 22, 25 (rank 3)
+ * set4: 34, 37, 35, 38, 32, 36, 39, 33, 40, 41 (rank 4)
+ * set5: 26, 29, 27, 30, 28, 31 (rank 5)
+ * set6: 10, 14, 17, 15, 18, 16, 19, 8, 13
+ * set7: 6, 11, 7, 12, 9, 20, 23, 21, 24, 22, 25
+ * set8: 20, 23, 26, 29, 15, 18, 6, 11, 34, 37
+ * set9: 21, 24, 27, 30, 14, 17, 16, 19, 7, 12, 35, 38, 36, 39, 32, 33, 9
+ * set10: 22, 25, 28, 31, 40, 41
+ */
+const uint16_t phoncode_properties[256] =
+  {
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0052, 0x0112,
+    0x0009, 0x0112, 0x0009, 0x0052, 0x0112, 0x0009, 0x0109, 0x0049,
+    0x0109, 0x0109, 0x0049, 0x0109, 0x0073, 0x0193, 0x0613, 0x0073,
+    0x0193, 0x0613, 0x0065, 0x0185, 0x0605, 0x0065, 0x0185, 0x0605,
+    0x0104, 0x0104, 0x0044, 0x0104, 0x0104, 0x0044, 0x0104, 0x0104,
+    0x0404, 0x0404, 0x0000, 0x0000, 0x0800, 0x1800, 0x0800, 0x0800,
+    0x2800, 0x3800, 0x0800, 0x0800, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+    0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000
+  };
 
 
 /* Local subroutines */
 
-/* Define rank for specified phoncode */
-static uint8_t rank(uint8_t phoncode)
-{
-  uint8_t rc = 0;
-  if (memchr(set1, phoncode, sizeof(set1)))
-    rc = 1;
-  else if (memchr(set2, phoncode, sizeof(set2)))
-    rc = 2;
-  else if (memchr(set3, phoncode, sizeof(set3)))
-    rc = 3;
-  else if (memchr(set4, phoncode, sizeof(set4)))
-    rc = 4;
-  else if (memchr(set5, phoncode, sizeof(set5)))
-    rc = 5;
-  return rc;
-}
-
 /* Prepare next iteration */
-static void next_iteration(workspace_t *scratch)
+static void next_iteration(planner_workspace_t *scratch)
 {
   scratch->area[3][++(scratch->ndx2)] = scratch->value;
   scratch->value = 0;
@@ -84,57 +99,48 @@ static void next_iteration(workspace_t *scratch)
 /* Global entry point */
 
 /*
- * Fill timing draft for specified phonetic transcription.
+ * Fill timing draft for specified phonetic transcription
+ * taken from TRANSCRIPTION_START up to the specified end.
  *
  * This draft is used for speechrate applying.
  *
+ * The scratch argument points to the working space
+ * provided by the caller.
+ *
  * Returns non-zero value if the draft is successively filled.
  */
-time_plan_ptr_t plan_time(uint8_t *transcription)
+int plan_time(uint8_t *transcription, uint16_t end, time_plan_ptr_t draft, planner_workspace_t *scratch)
 {
-  time_plan_ptr_t draft;
-  workspace_t *scratch;
   uint16_t i;
   uint8_t check_prev_trigger = 0;
   uint8_t check_prev = 0;
   uint8_t skip_itercount = 1;
   uint8_t nitems = 0;
 
-  draft = calloc(TIME_PLAN_ROWS, sizeof(*draft));
-  if (!draft)
-    return NULL;
-
-  scratch = malloc(sizeof(workspace_t));
-  if (!scratch)
-    {
-      free(draft);
-      return NULL;
-    }
-  memset(scratch, 0, sizeof(workspace_t));
+  memset(draft, 0, TIME_PLAN_ROWS * sizeof(*draft));
+  memset(scratch, 0, sizeof(planner_workspace_t));
 
-  for (i = TRANSCRIPTION_START; i < TRANSCRIPTION_BUFFER_SIZE; i++)
+  for (i = TRANSCRIPTION_START; i < end; i++)
     if (transcription[i] > 5)
       {
         if (transcription[i] != 43)
           {
-            uint8_t *found = memchr(set0, transcription[i], sizeof(set0));
+            uint16_t property = phoncode_properties[transcription[i]];
 
-            if (found)
+            if (property & BOUNDARY)
               {
                 uint8_t values[TIME_PLAN_ROWS];
                 uint8_t restart = 0;
                 uint8_t setcase = 0;
                 uint8_t tmp = 0;
                 uint8_t m = 1;
-                uint8_t k = found - set0;
+                uint8_t k = BOUNDARY_KIND(property);
                 uint8_t j;
                 uint8_t ndx1 = 1;
                 uint8_t ndx2 =1;
                 uint8_t item;
 
                 memset(values, 0, TIME_PLAN_ROWS);
-                if (k > 3)
-                  k = 0;
                 values[8] = k + 1;
                 next_iteration(scratch);
                 skip_itercount = 1;
@@ -211,9 +217,9 @@ time_plan_ptr_t plan_time(uint8_t *transcription)
                                 while (1)
                                   {
                                     phoncode_cur = transcription[++i];
-                                    if ((phoncode_cur < 6) || memchr(set6, phoncode_cur, sizeof(set6)))
+                                    if ((phoncode_cur < 6) || (phoncode_properties[phoncode_cur] & SET6))
                                       setcase = 2;
-                                    else if (memchr(set7, phoncode_cur, sizeof(set7)))
+                                    else if (phoncode_properties[phoncode_cur] & SET7)
                                       setcase = 3;
                                     else if ((phoncode_cur > 25) && (phoncode_cur < 42))
                                       setcase = 4;
@@ -247,9 +253,9 @@ time_plan_ptr_t plan_time(uint8_t *transcription)
                                     (phoncode_prev < 43) &&
                                     (phoncode_prev == phoncode_cur))
                                   draft[1][m] = 5;
-                                else if ((memchr(set8, phoncode_prev, 4) && memchr(set8, phoncode_cur, sizeof(set8))) ||
-                                         (memchr(set9, phoncode_prev, 4) && memchr(set9, phoncode_cur, sizeof(set9))) ||
-                                         (memchr(set10, phoncode_prev, 4) && memchr(set10, phoncode_cur, sizeof(set10))))
+                                else if (((phoncode_properties[phoncode_prev] & SET8_HEAD) && (phoncode_properties[phoncode_cur] & SET8)) ||
+                                         ((phoncode_properties[phoncode_prev] & SET9_HEAD) && (phoncode_properties[phoncode_cur] & SET9)) ||
+                                         ((phoncode_properties[phoncode_prev] & SET10_HEAD) && (phoncode_properties[phoncode_cur] & SET10)))
                                   draft[1][m] = 4;
                                 else if (values[1])
                                   draft[1][m] = values[1] - 1;
@@ -259,8 +265,7 @@ time_plan_ptr_t plan_time(uint8_t *transcription)
                           }
                       }
                   }
-                free(scratch);
-                return draft;
+                return 1;
               }
             else
               {
@@ -272,10 +277,10 @@ time_plan_ptr_t plan_time(uint8_t *transcription)
                         uint8_t rank_prev;
                         uint8_t rank_cur;
                         check_prev = 0;
-                        rank_prev = rank(transcription[i - 1]);
+                        rank_prev = phoncode_properties[transcription[i - 1]] & RANK_MASK;
                         if (!rank_prev)
                           break;
-                        rank_cur = rank(transcription[i]);
+                        rank_cur = phoncode_properties[transcription[i]] & RANK_MASK;
                         if (!rank_cur)
                           break;
                         if (rank_prev <= rank_cur)
@@ -329,7 +334,5 @@ time_plan_ptr_t plan_time(uint8_t *transcription)
         check_prev = 0;
       }
 
-  free(scratch);
-  free(draft);
-  return NULL;
+  return 0;
 }
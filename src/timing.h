@@ -13,16 +13,35 @@
 
 #include <stdint.h>
 
+#include "voice.h"
+
 
 /* Number of punctuations treated as clause separators */
 #define CLAUSE_SEPARATORS 7
 
+/* Sounds with durations formed by the time plan */
+#define VOICED_SOUNDS 189
+
+/* Reciprocal precision for the speech rate division */
+#define RATE_SHIFT 32
+
 
+/*
+ * Speech rate control data.
+ *
+ * Duration coefficients and pause lengths are precomputed
+ * for every sound id, so applying the speech rate to a sound
+ * takes only table lookups, multiplications and shifts.
+ */
 typedef struct
 {
   uint16_t rate_factor;
   uint8_t gap_factor;
   uint8_t gaplen[CLAUSE_SEPARATORS];
+  uint64_t reciprocal; /* 100 / rate_factor scaled by 2^RATE_SHIFT */
+  uint32_t scale[VOICED_SOUNDS]; /* Time plan sum coefficient */
+  uint32_t offset[VOICED_SOUNDS]; /* Bottom duration with rounding */
+  uint16_t pauses[VOICE_DIMENSION - VOICED_SOUNDS]; /* Final durations */
 } timing_t;
 
 
@@ -12,6 +12,12 @@
 #include <stdlib.h>
 #include <string.h>
 
+#if defined(__GNUC__) && (defined(__i386__) || defined(__x86_64__))
+#define PLAIN_RUN_SSSE3
+#include <tmmintrin.h>
+#endif
+
+#include "ru_tts.h"
 #include "transcription.h"
 #include "numerics.h"
 #include "sink.h"
@@ -20,13 +26,20 @@
 /* Internal flags */
 #define CLAUSE_START 0x10
 #define WEAK_STRESS 0x20
+#define UTF8_TEXT 0x40
+#define MORE_TEXT 0x80 /* Source text is continued later */
+#define TEXT_PAUSED 0x08 /* Transcription waits for the text continuation */
+#define CLAUSE_PAUSED 0x04 /* The same in the middle of a clause */
 
 
 /* Local macros */
 #define PAIR(a, b) ((((uint16_t)(a)) << 8) | (((uint16_t)(b)) & 0xFF))
-#ifdef _MSC_VER
-#define strdup(p) _strdup(p)
-#endif
+#define IS_WORD_CHAR(c) (((c) >= 'A') || ((c) == '+') || ((c) == '='))
+
+/* Word cache key context flags */
+#define LEFT_SEPARATED 0x01 /* Word is preceded by a separator or nothing */
+#define SINGLE_ALLOWED 0x02 /* Single letter blocks are allowed */
+#define WEAK_STRESSED 0x04 /* Weak stress flag is set */
 
 
 /* Main punctuations */
@@ -38,20 +51,141 @@ const char *punctuations = ",.;:?!-";
 /* Special symbols */
 static const char *symbols = " ,.;:?!()-+=\"$%&*";
 
-/* Accepted characters list */
-static const char *char_list = "TNRLMDPZG^JH_WC[FOE\\UQYX]`a'-*()%\"/&$><@+=";
-
-/* Special symbols treated as blanks */
-static const char *blanks = "\t#'/<>@";
+/* Dental consonants softened before soft ones */
+static const char *ndts = "NDTS";
 
-/* Internal letters representation table */
-static const char *letters = "`ABCDEFGHIJKLMNOPQRSTU_VXYZWa[^]+=";
+/*
+ * Classes of normalized text characters.
+ *
+ * Bits 0-12 mark membership of the character classes, bits 16-21 hold
+ * the character index in the accepted characters list and bits 24-28
+ * hold its index in the consonants or vocalics list. Zero character
+ * marking the text end is treated as voiced.
+ *
+ * The table is derived from these lists (the order is significant):
+ *
+ * accepted: TNRLMDPZG^JH_WC[FOE\UQYX]`a'-*()%"/&$><@+=
+ * consonants: JMNRL^HC[WSPFTK_ZBVDG (unvoiced are 5-14)
+ * vocalics: `EI\QUaYOA (front are 0-4, iotated are `QE\)
+ * voiced: BGD_Z
+ * pauses: the first 7 special symbols (terminators are 1-6)
+ * separators: the first 13 special symbols
+ * symbols: all the special symbols
+ * letters: `ABCDEFGHIJKLMNOPQRSTU_VXYZWa[^]+=
+ */
+const uint32_t char_classes[256] =
+  {
+    0x00000100, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000805, 0x00000807, 0x00210A04, 0x00000000,
+    0x00240A00, 0x00200A00, 0x00230A00, 0x001B0200,
+    0x001E0A04, 0x001F0A04, 0x001D0A00, 0x00281A04,
+    0x00000807, 0x001C0A04, 0x00000807, 0x00220200,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000807, 0x00000807,
+    0x00260200, 0x00291A04, 0x00250200, 0x00000807,
+    0x00270200, 0x09001008, 0x11001500, 0x070E1680,
+    0x13051740, 0x01121238, 0x0C101680, 0x14081700,
+    0x060B1680, 0x02001018, 0x000A1600, 0x0E001480,
+    0x04031600, 0x01041600, 0x02011640, 0x08111208,
+    0x0B061680, 0x04151238, 0x03021600, 0x0A0014C0,
+    0x0D0016C0, 0x05141208, 0x12001400, 0x090D1680,
+    0x00171200, 0x07161208, 0x10071700, 0x080F1680,
+    0x03130238, 0x00181200, 0x05091680, 0x0F0C1700,
+    0x00191238, 0x061A1208, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000,
+    0x00000000, 0x00000000, 0x00000000, 0x00000000
+  };
 
-/* Phonetic letter classes */
-static const char *consonants = "JMNRL^HC[WSPFTK_ZBVDG";
-static const char *vocalics = "`EI\\QUaYOA";
-static const char *ndts = "NDTS";
-static const char *bgdjz = "BGD_Z";
+/*
+ * Internal representation of source text characters.
+ *
+ * Latin letters are converted to upper case replacing those
+ * having no counterpart in the internal representation, koi8-r
+ * letters are mapped to the internal letters regardless
+ * of the case and the symbols "\t#'/<>@" are treated as blanks.
+ * Line ends are unified. Characters that should be ignored
+ * are mapped to 0.
+ */
+static const uint8_t normal_chars[256] =
+  {
+    ' ', 0, 0, 0, 0, 0, 0, 0,
+    0, ' ', '\r', 0, 0, '\r', 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    ' ', '!', '"', ' ', '$', '%', '&', ' ',
+    '(', ')', '*', '+', ',', '-', '.', ' ',
+    '0', '1', '2', '3', '4', '5', '6', '7',
+    '8', '9', ':', ';', ' ', '=', ' ', '?',
+    ' ', 'A', 'B', 'C', 'D', 'E', 'F', 'G',
+    'H', 'I', '_', 'K', 'L', 'M', 'N', 'O',
+    'P', 'K', 'R', 'S', 'T', 'U', 'V', 'U',
+    'K', 'I', 'Z', 0, 0, 0, 0, 0,
+    0, 'A', 'B', 'C', 'D', 'E', 'F', 'G',
+    'H', 'I', '_', 'K', 'L', 'M', 'N', 'O',
+    'P', 'K', 'R', 'S', 'T', 'U', 'V', 'U',
+    'K', 'I', 'Z', 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, '\\', 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    0, 0, 0, '\\', 0, 0, 0, 0,
+    0, 0, 0, 0, 0, 0, 0, 0,
+    '`', 'A', 'B', 'C', 'D', 'E', 'F', 'G',
+    'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O',
+    'P', 'Q', 'R', 'S', 'T', 'U', '_', 'V',
+    'X', 'Y', 'Z', 'W', 'a', '[', '^', ']',
+    '`', 'A', 'B', 'C', 'D', 'E', 'F', 'G',
+    'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O',
+    'P', 'Q', 'R', 'S', 'T', 'U', '_', 'V',
+    'X', 'Y', 'Z', 'W', 'a', '[', '^', ']'
+  };
 
 /* Phoncodes */
 static const uint8_t vocal_phoncodes[] = { 0, 3, 4, 1, 2 };
@@ -127,6 +261,32 @@ static const uint8_t transcription_blocks[] =
     3, 27, 35, 2 /* 51: TSA */
   };
 
+/*
+ * Suffixes transcribed specially in accented words.
+ *
+ * The first block is used after a consonant and the second one
+ * otherwise. Rules of the same length are listed in the order
+ * of precedence.
+ */
+static const struct
+{
+  const char *suffix;
+  uint8_t length;
+  uint8_t blocks[2];
+  char last_char;
+} suffix_rules[] =
+  {
+    { NULL, 0, { 0, 0 }, 0 },
+    { "O+GO", 4, { 42, 42 }, 'A' },
+    { "E+GO", 4, { 45, 48 }, 'A' },
+    { "EGO+", 4, { 46, 49 }, 'O' },
+    { "OGO+", 4, { 43, 43 }, 'O' },
+    { "TXSQ", 4, { 51, 51 }, 'A' },
+    { "EGO", 3, { 47, 50 }, 'A' },
+    { "OGO", 3, { 44, 44 }, 'A' },
+    { "TSQ", 3, { 51, 51 }, 'A' }
+  };
+
 /* Clause termination pairs */
 static const uint16_t clause_terminations[] =
   {
@@ -186,7 +346,7 @@ static int detect_suffix(input_t *input, transcription_state_t *transcription, c
         else break;
       }
 
-  if ((i == n) && (((input->start + n) >= input->end) || !strchr(letters, input->start[n])))
+  if ((i == n) && (((input->start + n) >= input->end) || !(char_classes[(unsigned char)input->start[n]] & LETTER)))
     {
       input->start += n - 1;
       rc = 1;
@@ -195,6 +355,135 @@ static int detect_suffix(input_t *input, transcription_state_t *transcription, c
   return rc;
 }
 
+/*
+ * Find the suffix rule of specified length
+ * matching the text at specified position.
+ *
+ * Returns the rule number or 0 if nothing matched.
+ */
+static uint8_t match_suffix(const char *s, uint8_t length)
+{
+  uint8_t rule, i;
+
+  for (rule = 1; rule < (sizeof(suffix_rules) / sizeof(suffix_rules[0])); rule++)
+    if (suffix_rules[rule].length == length)
+      {
+        const char *suffix = suffix_rules[rule].suffix;
+        for (i = 0; (i < length) && ((s[i] == suffix[i]) || ((suffix[i] == '+') && (s[i] == '='))); i++);
+        if (i == length)
+          return rule;
+      }
+  return 0;
+}
+
+/*
+ * Get the right context class of a word by the character
+ * following it. The class distinguishes only the characters
+ * transcription of the word's last consonant depends on.
+ */
+static uint8_t following_class(const char *s)
+{
+  unsigned char c = s[0];
+
+  if (!c || (char_classes[c] & TERMINATOR))
+    return 1;
+  if (c != ' ')
+    return 2;
+
+  /* The next word may affect the last consonant voicing */
+  c = s[1];
+  if ((c == 'W') || (c == '_'))
+    return c;
+  if (char_classes[c] & UNVOICED)
+    return 3;
+  if (char_classes[c] & VOICED)
+    return 4;
+  return 5;
+}
+
+/*
+ * Prepare the cache key for the word starting at the current
+ * input position. Words reaching the not yet normalized text
+ * and those affecting transcription before them are not cached.
+ *
+ * Returns non-zero value on success.
+ */
+static int word_key(input_t *input, sink_t *consumer, unsigned char last_char, word_t *key)
+{
+  transcription_state_t *transcription = consumer->user_data;
+  const char *s;
+  uint8_t n;
+
+  if ((input->start > input->text) && IS_WORD_CHAR((unsigned char)input->start[-1]))
+    return 0;
+  for (n = 0; IS_WORD_CHAR((unsigned char)input->start[n]); n++)
+    if (n >= WORD_MAX_LENGTH)
+      return 0;
+  s = input->start + n;
+  if (((s + 1) >= input->end) && (input->source < input->source_end))
+    return 0;
+  if (last_char && strchr(ndts, last_char) && (char_classes[(unsigned char)input->start[0]] & DENTAL))
+    return 0;
+
+  key->length = n;
+  memcpy(key->word, input->start, n);
+  key->context = 0;
+  if ((input->start == input->text) || (char_classes[(unsigned char)input->start[-1]] & SEPARATOR))
+    key->context |= LEFT_SEPARATED;
+  if ((last_char < 'A') && (last_char != '+') && (last_char != '='))
+    key->context |= SINGLE_ALLOWED;
+  if (transcription->flags & WEAK_STRESS)
+    key->context |= WEAK_STRESSED;
+  key->following = following_class(s);
+  key->preceding = sink_last(consumer);
+  return 1;
+}
+
+/* Get the cache slot for specified word */
+static word_t *word_slot(word_cache_t *cache, const word_t *key)
+{
+  uint32_t hash = 2166136261U;
+  uint8_t i;
+
+  for (i = 0; i < key->length; i++)
+    hash = (hash ^ (unsigned char)key->word[i]) * 16777619U;
+  hash = (hash ^ key->context ^ (key->following << 3)) * 16777619U;
+  hash = (hash ^ key->preceding) * 16777619U;
+  return cache->slots + (hash & (cache->size - 1));
+}
+
+/* Check if the cache slot holds the word specified by the key */
+static int word_match(const word_t *slot, const word_t *key)
+{
+  return (slot->length == key->length) &&
+    (slot->context == key->context) &&
+    (slot->following == key->following) &&
+    (slot->preceding == key->preceding) &&
+    !memcmp(slot->word, key->word, key->length);
+}
+
+/*
+ * Store in the cache slot transcription of the word just passed
+ * to the consumer starting from specified buffer offset
+ * along with the transcription state after the word.
+ */
+static void word_store(word_t *slot, word_t *word, sink_t *consumer, size_t offset,
+                       unsigned char last_char, int accented)
+{
+  transcription_state_t *transcription = consumer->user_data;
+  size_t n = consumer->buffer_offset - offset;
+
+  if (n <= WORD_MAX_CODES)
+    {
+      word->ncodes = n;
+      memcpy(word->codes, (uint8_t *)(consumer->buffer) + offset, n);
+      word->last_char = last_char;
+      word->flags = transcription->flags;
+      word->accented = accented;
+      *slot = *word;
+    }
+}
+
 /*
  * Check if clause transcription is terminated. If it is the case,
  * terminates transcription and flushes it to the consumer.
@@ -203,11 +492,11 @@ static int detect_suffix(input_t *input, transcription_state_t *transcription, c
 static int check_clause_termination(input_t *input, sink_t *consumer)
 {
   transcription_state_t *transcription = consumer->user_data;
-  char *s = memchr(symbols + 1, input->start[0], 6);
   int result = 0;
 
-  if (s)
+  if (char_classes[(unsigned char)input->start[0]] & TERMINATOR)
     {
+      const char *s = memchr(symbols + 1, input->start[0], 6);
       char c = *(input->start++);
       char nextc = (input->start < input->end) ? input->start[0] : ' ';
       uint16_t termination = PAIR(c, strchr(punctuations, nextc) ? nextc : ' ');
@@ -258,15 +547,155 @@ static uint8_t unvoicify_hard(uint8_t idx, char following)
  */
 static uint8_t correct_consonant(uint8_t idx, char following)
 {
-  if (memchr(consonants + 5, following, 10))
+  uint32_t cls = char_classes[(unsigned char)following];
+  if (cls & UNVOICED)
     return unvoicify_hard(idx, following);
-  else if (strchr(bgdjz, following))
+  else if (cls & VOICED)
     return (((idx != 10) && (idx != 16)) || (following != '_')) ?
       voicify(hard_consonant_phs, idx) : 9;
   return ((idx != 16) || (following != '_')) ?
     hard_consonant_phs[idx] : 9;
 }
 
+/*
+ * Decode UTF-8 sequence at the current source position
+ * leaving this position at its last byte.
+ * Stores koi8-r representation of the character in the buffer.
+ * Returns number of stored characters.
+ * Malformed or truncated sequences are ignored.
+ */
+static size_t decode_utf8(input_t *input, unsigned char *buffer)
+{
+  size_t length;
+  uint32_t code = utf8_decode((const unsigned char *)(input->source),
+                              input->source_end - input->source, &length);
+
+  input->source += length - 1;
+  return code ? unicode_koi8(code, buffer) : 0;
+}
+
+/*
+ * Get normalized representation of the source character
+ * at specified position storing its length in bytes.
+ * Only the first one is reported for multi-character mappings.
+ * Returns 0 for characters that should be ignored.
+ */
+static unsigned char source_char(const char *text, size_t room, const input_t *input, size_t *length)
+{
+  unsigned char c = (unsigned char)text[0];
+
+  if ((c & 0x80) && (input->flags & UTF8_TEXT))
+    {
+      unsigned char chars[UNICODE_MAX_CHARS];
+      uint32_t code = utf8_decode((const unsigned char *)text, room, length);
+      return (code && unicode_koi8(code, chars)) ? normal_chars[chars[0]] : 0;
+    }
+  *length = 1;
+  return normal_chars[c];
+}
+
+/*
+ * Peek the source character following the current one.
+ * In UTF-8 text it is decoded, so combining accents
+ * are reported as stress signs and dashes as hyphens.
+ * Returns 0 at the text end.
+ */
+static unsigned char next_char(input_t *input)
+{
+  const unsigned char *s = (const unsigned char *)(input->source);
+  size_t room = input->source_end - input->source;
+
+  if (room < 2)
+    return 0;
+  if ((input->flags & UTF8_TEXT) && (s[1] & 0x80))
+    {
+      unsigned char chars[UNICODE_MAX_CHARS];
+      size_t length;
+      uint32_t code = utf8_decode(s + 1, room - 1, &length);
+      if (code && unicode_koi8(code, chars))
+        return chars[0];
+    }
+  return s[1];
+}
+
+#ifdef PLAIN_RUN_SSSE3
+/*
+ * Normalize the source text beginning with a run of plain letters
+ * and single spaces followed by letters. Such characters
+ * are always kept, so the run is mapped 16 bytes at once
+ * until it ends. Letters are mapped by their low 5 bits
+ * looked up in the normalization table rows of Latin
+ * or koi8-r letters. The byte following each block is checked
+ * as well, so the source must have at least one more.
+ * The whole last block is stored even if the run ends inside it.
+ *
+ * Returns number of bytes taken and stored.
+ */
+static size_t __attribute__((target("ssse3"))) plain_run_ssse3(const char *source, size_t length, char *text,
+                                                               size_t room, uint8_t flags)
+{
+  __m128i latin_low = _mm_loadu_si128((const __m128i *)(normal_chars + 0x40));
+  __m128i latin_high = _mm_loadu_si128((const __m128i *)(normal_chars + 0x50));
+  __m128i koi8_low = _mm_loadu_si128((const __m128i *)(normal_chars + 0xC0));
+  __m128i koi8_high = _mm_loadu_si128((const __m128i *)(normal_chars + 0xD0));
+  __m128i koi8_letters = _mm_set1_epi8((flags & UTF8_TEXT) ? 0 : -1);
+  __m128i spaces = _mm_set1_epi8(' ');
+  __m128i zero = _mm_setzero_si128();
+  size_t done = 0;
+  int plain;
+
+  if ((source[0] == ' ') && !(flags & CLAUSE_START))
+    return 0;
+  for (; ((done + 16) < length) && ((done + 16) <= room); done += 16)
+    {
+      __m128i v = _mm_loadu_si128((const __m128i *)(source + done));
+      __m128i next = _mm_loadu_si128((const __m128i *)(source + done + 1));
+      __m128i koi8 = _mm_and_si128(_mm_cmplt_epi8(v, zero), koi8_letters);
+      __m128i letters, following, space, idx, high, mapped;
+
+      /* Latin letters of both cases and koi8-r letters from 0xC0 */
+      letters = _mm_or_si128(v, _mm_set1_epi8(0x20));
+      letters = _mm_and_si128(_mm_cmpgt_epi8(letters, _mm_set1_epi8(0x60)),
+                              _mm_cmplt_epi8(letters, _mm_set1_epi8(0x7B)));
+      letters = _mm_or_si128(letters, _mm_and_si128(koi8, _mm_cmpgt_epi8(v, _mm_set1_epi8(-65))));
+      following = _mm_or_si128(next, _mm_set1_epi8(0x20));
+      following = _mm_and_si128(_mm_cmpgt_epi8(following, _mm_set1_epi8(0x60)),
+                                _mm_cmplt_epi8(following, _mm_set1_epi8(0x7B)));
+      following = _mm_or_si128(following, _mm_and_si128(_mm_and_si128(_mm_cmplt_epi8(next, zero), koi8_letters),
+                                                        _mm_cmpgt_epi8(next, _mm_set1_epi8(-65))));
+      space = _mm_and_si128(_mm_cmpeq_epi8(v, spaces), following);
+      plain = _mm_movemask_epi8(_mm_or_si128(letters, space));
+      if (!(plain & 1))
+        break;
+
+      idx = _mm_and_si128(v, _mm_set1_epi8(0x1F));
+      high = _mm_cmpeq_epi8(_mm_and_si128(v, _mm_set1_epi8(0x10)), _mm_set1_epi8(0x10));
+      mapped = _mm_or_si128(_mm_andnot_si128(high, _mm_shuffle_epi8(latin_low, idx)),
+                            _mm_and_si128(high, _mm_shuffle_epi8(latin_high, idx)));
+      mapped = _mm_or_si128(_mm_andnot_si128(koi8, mapped),
+                            _mm_and_si128(koi8, _mm_or_si128(_mm_andnot_si128(high, _mm_shuffle_epi8(koi8_low, idx)),
+                                                             _mm_and_si128(high, _mm_shuffle_epi8(koi8_high, idx)))));
+      mapped = _mm_or_si128(_mm_andnot_si128(space, mapped), _mm_and_si128(space, spaces));
+      _mm_storeu_si128((__m128i *)(text + done), mapped);
+
+      /* The run ends inside this block */
+      if (plain != 0xFFFF)
+        return done + __builtin_ctz(~plain);
+    }
+  return done;
+}
+#endif
+
+/*
+ * Check if the transcription should wait for the text continuation,
+ * since not enough text is known ahead of the current position.
+ */
+static int text_awaited(input_t *input)
+{
+  input_fetch(input);
+  return (input->flags & MORE_TEXT) && ((input->end - input->start) < INPUT_LOOKAHEAD);
+}
+
 /* Transcription cycle initialization actions */
 static void transcription_init(sink_t *consumer)
 {
@@ -278,6 +707,121 @@ static void transcription_init(sink_t *consumer)
 
 /* Common functions */
 
+/*
+ * Make sure that enough normalized text is available
+ * ahead of the current input position.
+ *
+ * Returns non-zero value until the input is exhausted.
+ */
+int input_fetch(input_t *input)
+{
+  size_t reserve = (input->flags & MORE_TEXT) ? INPUT_RESERVE : 0;
+
+  if (((input->end - input->start) < INPUT_LOOKAHEAD) &&
+      ((input->source_end - input->source) > reserve))
+    {
+      char *limit = input->text + INPUT_BUFFER_SIZE;
+
+      /* Drop processed text keeping some history behind */
+      if ((input->start - input->text) > INPUT_HISTORY)
+        {
+          size_t shift = input->start - input->text - INPUT_HISTORY;
+          memmove(input->text, input->text + shift, input->end - input->text - shift);
+          input->start -= shift;
+          input->end -= shift;
+          input->word_start = input->text;
+          input->word_end = input->text;
+        }
+
+      /* Normalize next portion of the source text */
+      while ((input->end < limit) && ((input->source_end - input->source) > reserve))
+        {
+          unsigned char chars[UNICODE_MAX_CHARS];
+          size_t n = 1;
+          size_t i;
+
+          /* ASCII characters are the same in both encodings */
+          chars[0] = (unsigned char)input->source[0];
+          if ((chars[0] & 0x80) && (input->flags & UTF8_TEXT))
+            n = decode_utf8(input, chars);
+          else if (input->plain_run && (normal_chars[chars[0]] >= 'A'))
+            {
+              /* Runs of plain letters are taken at once when possible */
+              size_t length = input->plain_run(input->source, input->source_end - input->source - reserve,
+                                               input->end, limit - input->end, input->flags);
+              if (length)
+                {
+                  input->source += length;
+                  input->end += length;
+                  input->flags |= CLAUSE_START;
+                  continue;
+                }
+            }
+          for (i = 0; i < n; i++)
+            {
+              unsigned char c = normal_chars[chars[i]];
+              uint32_t cls = char_classes[c];
+              if (!(cls & SYMBOL))
+                {
+                  if (c)
+                    {
+                      *(input->end)++ = c;
+                      input->flags |= CLAUSE_START;
+                    }
+                }
+              else if (cls & PAUSE)
+                {
+                  unsigned char nextc = ((i + 1) < n) ? chars[i + 1] : next_char(input);
+                  if ((input->flags & CLAUSE_START) &&
+                      ((c != ' ') || (nextc == '\r') ||
+                       IS_DIGIT(nextc) || (nextc >= 'A')))
+                    *(input->end)++ = c;
+                }
+              else *(input->end)++ = c;
+            }
+          input->source++;
+        }
+      input->end[0] = 0;
+      input->end[1] = 0;
+    }
+  return input->start < input->end;
+}
+
+/*
+ * Get the suffix rule that may be applied at the current input position.
+ *
+ * The word end and the suffixes preceding it are looked up once
+ * per word, so the rest of the word is checked by the position only.
+ * The index is valid until the buffered text is shifted
+ * or the word is continued by the newly normalized text.
+ *
+ * Returns the rule number or 0 if there is no applicable rule.
+ */
+uint8_t word_suffix(input_t *input)
+{
+  if ((input->start < input->word_start) || (input->start >= input->word_end) ||
+      (char_classes[(unsigned char)input->word_end[0]] & LETTER))
+    {
+      char *s;
+      for (s = input->start; (s < input->end) && (char_classes[(unsigned char)s[0]] & LETTER); s++);
+      input->word_start = input->start;
+      input->word_end = s;
+      input->long_suffix = ((s - input->start) >= 4) ? match_suffix(s - 4, 4) : 0;
+      input->short_suffix = ((s - input->start) >= 3) ? match_suffix(s - 3, 3) : 0;
+    }
+
+  switch (input->word_end - input->start)
+    {
+    case 4:
+      return input->long_suffix;
+    case 3:
+      return input->short_suffix;
+    default:
+      break;
+    }
+  return 0;
+}
+
 /* Get an item from the list by its number */
 const uint8_t *list_item(const uint8_t *lst, uint8_t n)
 {
@@ -289,112 +833,205 @@ const uint8_t *list_item(const uint8_t *lst, uint8_t n)
   return item;
 }
 
-/* Transcribe specified text clause by clause and pass result to the consumer */
-void process_text(const char *text, sink_t *consumer)
+/* Make word transcriptions cache empty */
+void word_cache_reset(word_cache_t *cache)
 {
-  input_t input;
-  transcription_state_t *transcription = consumer->user_data;
-  char *s;
-  int accented = 0;
+  size_t i;
+  for (i = 0; i < cache->size; i++)
+    cache->slots[i].length = 0;
+  cache->hits = 0;
+  cache->misses = 0;
+}
 
-  consumer->custom_reset = transcription_init;
-  input.text = strdup(text);
-  if (!input.text)
-    return;
+/*
+ * Prepare input structure for a new text
+ * according to specified TTS control flags.
+ */
+void input_reset(input_t *input, int flags)
+{
+  input->flags = (flags & INPUT_UTF8) ? UTF8_TEXT : 0;
+#ifdef PLAIN_RUN_SSSE3
+  input->plain_run = __builtin_cpu_supports("ssse3") ? plain_run_ssse3 : NULL;
+#else
+  input->plain_run = NULL;
+#endif
+}
 
-  input.start = input.text;
-  input.end = input.text;
-  transcription->flags = 0;
+/*
+ * Find the first letter or digit in the text.
+ * Returns its offset or the text length if nothing found.
+ */
+size_t text_start(const char *text, size_t length, const input_t *input)
+{
+  size_t i, n;
 
-  for (s = input.text; *s; s++)
+  for (i = 0; i < length; i += n)
     {
-      unsigned char c = *s;
+      unsigned char c = source_char(text + i, length - i, input, &n);
+      if ((c >= 'A') || IS_DIGIT(c))
+        break;
+    }
+  return i;
+}
 
-      switch (c)
-        {
-        case '\n':
-        case '\r':
-          c = '\r';
-          break;
-        case 'j':
-        case 'J':
-          c = '_';
-          break;
-        case 'q':
-        case 'Q':
-        case 'x':
-        case 'X':
-          c = 'K';
-          break;
-        case 'w':
-        case 'W':
-          c = 'U';
-          break;
-        case 'y':
-        case 'Y':
-          c = 'I';
-          break;
-        case 163:
-        case 179:
-          c = '\\';
-          break;
-        default:
-          if (strchr(blanks, c))
-            c = ' ';
-          else if (c > 191)
-            c = letters[(c - 192) & 31];
-          else if ((c >= 'a') && (c <= 'z'))
-            c -= 0x20;
-          else if (((c < 'A') && !strchr(symbols, c) && !IS_DIGIT(c)) || (c > 'Z'))
-            c = 0;
-          break;
-        }
+/*
+ * Find the end of the last complete clause in the text
+ * looking only at the part after specified offset.
+ *
+ * A clause is complete when its terminating punctuation is followed
+ * by a blank and then by a character other than punctuation
+ * after the text normalization,
+ * so the termination pair is known and the text may be split
+ * here without affecting the result.
+ *
+ * Returns offset just after the terminating punctuation
+ * or zero if there is no complete clause.
+ */
+size_t clause_end(const char *text, size_t offset, size_t length, const input_t *input)
+{
+  size_t i;
+  unsigned char following = 0;
 
-      if (c)
+  for (i = length - 1; (i > offset) && (i < length); i--)
+    {
+      size_t start = i;
+      size_t n;
+      unsigned char c;
+
+      /* Step back to the start of UTF-8 sequence */
+      if (input->flags & UTF8_TEXT)
+        while ((start > offset) && ((i - start) < 3) &&
+               ((((unsigned char)text[start]) & 0xC0) == 0x80))
+          start--;
+      c = source_char(text + start, length - start, input, &n);
+
+      /* Broken sequences are ignored byte by byte */
+      if ((start + n) == (i + 1))
         {
-          const char *sptr = strchr(symbols, c);
-          if (sptr)
-            {
-              int sidx = sptr - symbols;
-              unsigned char nextc = s[1];
-              if ((sidx > 6) ||
-                  ((transcription->flags & CLAUSE_START) &&
-                   ((c != ' ') || (nextc == '\r') ||
-                    IS_DIGIT(nextc) || (nextc >= 'A'))))
-                *(input.end)++ = c;
-            }
-          else
-            {
-              *(input.end)++ = c;
-              transcription->flags |= CLAUSE_START;
-            }
+          i = start;
+          if (c && (c != ' '))
+            following = c;
         }
+      if ((i > offset) && following && !strchr(punctuations, following) &&
+          memchr(symbols + 1, text[i - 1], 6) &&
+          ((text[i] == ' ') || (text[i] == '\t') || (text[i] == '\n') || (text[i] == '\r')))
+        return i;
     }
-  *(input.end) = 0;
+  return 0;
+}
 
-  for (s = input.start; (s < input.end) && (s[0] < 'A') && !IS_DIGIT(s[0]); s++);
-  if (s >= input.end)
+/*
+ * Transcribe specified text clause by clause and pass result to the consumer.
+ *
+ * The text is specified by a pointer and a length and is not required
+ * to be zero-terminated. Consecutive calls continue the same text
+ * until the input structure is reset. The transcription waiting
+ * for the text continuation is resumed where it has stopped.
+ */
+void process_text(const char *text, size_t length, input_t *input, sink_t *consumer)
+{
+  transcription_state_t *transcription = consumer->user_data;
+  word_t *slot = NULL;
+  word_t word;
+  size_t word_offset = 0;
+  int accented = 0;
+  unsigned char last_char = 0;
+
+  consumer->custom_reset = transcription_init;
+
+  if (input->flags & TEXT_PAUSED)
     {
-      free(input.text);
-      return;
+      slot = input->slot;
+      word = input->word;
+      word_offset = input->word_offset;
+      accented = input->accented;
+      last_char = input->last_char;
+      input->flags &= ~TEXT_PAUSED;
     }
-
-  while ((input.start < input.end) && !consumer->status)
+  else
     {
-      unsigned char last_char = 0;
+      /* Skip the text containing neither letters nor digits */
+      if (!(input->flags & CLAUSE_START) && (text_start(text, length, input) >= length))
+        return;
 
-      while ((input.start < input.end) && memchr(symbols, input.start[0], 7))
-        input.start++;
-      sink_reset(consumer);
-      for (transcription->flags = CLAUSE_START; (input.start < input.end) && (consumer->buffer_offset < TRANSCRIPTION_MAXLEN) && !consumer->status; input.start++)
+      input->start = input->text;
+      input->end = input->text;
+      input->word_start = input->text;
+      input->word_end = input->text;
+      transcription->flags = 0;
+    }
+  input->source = text;
+  input->source_end = text + length;
+
+  while ((input_fetch(input) || (input->flags & MORE_TEXT)) && !sink_stopped(consumer))
+    {
+      if (!(input->flags & CLAUSE_PAUSED))
+        {
+          while (!text_awaited(input) && input_fetch(input) &&
+                 (char_classes[(unsigned char)input->start[0]] & PAUSE))
+            input->start++;
+          if (text_awaited(input))
+            {
+              input->flags |= TEXT_PAUSED;
+              break;
+            }
+          sink_reset(consumer);
+          transcription->flags = CLAUSE_START;
+          last_char = 0;
+        }
+      for (input->flags &= ~CLAUSE_PAUSED; (input_fetch(input) || (input->flags & MORE_TEXT)) && (consumer->buffer_offset < TRANSCRIPTION_MAXLEN) && !sink_stopped(consumer); input->start++)
         {
           char *s;
-          unsigned char c = input.start[0];
+          unsigned char c = input->start[0];
+          uint32_t cls = char_classes[c];
+
+          /* The rest of the clause may depend on the text not known yet */
+          if (text_awaited(input))
+            {
+              input->flags |= TEXT_PAUSED | CLAUSE_PAUSED;
+              break;
+            }
+
+          /* Words already transcribed in the same context are reused */
+          if (slot)
+            {
+              if (!IS_WORD_CHAR(c))
+                {
+                  word_store(slot, &word, consumer, word_offset, last_char, accented);
+                  slot = NULL;
+                }
+              else if ((consumer->buffer_offset - word_offset) > WORD_MAX_CODES)
+                slot = NULL;
+            }
+          else if (input->cache && (transcription->flags & CLAUSE_START) &&
+                   IS_WORD_CHAR(c) && word_key(input, consumer, last_char, &word))
+            {
+              word_t *entry = word_slot(input->cache, &word);
+              if (word_match(entry, &word) &&
+                  ((consumer->buffer_offset + entry->ncodes) < TRANSCRIPTION_MAXLEN))
+                {
+                  input->cache->hits++;
+                  sink_write(consumer, entry->codes, entry->ncodes);
+                  transcription->flags = entry->flags;
+                  accented = entry->accented;
+                  last_char = entry->last_char;
+                  input->start += entry->length - 1;
+                  continue;
+                }
+              input->cache->misses++;
+
+              /* Make sure the buffer is not flushed while recording */
+              if ((consumer->buffer_offset + 2 * WORD_MAX_CODES) < TRANSCRIPTION_MAXLEN)
+                {
+                  slot = entry;
+                  word_offset = consumer->buffer_offset;
+                }
+            }
 
           if (transcription->flags & CLAUSE_START)
             {
               accented = 0;
-              for (s = input.start; s < input.end; s++)
+              for (s = input->start; s < input->end; s++)
                 if ((s[0] == '+') || (s[0] == '='))
                   {
                     accented = 1;
@@ -404,15 +1041,14 @@ void process_text(const char *text, sink_t *consumer)
                   break;
             }
 
-          s = strchr(char_list, c);
-          if (s)
+          if (cls & ACCEPTED)
             {
-              uint8_t char_index = s - char_list;
+              uint8_t char_index = CHAR_ITEM(cls);
               if ((char_index < 17) &&
                   (last_char != '+') &&
                   (last_char != '=') &&
                   (last_char < 'A') &&
-                  (input.start[1] < 'A'))
+                  (input->start[1] < 'A'))
                 {
                   put_transcription_block(consumer, char_index);
                   transcription->flags |= CLAUSE_START;
@@ -427,7 +1063,7 @@ void process_text(const char *text, sink_t *consumer)
                       if ((prev < 43) || (prev > 52))
                         sink_put(consumer, 43);
                       put_transcription_block(consumer, char_index);
-                      if ((c != '-') && (input.start[1] >= 'A'))
+                      if ((c != '-') && (input->start[1] >= 'A'))
                         sink_put(consumer, 43);
                       transcription->flags |= CLAUSE_START;
                     }
@@ -444,143 +1080,100 @@ void process_text(const char *text, sink_t *consumer)
           /* Some suffixes are transcribed specially when accented */
           if (accented)
             {
-              if (detect_suffix(&input, transcription, "O+GO"))
-                {
-                  put_transcription_block(consumer, 42);
-                  last_char = 'A';
-                  continue;
-                }
-              else if (detect_suffix(&input, transcription, "E+GO"))
-                {
-                  s = input.start - 4;
-                  put_transcription_block(consumer, ((s >= input.text) && strchr(consonants, *s)) ? 45 : 48);
-                  last_char = 'A';
-                  continue;
-                }
-              else if (detect_suffix(&input, transcription, "EGO+"))
-                {
-                  s = input.start - 4;
-                  put_transcription_block(consumer, ((s >= input.text) && strchr(consonants, *s)) ? 46 : 49);
-                  last_char = 'O';
-                  continue;
-                }
-              else if (detect_suffix(&input, transcription, "OGO+"))
-                {
-                  put_transcription_block(consumer, 43);
-                  last_char = 'O';
-                  continue;
-                }
-              else if (detect_suffix(&input, transcription, "EGO"))
-                {
-                  s = input.start - 3;
-                  put_transcription_block(consumer, ((s >= input.text) && strchr(consonants, *s)) ? 47 : 50);
-                  last_char = 'A';
-                  continue;
-                }
-              else if (detect_suffix(&input, transcription, "OGO"))
-                {
-                  put_transcription_block(consumer, 44);
-                  last_char = 'A';
-                  continue;
-                }
-              else if (detect_suffix(&input, transcription, "TSQ"))
+              uint8_t rule = word_suffix(input);
+              if (rule && detect_suffix(input, transcription, suffix_rules[rule].suffix))
                 {
-                  put_transcription_block(consumer, 51);
-                  last_char = 'A';
-                  continue;
-                }
-              else if (detect_suffix(&input, transcription, "TXSQ"))
-                {
-                  put_transcription_block(consumer, 51);
-                  last_char = 'A';
+                  s = input->start - suffix_rules[rule].length;
+                  put_transcription_block(consumer, suffix_rules[rule].blocks[((s >= input->text) && (char_classes[(unsigned char)*s] & CONSONANT)) ? 0 : 1]);
+                  last_char = suffix_rules[rule].last_char;
                   continue;
                 }
+              /* Unmatched suffix leaves no weak stress behind */
+              transcription->flags &= ~WEAK_STRESS;
             }
 
           if (IS_DIGIT(c))
             {
               sink_flush(consumer);
-              process_number(&input, consumer);
-              if (check_clause_termination(&input, consumer))
+              process_number(input, consumer);
+              if (check_clause_termination(input, consumer))
                 transcription->flags |= CLAUSE_START;
               else sink_flush(consumer);
               last_char = ' ';
-              if (input.start[0] != ' ')
-                input.start--;
+              if (input->start[0] != ' ')
+                input->start--;
               continue;
             }
 
-          if (check_clause_termination(&input, consumer))
+          if (check_clause_termination(input, consumer))
             break;
 
-          s = strchr(vocalics, c);
-          if (s)
+          if (cls & VOCALIC)
             {
               uint8_t vc = (c == 'I') ? 5 :
-                (((c == 'O') &&accented && (input.start[1] != '+') && (input.start[1] != '=')) ?
-                 2 : vocal_phoncodes[(s - vocalics) % 5]);
+                (((c == 'O') &&accented && (input->start[1] != '+') && (input->start[1] != '=')) ?
+                 2 : vocal_phoncodes[CHAR_ORDER(cls) % 5]);
               transcription->flags &= ~CLAUSE_START;
-              if (input.start > input.text)
+              if (input->start > input->text)
                 {
-                  unsigned char prevc = *(input.start - 1);
+                  unsigned char prevc = *(input->start - 1);
                   if (prevc != 'X')
                     {
-                      if ((strchr(vocalics, prevc) || memchr(symbols, prevc, 13) ||
+                      if (((char_classes[prevc] & (VOCALIC | SEPARATOR)) ||
                            (prevc == ']')) &&
-                          strchr("`QE\\", c))
+                          (cls & IOTATED))
                         sink_put(consumer, 10);
                     }
-                  else if (strchr("`QE\\IO", c))
+                  else if ((cls & IOTATED) || (c == 'I') || (c == 'O'))
                     sink_put(consumer, 10);
                 }
-              else if (strchr("`QE\\", c))
+              else if (cls & IOTATED)
                 sink_put(consumer, 10);
               sink_put(consumer, vc);
               last_char = c;
               continue;
             }
 
-          if (strchr(ndts, c))
+          if (cls & DENTAL)
             {
-              unsigned char nextc = input.start[1];
-              if (memchr(vocalics, nextc, 5) || (nextc == 'X'))
+              unsigned char nextc = input->start[1];
+              if ((char_classes[nextc] & FRONT) || (nextc == 'X'))
                 {
-                  s = strchr(ndts, last_char);
-                  if (s)
+                  if (last_char && (s = strchr(ndts, last_char)))
                     sink_replace(consumer, ndts_soft_phs[s - ndts]);
                 }
             }
 
-          s = strchr(consonants, c);
-          if (s)
+          if (cls & CONSONANT)
             {
-              unsigned char nextc = ((input.end - input.start) > 1) ? input.start[1] : ',';
-              uint8_t idx = s - consonants;
+              unsigned char nextc = ((input->end - input->start) > 1) ? input->start[1] : ',';
+              uint8_t idx = CHAR_ORDER(cls);
               transcription->flags &= ~CLAUSE_START;
               if (idx < 9)
                 {
                   if (nextc == 'X')
                     {
-                      input.start++;
+                      input->start++;
                       sink_put(consumer, soft_consonant_phs[idx]);
                     }
-                  else sink_put(consumer, (memchr(vocalics, nextc, 5) ? soft_consonant_phs : hard_consonant_phs)[idx]);
+                  else sink_put(consumer, ((char_classes[nextc] & FRONT) ? soft_consonant_phs : hard_consonant_phs)[idx]);
                 }
               else if (nextc == 'X')
                 {
-                  input.start++;
-                  nextc = ((input.end - input.start) > 1) ? input.start[1] : ',';
-                  if ((memchr(symbols + 1, nextc, 6) && (sink_last(consumer) != 43)) || memchr(consonants + 5, nextc, 10))
+                  input->start++;
+                  nextc = ((input->end - input->start) > 1) ? input->start[1] : ',';
+                  if (((char_classes[nextc] & TERMINATOR) && (sink_last(consumer) != 43)) ||
+                      (char_classes[nextc] & UNVOICED))
                     sink_put(consumer, unvoicify(soft_consonant_phs, idx));
-                  else if (strchr(bgdjz, nextc))
+                  else if (char_classes[nextc] & VOICED)
                     sink_put(consumer, voicify(soft_consonant_phs, idx));
                   else sink_put(consumer, soft_consonant_phs[idx]);
                 }
-              else if (memchr(vocalics, nextc, 5))
+              else if (char_classes[nextc] & FRONT)
                 sink_put(consumer, soft_consonant_phs[idx]);
-              else if (memchr(symbols + 1, nextc, 6))
+              else if (char_classes[nextc] & TERMINATOR)
                 sink_put(consumer, (sink_last(consumer) != 43) ? unvoicify_hard(idx, nextc) : hard_consonant_phs[idx]);
-              else sink_put(consumer, correct_consonant(idx, (nextc != ' ') ? nextc : input.start[2]));
+              else sink_put(consumer, correct_consonant(idx, (nextc != ' ') ? nextc : input->start[2]));
             }
           else if (c != ']')
             {
@@ -590,7 +1183,33 @@ void process_text(const char *text, sink_t *consumer)
           else transcription->flags &= ~CLAUSE_START;
           last_char = c;
         }
+      if (input->flags & CLAUSE_PAUSED)
+        break;
+      if (slot && ((input->start >= input->end) || !IS_WORD_CHAR((unsigned char)input->start[0])))
+        word_store(slot, &word, consumer, word_offset, last_char, accented);
+      slot = NULL;
       sink_flush(consumer);
     }
-  free(input.text);
+
+  if (input->flags & TEXT_PAUSED)
+    {
+      input->slot = slot;
+      input->word = word;
+      input->word_offset = word_offset;
+      input->accented = accented;
+      input->last_char = last_char;
+    }
+}
+
+/*
+ * Transcribe the beginning of the text that is to be continued later
+ * waiting for the continuation wherever not enough text is known ahead.
+ * Returns number of the source text bytes taken.
+ */
+size_t process_text_part(const char *text, size_t length, input_t *input, sink_t *consumer)
+{
+  input->flags |= MORE_TEXT;
+  process_text(text, length, input, consumer);
+  input->flags &= ~MORE_TEXT;
+  return (input->flags & TEXT_PAUSED) ? (size_t)(input->source - text) : 0;
 }
@@ -12,8 +12,10 @@
 #define RU_TTS_TRANSCRIPTION_H
 
 #include <stdint.h>
+#include <stdlib.h>
 
 #include "sink.h"
+#include "unicode.h"
 
 
 /* General constants */
@@ -22,16 +24,105 @@
 #define TRANSCRIPTION_GUARD_SPACE 40
 #define TRANSCRIPTION_MAXLEN (TRANSCRIPTION_BUFFER_SIZE - TRANSCRIPTION_GUARD_SPACE)
 
+/* Normalized input window parameters */
+#define INPUT_BUFFER_SIZE 1024
+#define INPUT_LOOKAHEAD 256
+#define INPUT_HISTORY 8
+
+/*
+ * Source bytes left unnormalized when the text is continued later.
+ * They hold the longest UTF-8 sequence and the one following it.
+ */
+#define INPUT_RESERVE 8
+
+/* Word transcription cache parameters */
+#define WORD_MAX_LENGTH 24
+#define WORD_MAX_CODES 64
+
 /* Clause termination flag */
 #define CLAUSE_DONE 1
 
+/* Character classes */
+#define PAUSE 0x0001 /* Blank or clause terminator */
+#define TERMINATOR 0x0002 /* Clause terminator */
+#define SEPARATOR 0x0004 /* Word separating symbol */
+#define VOCALIC 0x0008
+#define FRONT 0x0010 /* Vocalic softening preceding consonant */
+#define IOTATED 0x0020 /* Vocalic taking iot after a vowel or separator */
+#define DENTAL 0x0040 /* Consonant softened before soft ones */
+#define UNVOICED 0x0080 /* Unvoiced consonant or sonorant */
+#define VOICED 0x0100 /* Voiced consonant or the text end */
+#define ACCEPTED 0x0200 /* Character having its own transcription block */
+#define CONSONANT 0x0400
+#define SYMBOL 0x0800 /* Special symbol */
+#define LETTER 0x1000 /* Word constituent for suffix detection */
+#define CHAR_ITEM(x) (((x) >> 16) & 0x3F) /* Accepted character index */
+#define CHAR_ORDER(x) (((x) >> 24) & 0x1F) /* Consonant or vocalic index */
+
+
+/*
+ * Transcription of a word in the particular context.
+ *
+ * The key comprises the word itself, its context classes
+ * and the transcription state before the word. The rest
+ * is the word transcription and the state after it.
+ */
+typedef struct
+{
+  uint8_t length; /* Word length, 0 when the slot is empty */
+  uint8_t context; /* Left context and state flags */
+  uint8_t following; /* Right context class */
+  uint8_t preceding; /* Phoncode preceding the word */
+  char word[WORD_MAX_LENGTH];
+  uint8_t last_char;
+  uint8_t flags;
+  uint8_t accented;
+  uint8_t ncodes;
+  uint8_t codes[WORD_MAX_CODES];
+} word_t;
 
-/* Input data holding structure */
+/*
+ * Word transcriptions cache.
+ *
+ * Transcribed words replace each other in case of slot collision.
+ */
+typedef struct
+{
+  size_t size; /* Number of slots, a power of 2 */
+  unsigned long hits;
+  unsigned long misses;
+  word_t slots[];
+} word_cache_t;
+
+/*
+ * Input data holding structure.
+ *
+ * Source text is normalized not at once, but piece by piece
+ * into the bounded window as the processing advances.
+ */
 typedef struct
 {
-  char *text;
   char *start;
   char *end;
+  const char *source; /* Source text that is not normalized yet */
+  const char *source_end;
+  char *word_start; /* Text range the word index is valid for */
+  char *word_end; /* The first non-letter after the word */
+  uint8_t long_suffix; /* Suffix rule matched 4 characters before the word end */
+  uint8_t short_suffix; /* Suffix rule matched 3 characters before the word end */
+  word_cache_t *cache; /* Optional word transcriptions cache */
+  uint8_t flags;
+
+  /* Normalizer of plain letter runs suited for the processor or NULL */
+  size_t (*plain_run)(const char *source, size_t length, char *text, size_t room, uint8_t flags);
+
+  /* Clause transcription progress kept while waiting for more text */
+  word_t *slot; /* Cache slot the current word is recorded for */
+  word_t word;
+  size_t word_offset;
+  uint8_t last_char;
+  uint8_t accented;
+  char text[INPUT_BUFFER_SIZE + UNICODE_MAX_CHARS + 1];
 } input_t;
 
 /* Transcription state control */
@@ -45,13 +136,84 @@ typedef struct
 /* Shared data */
 extern const char *punctuations;
 
+/* Classes of normalized text characters */
+extern const uint32_t char_classes[256];
+
 
 /* Common functions */
 
 /* Get an item from the list by its number */
 extern const uint8_t *list_item(const uint8_t *lst, uint8_t n);
 
-/* Transcribe specified text clause by clause and pass result to the consumer */
-extern void process_text(const char *text, sink_t *consumer);
+/*
+ * Make sure that enough normalized text is available
+ * ahead of the current input position.
+ *
+ * Returns non-zero value until the input is exhausted.
+ */
+extern int input_fetch(input_t *input);
+
+/*
+ * Get the suffix rule that may be applied at the current input position.
+ *
+ * The word end and the suffixes preceding it are looked up once
+ * per word, so the rest of the word is checked by the position only.
+ * The index is valid until the buffered text is shifted
+ * or the word is continued by the newly normalized text.
+ *
+ * Returns the rule number or 0 if there is no applicable rule.
+ */
+extern uint8_t word_suffix(input_t *input);
+
+/* Make word transcriptions cache empty */
+extern void word_cache_reset(word_cache_t *cache);
+
+/*
+ * Prepare input structure for a new text
+ * according to specified TTS control flags.
+ */
+extern void input_reset(input_t *input, int flags);
+
+/*
+ * Find the first letter or digit in the text
+ * encoded as the input structure tells.
+ * Returns its offset or the text length if nothing found.
+ */
+extern size_t text_start(const char *text, size_t length, const input_t *input);
+
+/*
+ * Find the end of the last complete clause in the text
+ * encoded as the input structure tells
+ * looking only at the part after specified offset.
+ *
+ * Returns offset just after the terminating punctuation
+ * or zero if there is no complete clause.
+ */
+extern size_t clause_end(const char *text, size_t offset, size_t length,
+                         const input_t *input);
+
+/*
+ * Transcribe specified text clause by clause and pass result to the consumer.
+ *
+ * The text is specified by a pointer and a length and is not required
+ * to be zero-terminated. It is never copied as a whole, so the memory
+ * used does not depend on the text size. Consecutive calls continue
+ * the same text until the input structure is reset.
+ */
+extern void process_text(const char *text, size_t length, input_t *input, sink_t *consumer);
+
+/*
+ * Transcribe the beginning of the text that is to be continued later.
+ *
+ * The transcription goes on while enough text is known ahead
+ * of the current position and waits for the continuation
+ * even in the middle of a clause, so the text may be split anywhere
+ * without affecting the result. The next call of this function
+ * or of process_text() should pass the source text starting
+ * from the first byte that has not been taken.
+ *
+ * Returns number of the source text bytes taken.
+ */
+extern size_t process_text_part(const char *text, size_t length, input_t *input, sink_t *consumer);
 
 #endif
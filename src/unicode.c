@@ -0,0 +1,117 @@
+/* unicode.c -- Unicode text decoding
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "unicode.h"
+
+
+/* Local data */
+
+/* Koi8-r codes of small Cyrillic letters in the Unicode order */
+static const uint8_t cyrillic_letters[] =
+  {
+    0xC1, 0xC2, 0xD7, 0xC7, 0xC4, 0xC5, 0xD6, 0xDA,
+    0xC9, 0xCA, 0xCB, 0xCC, 0xCD, 0xCE, 0xCF, 0xD0,
+    0xD2, 0xD3, 0xD4, 0xD5, 0xC6, 0xC8, 0xC3, 0xDE,
+    0xDB, 0xDD, 0xDF, 0xD9, 0xD8, 0xDC, 0xC0, 0xD1
+  };
+
+
+/* Global entry points */
+
+/*
+ * Decode UTF-8 sequence of at most room bytes.
+ * Number of bytes the sequence occupies is stored by the length pointer.
+ * Returns decoded character code or 0 for malformed
+ * or truncated sequences.
+ */
+uint32_t utf8_decode(const unsigned char *s, size_t room, size_t *length)
+{
+  size_t n, i;
+  uint32_t code;
+
+  if (s[0] < 0xC0)
+    {
+      *length = 1;
+      return 0;
+    }
+  n = (s[0] < 0xE0) ? 1 : ((s[0] < 0xF0) ? 2 : 3);
+  if (n >= room)
+    {
+      *length = room;
+      return 0;
+    }
+  code = s[0] & (0x3F >> n);
+  for (i = 1; i <= n; i++)
+    {
+      if ((s[i] & 0xC0) != 0x80)
+        {
+          *length = i;
+          return 0;
+        }
+      code = (code << 6) | (s[i] & 0x3F);
+    }
+  *length = n + 1;
+  return code;
+}
+
+/*
+ * Map Unicode character to koi8-r storing at most UNICODE_MAX_CHARS
+ * characters in the buffer.
+ * Returns number of stored characters, 0 for characters
+ * that should be ignored.
+ */
+size_t unicode_koi8(uint32_t code, unsigned char *buffer)
+{
+  if ((code >= 0x410) && (code < 0x450))
+    buffer[0] = cyrillic_letters[(code - 0x410) & 31] | ((code < 0x430) ? 0x20 : 0);
+  else switch (code)
+    {
+    case 0x401: /* Capital IO */
+      buffer[0] = 0xB3;
+      break;
+    case 0x451: /* Small io */
+      buffer[0] = 0xA3;
+      break;
+    case 0x301: /* Combining acute accent */
+      buffer[0] = '+';
+      break;
+    case 0x300: /* Combining grave accent */
+      buffer[0] = '=';
+      break;
+    case 0xA0: /* No-break space */
+      buffer[0] = ' ';
+      break;
+    case 0xAB: /* Guillemets */
+    case 0xBB:
+    case 0x201C: /* Double quotation marks */
+    case 0x201D:
+    case 0x201E:
+      buffer[0] = '"';
+      break;
+    case 0x2013: /* En and em dashes */
+    case 0x2014:
+      buffer[0] = '-';
+      break;
+    case 0x2019: /* Right single quotation mark */
+      buffer[0] = '\'';
+      break;
+    case 0x2026: /* Horizontal ellipsis */
+      buffer[0] = '.';
+      buffer[1] = '.';
+      buffer[2] = '.';
+      return 3;
+    default:
+      return 0;
+    }
+  return 1;
+}
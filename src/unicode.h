@@ -0,0 +1,40 @@
+/* unicode.h -- Unicode text decoding interface
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef RU_TTS_UNICODE_H
+#define RU_TTS_UNICODE_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+
+/* Maximum number of koi8-r characters one Unicode character maps to */
+#define UNICODE_MAX_CHARS 3
+
+
+/* Unicode support functions */
+
+/*
+ * Decode UTF-8 sequence of at most room bytes.
+ * Number of bytes the sequence occupies is stored by the length pointer.
+ * Returns decoded character code or 0 for malformed
+ * or truncated sequences.
+ */
+extern uint32_t utf8_decode(const unsigned char *s, size_t room, size_t *length);
+
+/*
+ * Map Unicode character to koi8-r storing at most UNICODE_MAX_CHARS
+ * characters in the buffer.
+ * Returns number of stored characters, 0 for characters
+ * that should be ignored.
+ */
+extern size_t unicode_koi8(uint32_t code, unsigned char *buffer);
+
+#endif
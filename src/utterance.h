@@ -0,0 +1,60 @@
+/* utterance.h -- Utterance building rules
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+#ifndef RU_TTS_UTTERANCE_H
+#define RU_TTS_UTTERANCE_H
+
+#include <stdint.h>
+
+
+/* Consonant sound sequence kinds */
+#define CONSONANT_PLAIN 0
+#define CONSONANT_PAIR 1
+#define CONSONANT_SOFTENED 2
+#define CONSONANT_VARIED 3
+#define CONSONANT_STOP 4
+
+/* Phoncodes covered by the consonant rules */
+#define CONSONANTS_START 6
+#define CONSONANTS 37
+
+/* Phoncodes distinguished by the vowel rules */
+#define VOWEL_CONTEXTS 44
+
+
+/* Sound sequence rule for a consonant phoncode */
+typedef struct
+{
+  uint8_t kind;
+  uint8_t sound; /* Main sound put at the stage 2 */
+  uint8_t extra; /* Sound for the stage 3 or transitions */
+  uint8_t alternative; /* Replacement of the main sound if any */
+} consonant_rule_t;
+
+
+/* Rule tables generated by utterancegen */
+
+/* Sound sequence rules for phoncodes from 6 to 42 */
+extern const consonant_rule_t consonant_rules[CONSONANTS];
+
+/*
+ * Vowel sound offsets for stages from 1 to 3 indexed by the vowel
+ * being the last one (5) and by the preceding phoncode.
+ */
+extern const int8_t vowel_onset[2][VOWEL_CONTEXTS][3];
+
+/*
+ * Vowel sound offsets for the stage 4 indexed by the vowel
+ * being the last one (5) and by the following phoncode.
+ * All phoncodes above 42 share the last entry.
+ */
+extern const uint8_t vowel_coda[2][VOWEL_CONTEXTS - 1];
+
+#endif
@@ -0,0 +1,103 @@
+/* utterance_rules.c -- Utterance building rule tables
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/* This file is generated by utterancegen. Do not edit. */
+
+#include <stdint.h>
+
+#include "utterance.h"
+
+
+const consonant_rule_t consonant_rules[CONSONANTS] =
+  {
+    { CONSONANT_STOP, 123, 105, 0 },
+    { CONSONANT_STOP, 124, 106, 0 },
+    { CONSONANT_STOP, 125, 107, 0 },
+    { CONSONANT_STOP, 126, 108, 0 },
+    { CONSONANT_STOP, 127, 109, 122 },
+    { CONSONANT_STOP, 128, 110, 0 },
+    { CONSONANT_STOP, 129, 111, 0 },
+    { CONSONANT_STOP, 130, 112, 0 },
+    { CONSONANT_PLAIN, 133, 0, 0 },
+    { CONSONANT_PLAIN, 134, 0, 0 },
+    { CONSONANT_PLAIN, 135, 0, 0 },
+    { CONSONANT_PLAIN, 136, 0, 0 },
+    { CONSONANT_PLAIN, 137, 0, 0 },
+    { CONSONANT_PLAIN, 138, 0, 0 },
+    { CONSONANT_SOFTENED, 163, 139, 0 },
+    { CONSONANT_SOFTENED, 164, 140, 0 },
+    { CONSONANT_SOFTENED, 165, 141, 0 },
+    { CONSONANT_PAIR, 166, 142, 0 },
+    { CONSONANT_PAIR, 167, 143, 0 },
+    { CONSONANT_PAIR, 168, 144, 0 },
+    { CONSONANT_SOFTENED, 169, 145, 0 },
+    { CONSONANT_SOFTENED, 170, 146, 0 },
+    { CONSONANT_SOFTENED, 171, 147, 0 },
+    { CONSONANT_PAIR, 172, 148, 0 },
+    { CONSONANT_PAIR, 173, 149, 0 },
+    { CONSONANT_PAIR, 174, 150, 0 },
+    { CONSONANT_PAIR, 175, 177, 0 },
+    { CONSONANT_PAIR, 176, 178, 0 },
+    { CONSONANT_PLAIN, 179, 0, 0 },
+    { CONSONANT_PLAIN, 180, 0, 0 },
+    { CONSONANT_PLAIN, 181, 0, 0 },
+    { CONSONANT_PLAIN, 182, 0, 0 },
+    { CONSONANT_PLAIN, 183, 0, 0 },
+    { CONSONANT_PLAIN, 184, 0, 0 },
+    { CONSONANT_VARIED, 185, 0, 0 },
+    { CONSONANT_PLAIN, 186, 0, 0 },
+    { CONSONANT_PLAIN, 189, 0, 0 }
+  };
+
+const int8_t vowel_onset[2][VOWEL_CONTEXTS][3] =
+  {
+    {
+      { 95, 0, 95 }, { 95, 0, 95 }, { 95, 0, 95 }, { 95, 0, 95 },
+      { 95, 0, 95 }, { 95, 0, 95 }, { 10, 0, 95 }, { 20, 0, 95 },
+      { 20, 0, 95 }, { 20, 0, 95 }, { 70, 5, 100 }, { 50, 5, 100 },
+      { 60, 5, 100 }, { 60, 5, 100 }, { 40, 0, 95 }, { 10, 0, 95 },
+      { 20, 0, 95 }, { 80, 5, 100 }, { 50, 5, 100 }, { 60, 5, 100 },
+      { 10, 0, 95 }, { 20, 0, 95 }, { 30, 0, 95 }, { 50, 5, 100 },
+      { 60, 5, 100 }, { 70, 5, 100 }, { 10, 0, 95 }, { 20, 0, 95 },
+      { 30, 0, 95 }, { 50, 5, 100 }, { 60, 5, 100 }, { 70, 5, 100 },
+      { 20, 0, 95 }, { 60, 5, 100 }, { 10, 0, 95 }, { 20, 0, 95 },
+      { 20, 0, 95 }, { 50, 5, 100 }, { 60, 5, 100 }, { 60, 5, 100 },
+      { 30, 0, 95 }, { 70, 5, 100 }, { 90, 0, 95 }, { 90, 0, 95 }
+    },
+    {
+      { 99, 4, 99 }, { 99, 4, 99 }, { 99, 4, 99 }, { 99, 4, 99 },
+      { 99, 4, 99 }, { 99, 4, 99 }, { 9, -1, 94 }, { 19, -1, 94 },
+      { 19, -1, 94 }, { 19, -1, 94 }, { 69, 4, 99 }, { 49, 4, 99 },
+      { 59, 4, 99 }, { 59, 4, 99 }, { 39, -1, 94 }, { 9, -1, 94 },
+      { 19, -1, 94 }, { 79, 4, 99 }, { 49, 4, 99 }, { 59, 4, 99 },
+      { 9, -1, 94 }, { 19, -1, 94 }, { 29, -1, 94 }, { 49, 4, 99 },
+      { 59, 4, 99 }, { 69, 4, 99 }, { 9, -1, 94 }, { 19, -1, 94 },
+      { 29, -1, 94 }, { 49, 4, 99 }, { 59, 4, 99 }, { 69, 4, 99 },
+      { 19, -1, 94 }, { 59, 4, 99 }, { 9, -1, 94 }, { 19, -1, 94 },
+      { 19, -1, 94 }, { 49, 4, 99 }, { 59, 4, 99 }, { 59, 4, 99 },
+      { 29, -1, 94 }, { 69, 4, 99 }, { 89, 4, 99 }, { 89, 4, 99 }
+    }
+  };
+
+const uint8_t vowel_coda[2][VOWEL_CONTEXTS - 1] =
+  {
+    {
+      95, 95, 95, 95, 95, 95, 15, 25, 25, 25, 75, 55,
+      65, 65, 45, 15, 25, 85, 55, 65, 15, 25, 35, 55,
+      65, 75, 15, 25, 35, 55, 65, 75, 25, 65, 15, 25,
+      25, 55, 65, 65, 35, 75, 90
+    },
+    {
+      99, 99, 99, 99, 99, 99, 14, 24, 24, 24, 74, 54,
+      64, 64, 44, 14, 24, 84, 54, 64, 14, 24, 34, 54,
+      64, 74, 14, 24, 34, 54, 64, 74, 24, 64, 14, 24,
+      24, 54, 64, 64, 34, 74, 89
+    }
+  };
@@ -0,0 +1,191 @@
+/* utterancegen.c -- Utterance building rules generator
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Prints the utterance_rules.c source with the rule tables
+ * derived from the original sound composition logic.
+ * Run "make utterance-rules" to regenerate it.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include "utterance.h"
+
+
+/* Local data */
+
+/* Original sound offsets tables for phoncodes from 6 to 41 */
+static const uint8_t soundset1[] =
+  {
+    0, 0, 0, 0, 5, 5,
+    5, 5, 0, 0, 0, 5,
+    5, 5, 0, 0, 0, 5,
+    5, 5, 0, 0, 0, 5,
+    5, 5, 0, 5, 0, 0,
+    0, 5, 5, 5, 0, 5
+  };
+static const uint8_t soundset2[] =
+  {
+    10, 20, 20, 20, 70, 50,
+    60, 60, 40, 10, 20, 80,
+    50, 60, 10, 20, 30, 50,
+    60, 70, 10, 20, 30, 50,
+    60, 70, 20, 60, 10, 20,
+    20, 50, 60, 60, 30, 70
+  };
+
+static const char *kinds[] =
+  {
+    "CONSONANT_PLAIN",
+    "CONSONANT_PAIR",
+    "CONSONANT_SOFTENED",
+    "CONSONANT_VARIED",
+    "CONSONANT_STOP"
+  };
+
+
+/* Local subroutines */
+
+/* Derive sound sequence rule for consonant phoncode a */
+static consonant_rule_t consonant_rule(uint8_t a)
+{
+  consonant_rule_t rule = { CONSONANT_PLAIN, 0, 0, 0 };
+
+  if (a > 41)
+    rule.sound = 189;
+  else if (a > 33)
+    {
+      rule.sound = a + 145;
+      if (a == 40)
+        rule.kind = CONSONANT_VARIED;
+    }
+  else if (a > 31)
+    {
+      rule.kind = CONSONANT_PAIR;
+      rule.sound = a + 143;
+      rule.extra = a + 145;
+    }
+  else if (a > 19)
+    {
+      rule.kind = ((a < 23) || ((a > 25) && (a < 29))) ? CONSONANT_SOFTENED : CONSONANT_PAIR;
+      rule.sound = a + 143;
+      rule.extra = a + 119;
+    }
+  else if (a > 13)
+    rule.sound = a + 119;
+  else
+    {
+      rule.kind = CONSONANT_STOP;
+      rule.sound = a + 117;
+      rule.extra = a + 99;
+      if (a == 10)
+        rule.alternative = 122;
+    }
+
+  return rule;
+}
+
+/* Derive stage offset for vowel a preceded by phoncode b */
+static int vowel_onset_offset(uint8_t a, uint8_t b, int stage)
+{
+  int last = a == 5;
+
+  if ((b > 5) && (b < 42))
+    switch (stage)
+      {
+      case 0:
+        return soundset2[b - 6] - last;
+      case 1:
+        return soundset1[b - 6] - last;
+      default:
+        return soundset1[b - 6] + 95 - last;
+      }
+  else if ((b > 5) && !stage)
+    return 90 - last;
+  else if (stage == 1)
+    return last ? 4 : 0;
+  return last ? 99 : 95;
+}
+
+/* Derive stage 4 offset for vowel a followed by phoncode c */
+static int vowel_coda_offset(uint8_t a, uint8_t c)
+{
+  int last = a == 5;
+
+  if (c < 6)
+    return last ? 99 : 95;
+  else if (c < 42)
+    return soundset2[c - 6] + 5 - last;
+  return 90 - last;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  uint8_t a, b;
+
+  printf("/* utterance_rules.c -- Utterance building rule tables\n"
+         " *\n"
+         " * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk\n"
+         " * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>\n"
+         " * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>\n"
+         " * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>\n"
+         " *\n"
+         " * SPDX-License-Identifier: MIT\n"
+         " */\n"
+         "\n"
+         "/* This file is generated by utterancegen. Do not edit. */\n"
+         "\n"
+         "#include <stdint.h>\n"
+         "\n"
+         "#include \"utterance.h\"\n"
+         "\n"
+         "\n"
+         "const consonant_rule_t consonant_rules[CONSONANTS] =\n"
+         "  {\n");
+  for (a = CONSONANTS_START; a < (CONSONANTS_START + CONSONANTS); a++)
+    {
+      consonant_rule_t rule = consonant_rule(a);
+      printf("    { %s, %u, %u, %u }%s\n", kinds[rule.kind],
+             rule.sound, rule.extra, rule.alternative,
+             (a < (CONSONANTS_START + CONSONANTS - 1)) ? "," : "");
+    }
+  printf("  };\n"
+         "\n"
+         "const int8_t vowel_onset[2][VOWEL_CONTEXTS][3] =\n"
+         "  {\n");
+  for (a = 4; a < 6; a++)
+    {
+      printf("    {");
+      for (b = 0; b < VOWEL_CONTEXTS; b++)
+        printf("%s%s{ %d, %d, %d }", b ? "," : "", (b % 4) ? " " : "\n      ",
+               vowel_onset_offset(a, b, 0), vowel_onset_offset(a, b, 1),
+               vowel_onset_offset(a, b, 2));
+      printf("\n    }%s\n", (a < 5) ? "," : "");
+    }
+  printf("  };\n"
+         "\n"
+         "const uint8_t vowel_coda[2][VOWEL_CONTEXTS - 1] =\n"
+         "  {\n");
+  for (a = 4; a < 6; a++)
+    {
+      printf("    {");
+      for (b = 0; b < (VOWEL_CONTEXTS - 1); b++)
+        printf("%s%s%d", b ? "," : "", (b % 12) ? " " : "\n      ",
+               vowel_coda_offset(a, b));
+      printf("\n    }%s\n", (a < 5) ? "," : "");
+    }
+  printf("  };\n");
+
+  return 0;
+}
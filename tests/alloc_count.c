@@ -0,0 +1,164 @@
+/* alloc_count.c -- Check that a reused engine does not allocate memory
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * The program is linked with the allocation functions wrapped,
+ * so every heap allocation made by the library is counted here.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ru_tts.h"
+
+
+/* Local macros */
+
+#define WAVE_SIZE 4096
+
+
+/* Local data */
+
+static const char *texts[] =
+  {
+    "Съешь же ещё этих мягких французских булок, да выпей чаю.",
+    "В 1991 году: 3,5 килограмма — это много? Нет! А 12.75 рубля...",
+    "Он сказал: «Привет». Она ответила; потом ушла.",
+    "Информация, коммуникация, синхронизация, документация"
+  };
+
+static unsigned long allocations = 0;
+static char wave[WAVE_SIZE];
+static char lent[WAVE_SIZE];
+
+
+/* Allocation wrappers */
+
+extern void *__real_malloc(size_t size);
+extern void *__real_calloc(size_t nmemb, size_t size);
+extern void *__real_realloc(void *ptr, size_t size);
+
+void *__wrap_malloc(size_t size)
+{
+  allocations++;
+  return __real_malloc(size);
+}
+
+void *__wrap_calloc(size_t nmemb, size_t size)
+{
+  allocations++;
+  return __real_calloc(nmemb, size);
+}
+
+void *__wrap_realloc(void *ptr, size_t size)
+{
+  allocations++;
+  return __real_realloc(ptr, size);
+}
+
+
+/* Local subroutines */
+
+/* Sound consumer doing nothing */
+static int consume(void *buffer, size_t size, void *user_data)
+{
+  (*(size_t *) user_data) += size;
+  return 0;
+}
+
+/* Buffer lender for direct rendering */
+static void *lend(void *user_data, size_t *size)
+{
+  *size = sizeof(lent);
+  return lent;
+}
+
+/* Commit callback for direct rendering */
+static int commit(void *user_data, size_t size)
+{
+  return consume(lent, size, user_data);
+}
+
+/* Speak all the texts in every way the engine supports */
+static size_t speak(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                    const ru_tts_compiled_conf_t *compiled)
+{
+  size_t total = 0;
+  unsigned int i;
+
+  for (i = 0; i < sizeof(texts) / sizeof(texts[0]); i++)
+    {
+      size_t length = strlen(texts[i]);
+      size_t n;
+
+      ru_tts_engine_transfer(engine, config, texts[i], wave, sizeof(wave), consume, &total);
+      ru_tts_engine_transfer_compiled(engine, compiled, texts[i], length, wave, sizeof(wave), consume, &total);
+      ru_tts_engine_transfer_direct(engine, config, texts[i], length, lend, commit, &total);
+
+      ru_tts_stream_begin(engine, config, wave, sizeof(wave), consume, &total);
+      for (n = 0; n < length; n += 7)
+        ru_tts_stream_push(engine, texts[i] + n, ((length - n) < 7) ? (length - n) : 7);
+      ru_tts_stream_finish(engine);
+
+      ru_tts_read_begin(engine, config, texts[i], length);
+      while ((n = ru_tts_read(engine, lent, 500)) == 500)
+        total += n;
+      total += n;
+    }
+
+  return total;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  ru_tts_engine_t *engine;
+  ru_tts_compiled_conf_t *compiled;
+  ru_tts_conf_t config;
+  unsigned long count;
+  size_t total;
+  int rc = EXIT_SUCCESS;
+
+  ru_tts_config_init(&config);
+  config.flags |= INPUT_UTF8;
+  config.sample_rate = 22050;
+  compiled = ru_tts_config_compile(&config);
+  engine = ru_tts_engine_new();
+  if (!(compiled && engine && !ru_tts_engine_word_cache(engine, 64)))
+    {
+      fprintf(stderr, "Engine creation failure\n");
+      return EXIT_FAILURE;
+    }
+
+  /* Warm up */
+  speak(engine, &config, compiled);
+
+  count = allocations;
+  total = speak(engine, &config, compiled);
+  count = allocations - count;
+  printf("Steady state: %lu allocations for %lu bytes of sound\n",
+         count, (unsigned long) total);
+  if (count || !total)
+    rc = EXIT_FAILURE;
+
+  count = allocations;
+  ru_tts_transfer(&config, texts[0], wave, sizeof(wave), consume, &total);
+  count = allocations - count;
+  printf("Legacy transfer: %lu allocations\n", count);
+  if (count != 1)
+    rc = EXIT_FAILURE;
+
+  ru_tts_engine_free(engine);
+  ru_tts_compiled_conf_free(compiled);
+  return rc;
+}
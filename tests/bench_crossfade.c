@@ -0,0 +1,95 @@
+/* bench_crossfade.c -- Measure crossfading speed
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Vowels are mostly made of crossfaded periods, so a text
+ * full of them is spoken and the speed is reported in seconds
+ * of speech per second of processor time. To compare with
+ * the scalar loop build the library with "-U__SSE2__"
+ * in CFLAGS.
+ *
+ * This benchmark is not run by "make check". Build it
+ * by "make benchmarks" and run it by hand.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ru_tts.h"
+
+
+/* Local macros */
+
+#define TEXT_REPEAT 1000
+
+/* Native sample rate of the speech */
+#define SAMPLE_RATE 10000.0
+
+
+/* Local data */
+
+/* KOI8-R text */
+static const char phrase[] =
+  "\xe1\xd5, \xf5\xcc\xd1! \xe1\xd1 \xc9\xd1 \xcf\xc0\xd1 \xd5\xc1\xc5, "
+  "\xe5\xd7\xc1 \xc9 \xe0\xcc\xd1 \xd0\xcf\xc0\xd4 \xd5 \xcf\xcb\xce\xc1. "
+  "\xe1\xd1, \xc1\xd5, \xdc\xcf\xdc; \xd5\xc0, \xc9\xc1\xc9\xc1, \xcf\xd1"
+  "\xcf\xd1! ";
+
+
+/* Local subroutines */
+
+/* Processor time of the calling thread in seconds */
+static double cpu_time(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  return ((double) t.tv_sec) + ((double) t.tv_nsec) / 1.0e9;
+}
+
+/* Sound counter */
+static int count(void *buffer, size_t size, void *user_data)
+{
+  *((unsigned long *) user_data) += size;
+  return 0;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  ru_tts_engine_t *engine = ru_tts_engine_new();
+  ru_tts_conf_t config;
+  size_t length = sizeof(phrase) - 1;
+  unsigned long size = 0;
+  char wave[4096];
+  char *text;
+  double start;
+  unsigned int i;
+
+  text = malloc(length * TEXT_REPEAT);
+  if (!engine || !text)
+    return EXIT_FAILURE;
+  for (i = 0; i < TEXT_REPEAT; i++)
+    memcpy(text + i * length, phrase, length);
+  length *= TEXT_REPEAT;
+
+  ru_tts_config_init(&config);
+  start = cpu_time();
+  ru_tts_engine_transfer_n(engine, &config, text, length, wave, sizeof(wave), count, &size);
+  printf("Vowel speech: %.1f seconds of speech per second\n",
+         ((double) size) / SAMPLE_RATE / (cpu_time() - start));
+
+  ru_tts_engine_free(engine);
+  free(text);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,121 @@
+/* bench_noise.c -- Measure noise generation speed
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Noise waveforms of fully synthetic sounds are produced sample
+ * by sample by the generator, as the sound producer used to do it,
+ * and copied from the precomputed noise bank, as it does now.
+ * The speed is reported in samples per second of processor time.
+ * Then a text full of fricatives is spoken to show the effect
+ * on the speech as a whole.
+ *
+ * This benchmark is not run by "make check". Build it
+ * by "make benchmarks" and run it by hand.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ru_tts.h"
+#include "soundscript.h"
+
+
+/* Local macros */
+
+#define GENERATOR_REPEAT 500
+#define COPY_REPEAT 100000
+#define TEXT_REPEAT 500
+
+/* Native sample rate of the speech */
+#define SAMPLE_RATE 10000.0
+
+
+/* Local data */
+
+/* KOI8-R text */
+static const char phrase[] =
+  "\xfb\xa3\xd0\xcf\xd4, \xdb\xcf\xd2\xcf\xc8, \xdb\xc5\xcc\xc5\xd3\xd4; "
+  "\xd3\xd9\xdd\xc9\xcb \xc9\xdd\xc5\xd4 \xdd\xd5\xcb\xd5 \xd7 \xde\xc1"
+  "\xdd\xc5. \xe6\xd9\xd2\xcb\xce\xd5\xcc \xc6\xc9\xcc\xc9\xce, \xd3\xd7"
+  "\xc9\xd3\xd4\xce\xd5\xcc \xd3\xd5\xd3\xcc\xc9\xcb, \xda\xc1\xdb\xc9\xd0"
+  "\xc5\xcc\xc1 \xdb\xc9\xdb\xcb\xc1! ";
+
+static noise_bank_t bank;
+
+
+/* Local subroutines */
+
+/* Processor time of the calling thread in seconds */
+static double cpu_time(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  return ((double) t.tv_sec) + ((double) t.tv_nsec) / 1.0e9;
+}
+
+/* Sound counter */
+static int count(void *buffer, size_t size, void *user_data)
+{
+  *((unsigned long *) user_data) += size;
+  return 0;
+}
+
+/* Report the noise production speed */
+static void report(const char *method, unsigned int repeat, double start)
+{
+  printf("%-9s: %.1f million samples per second\n", method,
+         ((double) repeat) * NOISE_SOUNDS * NOISE_TABLE_LENGTH / (cpu_time() - start) / 1.0e6);
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  ru_tts_engine_t *engine = ru_tts_engine_new();
+  ru_tts_conf_t config;
+  size_t length = sizeof(phrase) - 1;
+  unsigned long size = 0;
+  char wave[4096];
+  char *text;
+  double start;
+  unsigned int i, k;
+
+  text = malloc(length * TEXT_REPEAT);
+  if (!engine || !text)
+    return EXIT_FAILURE;
+
+  start = cpu_time();
+  for (i = 0; i < GENERATOR_REPEAT; i++)
+    noise_bank_setup(&bank);
+  report("Generator", GENERATOR_REPEAT, start);
+
+  start = cpu_time();
+  for (i = 0; i < COPY_REPEAT; i++)
+    for (k = 0; k < NOISE_SOUNDS; k++)
+      memcpy(bank.samples[(i + k) % NOISE_SOUNDS], noise_bank.samples[k], NOISE_TABLE_LENGTH);
+  report("Bank copy", COPY_REPEAT, start);
+
+  for (i = 0; i < TEXT_REPEAT; i++)
+    memcpy(text + i * length, phrase, length);
+  length *= TEXT_REPEAT;
+  ru_tts_config_init(&config);
+  start = cpu_time();
+  ru_tts_engine_transfer_n(engine, &config, text, length, wave, sizeof(wave), count, &size);
+  printf("Fricative speech: %.1f seconds of speech per second\n",
+         ((double) size) / SAMPLE_RATE / (cpu_time() - start));
+
+  ru_tts_engine_free(engine);
+  free(text);
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,121 @@
+/* bench_normalize.c -- Measure source text normalization speed
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Long texts are normalized without transcription, first
+ * byte by byte and then with the plain letter runs kernel
+ * chosen for the processor, if any. The speed is reported
+ * in megabytes of source text per second of processor time.
+ *
+ * This benchmark is not run by "make check". Build it
+ * by "make benchmarks" and run it by hand.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ru_tts.h"
+#include "transcription.h"
+
+
+/* Local macros */
+
+#define TEXT_REPEAT 100000
+
+
+/* Local data */
+
+static const struct
+{
+  const char *name;
+  const char *phrase;
+  int flags;
+} texts[] =
+  {
+    { "koi8-r plain",
+      "\xcd\xd9 \xdb\xcc\xc9 \xd0\xcf \xcc\xc5\xd3\xd5 \xc9 "
+      "\xd7\xc9\xc4\xc5\xcc\xc9 \xcb\xc1\xcb \xd3\xd4\xc1\xd2\xd9\xca "
+      "\xc4\xc5\xc4 \xd3 \xd7\xce\xd5\xcb\xcf\xcd \xce\xc5\xd3\xcc\xc9 "
+      "\xc4\xcf\xcd\xcf\xca \xc2\xcf\xcc\xd8\xdb\xd5\xc0 "
+      "\xcb\xcf\xd2\xda\xc9\xce\xd5 \xc7\xd2\xc9\xc2\xcf\xd7 ", 0 },
+    { "koi8-r punctuated",
+      "\xf3\xdf\xc5\xdb\xd8 \xd6\xc5 \xc5\xdd\xa3 \xdc\xd4\xc9\xc8 \xcd\xd1"
+      "\xc7\xcb\xc9\xc8 \xc6\xd2\xc1\xce\xc3\xd5\xda\xd3\xcb\xc9\xc8 \xc2\xd5"
+      "\xcc\xcf\xcb, \xc4\xc1 \xd7\xd9\xd0\xc5\xca \xde\xc1\xc0. ", 0 },
+    { "ASCII",
+      "The quick brown fox jumps over the lazy dog, and then it runs away. ", 0 },
+    { "UTF-8",
+      "Съешь же ещё этих мягких французских булок, да выпей чаю. ", INPUT_UTF8 }
+  };
+
+static input_t input;
+
+
+/* Local subroutines */
+
+/* Processor time of the calling thread in seconds */
+static double cpu_time(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  return ((double) t.tv_sec) + ((double) t.tv_nsec) / 1.0e9;
+}
+
+/* Normalize the whole text and report the speed */
+static void normalize(const char *name, const char *method, const char *text, size_t length)
+{
+  double start = cpu_time();
+
+  input.start = input.text;
+  input.end = input.text;
+  input.word_start = input.text;
+  input.word_end = input.text;
+  input.source = text;
+  input.source_end = text + length;
+  while (input_fetch(&input))
+    input.start = input.end;
+  printf("%-17s %-11s: %.1f MB per second\n", name, method,
+         ((double) length) / (cpu_time() - start) / 1048576.0);
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  unsigned int i, j;
+
+  for (i = 0; i < sizeof(texts) / sizeof(texts[0]); i++)
+    {
+      size_t length = strlen(texts[i].phrase);
+      char *text = malloc(length * TEXT_REPEAT);
+
+      if (!text)
+        return EXIT_FAILURE;
+      for (j = 0; j < TEXT_REPEAT; j++)
+        memcpy(text + j * length, texts[i].phrase, length);
+      length *= TEXT_REPEAT;
+
+      input_reset(&input, texts[i].flags);
+      if (input.plain_run)
+        {
+          input.plain_run = NULL;
+          normalize(texts[i].name, "byte by byte", text, length);
+          input_reset(&input, texts[i].flags);
+          normalize(texts[i].name, "plain runs", text, length);
+        }
+      else normalize(texts[i].name, "byte by byte", text, length);
+      free(text);
+    }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,103 @@
+/* bench_phrase_split.c -- Measure phrase splitting speed
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Long clauses without punctuation are split into phrases
+ * by phoncode sequences, and the sequence lists are tested
+ * at almost every transcription point. Such a text is spoken
+ * and the speed is reported in seconds of speech per second
+ * of processor time.
+ *
+ * This benchmark is not run by "make check". Build it
+ * by "make benchmarks" and run it by hand.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ru_tts.h"
+
+
+/* Local macros */
+
+#define TEXT_REPEAT 500
+
+/* Native sample rate of the speech */
+#define SAMPLE_RATE 10000.0
+
+
+/* Local data */
+
+/* KOI8-R text */
+static const char phrase[] =
+  "\xcd\xd9 \xdb\xcc\xc9 \xd0\xcf \xcc\xc5\xd3\xd5 \xc9 "
+  "\xd7\xc9\xc4\xc5\xcc\xc9 \xcb\xc1\xcb \xd3\xd4\xc1\xd2\xd9\xca "
+  "\xc4\xc5\xc4 \xd3 \xd7\xce\xd5\xcb\xcf\xcd \xce\xc5\xd3\xcc\xc9 "
+  "\xc4\xcf\xcd\xcf\xca \xc2\xcf\xcc\xd8\xdb\xd5\xc0 "
+  "\xcb\xcf\xd2\xda\xc9\xce\xd5 \xc7\xd2\xc9\xc2\xcf\xd7 \xc1 "
+  "\xd0\xcf\xd4\xcf\xcd \xcf\xce\xc9 \xc4\xcf\xcc\xc7\xcf "
+  "\xd3\xc9\xc4\xc5\xcc\xc9 \xd5 \xd2\xc5\xcb\xc9 \xc9 "
+  "\xc7\xcf\xd7\xcf\xd2\xc9\xcc\xc9 \xcf \xd4\xcf\xcd \xde\xd4\xcf "
+  "\xda\xc1\xd7\xd4\xd2\xc1 \xc2\xd5\xc4\xc5\xd4 "
+  "\xd4\xa3\xd0\xcc\xd9\xca \xc4\xc5\xce\xd8 \xc9 "
+  "\xcd\xcf\xd6\xce\xcf \xc2\xd5\xc4\xc5\xd4 \xd3\xce\xcf\xd7\xc1 "
+  "\xd0\xcf\xca\xd4\xc9 \xd7 \xcc\xc5\xd3 ";
+
+
+/* Local subroutines */
+
+/* Processor time of the calling thread in seconds */
+static double cpu_time(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  return ((double) t.tv_sec) + ((double) t.tv_nsec) / 1.0e9;
+}
+
+/* Sound counter */
+static int count(void *buffer, size_t size, void *user_data)
+{
+  *((unsigned long *) user_data) += size;
+  return 0;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  ru_tts_engine_t *engine = ru_tts_engine_new();
+  ru_tts_conf_t config;
+  size_t length = sizeof(phrase) - 1;
+  unsigned long size = 0;
+  char wave[4096];
+  char *text;
+  double start;
+  unsigned int i;
+
+  text = malloc(length * TEXT_REPEAT);
+  if (!engine || !text)
+    return EXIT_FAILURE;
+  for (i = 0; i < TEXT_REPEAT; i++)
+    memcpy(text + i * length, phrase, length);
+  length *= TEXT_REPEAT;
+
+  ru_tts_config_init(&config);
+  start = cpu_time();
+  ru_tts_engine_transfer_n(engine, &config, text, length, wave, sizeof(wave), count, &size);
+  printf("Unpunctuated speech: %.1f seconds of speech per second\n",
+         ((double) size) / SAMPLE_RATE / (cpu_time() - start));
+
+  ru_tts_engine_free(engine);
+  free(text);
+  return EXIT_SUCCESS;
+}
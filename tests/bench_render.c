@@ -0,0 +1,156 @@
+/* bench_render.c -- Measure sound rendering speed
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * A long corpus is spoken with several wave buffer sizes
+ * and the speed is reported in seconds of speech per second
+ * of processor time. Then the same amount of data is passed
+ * to the sink byte by byte through an out of line call,
+ * as the sound producer used to do it, byte by byte inline
+ * and block by block into the reserved room.
+ *
+ * This benchmark is not run by "make check". Build it
+ * by "make benchmarks" and run it by hand.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ru_tts.h"
+#include "sink.h"
+
+
+/* Local macros */
+
+#define CORPUS_REPEAT 500
+
+/* Native sample rate of the speech */
+#define SAMPLE_RATE 10000.0
+
+/* Amount of data passed to the sink directly */
+#define SINK_DATA_SIZE (256L << 20)
+
+/* Length of runs written by block */
+#define RUN_LENGTH 100
+
+
+/* Local data */
+
+/* KOI8-R text */
+static const char phrase[] =
+  "\xf3\xdf\xc5\xdb\xd8 \xd6\xc5 \xc5\xdd\xa3 \xdc\xd4\xc9\xc8 \xcd\xd1"
+  "\xc7\xcb\xc9\xc8 \xc6\xd2\xc1\xce\xc3\xd5\xda\xd3\xcb\xc9\xc8 \xc2\xd5"
+  "\xcc\xcf\xcb, \xc4\xc1 \xd7\xd9\xd0\xc5\xca \xde\xc1\xc0. \xf7 \xcc\xc5"
+  "\xd3\xd5 \xd2\xcf\xc4\xc9\xcc\xc1\xd3\xd8 \xa3\xcc\xcf\xde\xcb\xc1, "
+  "\xd7 \xcc\xc5\xd3\xd5 \xcf\xce\xc1 \xd2\xcf\xd3\xcc\xc1; \xda\xc9\xcd"
+  "\xcf\xca \xc9 \xcc\xc5\xd4\xcf\xcd \xd3\xd4\xd2\xcf\xca\xce\xc1\xd1, "
+  "\xda\xc5\xcc\xa3\xce\xc1\xd1 \xc2\xd9\xcc\xc1. \xf3\xc5\xc7\xcf\xc4\xce"
+  "\xd1 25 \xc4\xc5\xcb\xc1\xc2\xd2\xd1, \xce\xc1 \xd5\xcc\xc9\xc3\xc5 "
+  "\xcd\xcf\xd2\xcf\xda! ";
+
+static const size_t buffer_sizes[] = { 64, 4096, 65536 };
+
+static uint8_t wave[65536];
+
+
+/* Local subroutines */
+
+/* Processor time of the calling thread in seconds */
+static double cpu_time(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  return ((double) t.tv_sec) + ((double) t.tv_nsec) / 1.0e9;
+}
+
+/* Sound counter */
+static int count(void *buffer, size_t size, void *user_data)
+{
+  *((unsigned long *) user_data) += size;
+  return 0;
+}
+
+/* Pass one byte of data as the sound producer used to do */
+static void __attribute__((noinline)) put_byte(sink_t *consumer, int8_t byte)
+{
+  ((int8_t *)(consumer->buffer))[consumer->buffer_offset++] = byte;
+  if (consumer->buffer_offset >= consumer->bufsize)
+    sink_flush(consumer);
+}
+
+/* Report the sink speed */
+static void report(const char *method, double start)
+{
+  printf("%-22s: %.0f MB per second\n", method,
+         ((double) SINK_DATA_SIZE) / (cpu_time() - start) / 1048576.0);
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  ru_tts_engine_t *engine = ru_tts_engine_new();
+  ru_tts_conf_t config;
+  size_t length = sizeof(phrase) - 1;
+  unsigned long size;
+  sink_t consumer;
+  char *text;
+  double start;
+  long n;
+  unsigned int i;
+
+  text = malloc(length * CORPUS_REPEAT);
+  if (!engine || !text)
+    return EXIT_FAILURE;
+  for (i = 0; i < CORPUS_REPEAT; i++)
+    memcpy(text + i * length, phrase, length);
+  length *= CORPUS_REPEAT;
+
+  ru_tts_config_init(&config);
+  for (i = 0; i < sizeof(buffer_sizes) / sizeof(buffer_sizes[0]); i++)
+    {
+      size = 0;
+      start = cpu_time();
+      ru_tts_engine_transfer_n(engine, &config, text, length, wave, buffer_sizes[i], count, &size);
+      printf("Wave buffer of %5lu bytes: %.1f seconds of speech per second\n",
+             (unsigned long) buffer_sizes[i], ((double) size) / SAMPLE_RATE / (cpu_time() - start));
+    }
+  ru_tts_engine_free(engine);
+  free(text);
+
+  size = 0;
+  sink_setup(&consumer, wave, sizeof(wave), count, &size);
+  start = cpu_time();
+  for (n = 0; n < SINK_DATA_SIZE; n++)
+    put_byte(&consumer, (int8_t) n);
+  report("Out of line byte calls", start);
+
+  start = cpu_time();
+  for (n = 0; n < SINK_DATA_SIZE; n++)
+    sink_put(&consumer, (int8_t) n);
+  report("Inline byte calls", start);
+
+  start = cpu_time();
+  for (n = 0; n < SINK_DATA_SIZE; )
+    {
+      size_t room = sink_reserve(&consumer, 1);
+      size_t run = (room < RUN_LENGTH) ? room : RUN_LENGTH;
+      memset((uint8_t *) consumer.buffer + consumer.buffer_offset, (int) n, run);
+      consumer.buffer_offset += run;
+      n += run;
+    }
+  report("Reserved blocks", start);
+
+  return EXIT_SUCCESS;
+}
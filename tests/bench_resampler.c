@@ -0,0 +1,132 @@
+/* bench_resampler.c -- Measure output sample rate conversion speed
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Native sound is converted to the common output sample rates
+ * in every sample format. The throughput is reported in output
+ * samples per second of processor time of the single thread doing
+ * the work, so it is the speed per core.
+ *
+ * This benchmark is not run by "make check". Build it
+ * by "make benchmarks" and run it by hand.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include "ru_tts.h"
+#include "resampler.h"
+
+
+/* Local macros */
+
+/* Seconds of native sound converted in each case */
+#define SOUND_DURATION 600
+
+/* Samples passed in and taken out at once */
+#define BLOCK_SIZE 4096
+
+
+/* Local data */
+
+static const int rates[] = { 8000, 16000, 22050, 44100, 48000 };
+
+static const struct
+{
+  const char *name;
+  int format;
+  size_t size;
+} formats[] =
+  {
+    { "s8", SAMPLE_FORMAT_S8, 1 },
+    { "s16le", SAMPLE_FORMAT_S16_LE, 2 },
+    { "f32", SAMPLE_FORMAT_F32, 4 }
+  };
+
+static resampler_t resampler;
+static int8_t input[BLOCK_SIZE];
+static float output[BLOCK_SIZE];
+
+
+/* Local subroutines */
+
+/* Processor time of the calling thread in seconds */
+static double cpu_time(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  return ((double) t.tv_sec) + ((double) t.tv_nsec) / 1.0e9;
+}
+
+/* Convert the sound and return number of output samples */
+static unsigned long convert(int format)
+{
+  unsigned long produced = 0;
+  unsigned long block;
+  size_t n;
+
+  for (block = 0; block < ((unsigned long) SOUND_DURATION * NATIVE_SAMPLE_RATE / BLOCK_SIZE); block++)
+    {
+      size_t offset = 0;
+      do
+        {
+          size_t length = BLOCK_SIZE - offset;
+          n = resample(&resampler, input + offset, &length, output, BLOCK_SIZE, format);
+          offset += length;
+          produced += n;
+        }
+      while (n == BLOCK_SIZE);
+    }
+  resampler_finish(&resampler);
+  do
+    {
+      size_t length = 0;
+      n = resample(&resampler, NULL, &length, output, BLOCK_SIZE, format);
+      produced += n;
+    }
+  while (n == BLOCK_SIZE);
+  return produced;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  uint32_t seed = 1;
+  unsigned int i, j;
+
+  /* Triangle wave with some noise */
+  for (i = 0; i < BLOCK_SIZE; i++)
+    {
+      int phase = i % 96;
+      seed = seed * 1103515245UL + 12345UL;
+      input[i] = (int8_t)(((phase < 48) ? phase : (96 - phase)) * 2 - 48 +
+                          (int)((seed >> 16) & 0x0F) - 8);
+    }
+
+  for (i = 0; i < sizeof(rates) / sizeof(rates[0]); i++)
+    for (j = 0; j < sizeof(formats) / sizeof(formats[0]); j++)
+      {
+        unsigned long produced;
+        double start;
+
+        if (resampler_setup(&resampler, rates[i]))
+          continue;
+        start = cpu_time();
+        produced = convert(formats[j].format);
+        printf("%5d Hz %-5s: %.1f million samples per second\n", rates[i], formats[j].name,
+               ((double) produced) / (cpu_time() - start) / 1.0e6);
+      }
+
+  return EXIT_SUCCESS;
+}
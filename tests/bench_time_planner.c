@@ -0,0 +1,182 @@
+/* bench_time_planner.c -- Measure time planning speed
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Synthetic phrases of random syllables are planned one by one
+ * and the time per phrase is reported. Then the phoncodes of these
+ * phrases are classified pair by pair as the planner does it,
+ * searching the phoncode sets, as it used to, and looking up
+ * the property table.
+ *
+ * This benchmark is not run by "make check". Build it
+ * by "make benchmarks" and run it by hand.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "soundscript.h"
+#include "transcription.h"
+
+
+/* Local macros */
+
+#define PHRASES 1024
+#define PLAN_REPEAT 200
+#define CLASSIFY_REPEAT 200
+
+/* Phrase length limits in syllables */
+#define MIN_SYLLABLES 4
+#define MAX_SYLLABLES 24
+
+
+/* Local data */
+
+/* Original phoncode sets (the order is significant) */
+static const uint8_t set1[] = { 10, 15, 18, 16, 19, 8, 13, 14, 17 };
+static const uint8_t set2[] = { 6, 11, 7, 12, 9 };
+static const uint8_t set3[] = { 20, 23, 21, 24, 22, 25 };
+static const uint8_t set4[] = { 34, 37, 35, 38, 32, 36, 39, 33, 40, 41 };
+static const uint8_t set5[] = { 26, 29, 27, 30, 28, 31 };
+static const uint8_t set6[] = { 10, 14, 17, 15, 18, 16, 19, 8, 13 };
+static const uint8_t set7[] = { 6, 11, 7, 12, 9, 20, 23, 21, 24, 22, 25 };
+static const uint8_t set8[] = { 20, 23, 26, 29, 15, 18, 6, 11, 34, 37 };
+static const uint8_t set9[] = { 21, 24, 27, 30, 14, 17, 16, 19, 7, 12, 35, 38, 36, 39, 32, 33, 9 };
+static const uint8_t set10[] = { 22, 25, 28, 31, 40, 41 };
+
+static uint8_t phrases[PHRASES][TRANSCRIPTION_BUFFER_SIZE];
+static uint16_t ends[PHRASES];
+static time_plan_t draft;
+static planner_workspace_t scratch;
+
+
+/* Local subroutines */
+
+/* Processor time of the calling thread in seconds */
+static double cpu_time(void)
+{
+  struct timespec t;
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &t);
+  return ((double) t.tv_sec) + ((double) t.tv_nsec) / 1.0e9;
+}
+
+/* Original rank definition */
+static uint8_t rank(uint8_t phoncode)
+{
+  uint8_t rc = 0;
+  if (memchr(set1, phoncode, sizeof(set1)))
+    rc = 1;
+  else if (memchr(set2, phoncode, sizeof(set2)))
+    rc = 2;
+  else if (memchr(set3, phoncode, sizeof(set3)))
+    rc = 3;
+  else if (memchr(set4, phoncode, sizeof(set4)))
+    rc = 4;
+  else if (memchr(set5, phoncode, sizeof(set5)))
+    rc = 5;
+  return rc;
+}
+
+/* Classify a phoncode pair searching the sets */
+static unsigned int search_sets(uint8_t prev, uint8_t cur)
+{
+  unsigned int rc = rank(prev) + rank(cur);
+  if (memchr(set6, cur, sizeof(set6)))
+    rc += 1;
+  else if (memchr(set7, cur, sizeof(set7)))
+    rc += 2;
+  if ((memchr(set8, prev, 4) && memchr(set8, cur, sizeof(set8))) ||
+      (memchr(set9, prev, 4) && memchr(set9, cur, sizeof(set9))) ||
+      (memchr(set10, prev, 4) && memchr(set10, cur, sizeof(set10))))
+    rc += 4;
+  return rc;
+}
+
+/* Classify a phoncode pair by the property table */
+static unsigned int look_up(uint8_t prev, uint8_t cur)
+{
+  uint16_t p = phoncode_properties[prev];
+  uint16_t c = phoncode_properties[cur];
+  unsigned int rc = (p & RANK_MASK) + (c & RANK_MASK);
+  if (c & SET6)
+    rc += 1;
+  else if (c & SET7)
+    rc += 2;
+  if (((p & SET8_HEAD) && (c & SET8)) ||
+      ((p & SET9_HEAD) && (c & SET9)) ||
+      ((p & SET10_HEAD) && (c & SET10)))
+    rc += 4;
+  return rc;
+}
+
+/* Classify all phoncode pairs of all phrases and report the time */
+static unsigned long classify(const char *method, unsigned int (*classifier)(uint8_t, uint8_t))
+{
+  unsigned long sum = 0;
+  double start = cpu_time();
+  unsigned int i, j;
+  uint16_t k;
+
+  for (i = 0; i < CLASSIFY_REPEAT; i++)
+    for (j = 0; j < PHRASES; j++)
+      for (k = TRANSCRIPTION_START + 1; k < ends[j]; k++)
+        sum += classifier(phrases[j][k - 1], phrases[j][k]);
+  printf("%-14s: %.1f ns per phrase\n", method,
+         (cpu_time() - start) * 1.0e9 / CLASSIFY_REPEAT / PHRASES);
+  return sum;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  uint32_t seed = 1;
+  unsigned long planned = 0;
+  double start;
+  unsigned int i, j;
+
+  /* Words of consonant and vowel syllables separated by pauses */
+  for (i = 0; i < PHRASES; i++)
+    {
+      uint16_t k = TRANSCRIPTION_START;
+      unsigned int syllables;
+
+      memset(phrases[i], 43, TRANSCRIPTION_BUFFER_SIZE);
+      seed = seed * 1103515245UL + 12345UL;
+      syllables = MIN_SYLLABLES + (seed >> 16) % (MAX_SYLLABLES - MIN_SYLLABLES + 1);
+      for (j = 0; j < syllables; j++)
+        {
+          seed = seed * 1103515245UL + 12345UL;
+          phrases[i][k++] = 6 + (seed >> 16) % 36;
+          phrases[i][k++] = (seed >> 8) % 6;
+          if (!((seed >> 24) & 3))
+            k++;
+        }
+      seed = seed * 1103515245UL + 12345UL;
+      phrases[i][k++] = 44 + (seed >> 16) % 8;
+      ends[i] = k;
+    }
+
+  start = cpu_time();
+  for (i = 0; i < PLAN_REPEAT; i++)
+    for (j = 0; j < PHRASES; j++)
+      if (plan_time(phrases[j], ends[j], draft, &scratch))
+        planned++;
+  printf("Time planning : %.1f ns per phrase (%lu planned)\n",
+         (cpu_time() - start) * 1.0e9 / PLAN_REPEAT / PHRASES, planned);
+
+  if (classify("Set search", search_sets) != classify("Property table", look_up))
+    return EXIT_FAILURE;
+  return EXIT_SUCCESS;
+}
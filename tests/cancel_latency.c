@@ -0,0 +1,222 @@
+/* cancel_latency.c -- Check synthesis cancellation
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Speech of a long text is cancelled from the consumer itself,
+ * where nothing more must be delivered afterwards, and from
+ * another thread, where the transfer or the pull must return
+ * promptly. The latency is limited in processor time consumed
+ * by the speaking thread after the cancel, so the check does not
+ * depend on the host load. The wall clock latency is reported
+ * in the log as well.
+ */
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ru_tts.h"
+
+
+/* Local macros */
+
+#define SPEECH_REPEAT 2000
+#define PULL_SIZE 2048
+
+/* Synthesis is let run for 20 ms before the cancel */
+#define CANCEL_DELAY 20000000L
+
+/* Acceptable latency in milliseconds of processor time */
+#define MAX_LATENCY 5.0
+
+
+/* Local data types */
+
+/* Test case description */
+typedef struct
+{
+  ru_tts_engine_t *engine;
+  int pull;
+  int started;
+  unsigned long calls;
+  unsigned long calls_after_cancel;
+  int cancelled;
+  struct timespec returned;
+  struct timespec returned_cpu;
+  pthread_mutex_t lock;
+  pthread_cond_t start;
+} job_t;
+
+
+/* Local data */
+
+static const char text[] =
+  "Съешь же ещё этих мягких французских булок, да выпей чаю. "
+  "В 1991 году: 3,5 килограмма — это много? Нет! А 12.75 рубля... ";
+
+static ru_tts_conf_t config;
+static char *speech_text = NULL;
+static size_t speech_text_length = 0;
+
+
+/* Local subroutines */
+
+/* Milliseconds from the first moment to the second one */
+static double elapsed(const struct timespec *from, const struct timespec *to)
+{
+  return ((double)(to->tv_sec - from->tv_sec)) * 1000.0 +
+    ((double)(to->tv_nsec - from->tv_nsec)) / 1000000.0;
+}
+
+/* Mark the speech started for the controlling thread */
+static void mark_started(job_t *job)
+{
+  pthread_mutex_lock(&(job->lock));
+  if (!job->started)
+    {
+      job->started = 1;
+      pthread_cond_signal(&(job->start));
+    }
+  pthread_mutex_unlock(&(job->lock));
+}
+
+/* Consumer cancelling the speech on its third call */
+static int cancel_itself(void *buffer, size_t size, void *user_data)
+{
+  job_t *job = user_data;
+
+  if (job->cancelled)
+    job->calls_after_cancel++;
+  else if (++(job->calls) == 3)
+    {
+      ru_tts_cancel(job->engine);
+      job->cancelled = 1;
+    }
+  return 0;
+}
+
+/* Consumer that only reports the speech start */
+static int consume(void *buffer, size_t size, void *user_data)
+{
+  mark_started(user_data);
+  return 0;
+}
+
+/* Speaking thread */
+static void *speak(void *arg)
+{
+  job_t *job = arg;
+  char wave[4096];
+
+  if (job->pull)
+    {
+      ru_tts_read_begin(job->engine, &config, speech_text, speech_text_length);
+      while (ru_tts_read(job->engine, wave, PULL_SIZE) == PULL_SIZE)
+        mark_started(job);
+    }
+  else ru_tts_engine_transfer_n(job->engine, &config, speech_text, speech_text_length,
+                                wave, sizeof(wave), consume, job);
+  clock_gettime(CLOCK_THREAD_CPUTIME_ID, &(job->returned_cpu));
+  clock_gettime(CLOCK_MONOTONIC, &(job->returned));
+  mark_started(job);
+  return NULL;
+}
+
+/* Cancel the speech from another thread and check the latency */
+static int check_latency(ru_tts_engine_t *engine, int pull)
+{
+  struct timespec delay = { 0, CANCEL_DELAY };
+  struct timespec cancelled, cancelled_cpu;
+  clockid_t speaker_clock;
+  pthread_t speaker;
+  job_t job;
+  double latency, wall_latency;
+  int running;
+
+  memset(&job, 0, sizeof(job));
+  job.engine = engine;
+  job.pull = pull;
+  pthread_mutex_init(&(job.lock), NULL);
+  pthread_cond_init(&(job.start), NULL);
+  if (pthread_create(&speaker, NULL, speak, &job))
+    return 0;
+  if (pthread_getcpuclockid(speaker, &speaker_clock))
+    {
+      pthread_join(speaker, NULL);
+      return 0;
+    }
+
+  pthread_mutex_lock(&(job.lock));
+  while (!job.started)
+    pthread_cond_wait(&(job.start), &(job.lock));
+  pthread_mutex_unlock(&(job.lock));
+  nanosleep(&delay, NULL);
+  clock_gettime(CLOCK_MONOTONIC, &cancelled);
+  running = !clock_gettime(speaker_clock, &cancelled_cpu);
+  ru_tts_cancel(engine);
+  pthread_join(speaker, NULL);
+  pthread_cond_destroy(&(job.start));
+  pthread_mutex_destroy(&(job.lock));
+
+  wall_latency = elapsed(&cancelled, &(job.returned));
+  if (!running || (wall_latency < 0.0))
+    {
+      fprintf(stderr, "%s finished before the cancel\n", pull ? "Pull" : "Transfer");
+      return 0;
+    }
+  latency = elapsed(&cancelled_cpu, &(job.returned_cpu));
+  printf("%s cancel latency: %.3f ms of processor time, %.3f ms of wall clock time\n",
+         pull ? "Pull" : "Transfer", latency, wall_latency);
+  return latency <= MAX_LATENCY;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  ru_tts_engine_t *engine = ru_tts_engine_new();
+  char wave[4096];
+  job_t job;
+  int i;
+  int rc = EXIT_SUCCESS;
+
+  speech_text = malloc(sizeof(text) * SPEECH_REPEAT);
+  if (!engine || !speech_text)
+    return EXIT_FAILURE;
+  for (i = 0; i < SPEECH_REPEAT; i++)
+    {
+      memcpy(speech_text + speech_text_length, text, sizeof(text) - 1);
+      speech_text_length += sizeof(text) - 1;
+    }
+  ru_tts_config_init(&config);
+  config.flags |= INPUT_UTF8;
+
+  /* Nothing is delivered after the cancel */
+  memset(&job, 0, sizeof(job));
+  job.engine = engine;
+  ru_tts_engine_transfer_n(engine, &config, speech_text, speech_text_length,
+                           wave, sizeof(wave), cancel_itself, &job);
+  if (!job.cancelled || job.calls_after_cancel)
+    {
+      fprintf(stderr, "%lu calls after the cancel\n", job.calls_after_cancel);
+      rc = EXIT_FAILURE;
+    }
+
+  /* Speech is stopped promptly from another thread */
+  if (!check_latency(engine, 0) || !check_latency(engine, 1))
+    rc = EXIT_FAILURE;
+
+  ru_tts_engine_free(engine);
+  free(speech_text);
+  return rc;
+}
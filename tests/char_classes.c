@@ -0,0 +1,129 @@
+/* char_classes.c -- Check the character class table
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * The compiled character class table replaces the character lists
+ * the transcription used to search. Classes of every character
+ * are derived here from these lists again and compared with
+ * the table entries.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "transcription.h"
+
+
+/* Local data */
+
+/* Original character lists (the order is significant) */
+static const char *symbols = " ,.;:?!()-+=\"$%&*";
+static const char *char_list = "TNRLMDPZG^JH_WC[FOE\\UQYX]`a'-*()%\"/&$><@+=";
+static const char *consonants = "JMNRL^HC[WSPFTK_ZBVDG";
+static const char *vocalics = "`EI\\QUaYOA";
+static const char *iotated = "`QE\\";
+static const char *ndts = "NDTS";
+static const char *bgdjz = "BGD_Z";
+static const char *letters = "`ABCDEFGHIJKLMNOPQRSTU_VXYZWa[^]+=";
+
+
+/* Local subroutines */
+
+/*
+ * Find character in the first n items of the list.
+ * Returns its index or -1 when it is absent.
+ */
+static int find(const char *list, size_t n, unsigned char c)
+{
+  const char *s = memchr(list, c, n);
+  return s ? (int)(s - list) : -1;
+}
+
+/* Derive classes of the character from the lists */
+static uint32_t derive(unsigned char c)
+{
+  uint32_t cls = 0;
+  int i;
+
+  /* Zero character marking the text end is only voiced */
+  if (!c)
+    return VOICED;
+
+  i = find(symbols, strlen(symbols), c);
+  if (i >= 0)
+    {
+      cls |= SYMBOL;
+      if (i < 13)
+        cls |= SEPARATOR;
+      if (i < 7)
+        cls |= PAUSE;
+      if ((i >= 1) && (i <= 6))
+        cls |= TERMINATOR;
+    }
+
+  i = find(char_list, strlen(char_list), c);
+  if (i >= 0)
+    cls |= ACCEPTED | (((uint32_t) i) << 16);
+
+  i = find(consonants, strlen(consonants), c);
+  if (i >= 0)
+    {
+      cls |= CONSONANT | (((uint32_t) i) << 24);
+      if ((i >= 5) && (i <= 14))
+        cls |= UNVOICED;
+    }
+
+  i = find(vocalics, strlen(vocalics), c);
+  if (i >= 0)
+    {
+      cls |= VOCALIC | (((uint32_t) i) << 24);
+      if (i <= 4)
+        cls |= FRONT;
+      if (find(iotated, strlen(iotated), c) >= 0)
+        cls |= IOTATED;
+    }
+
+  if (find(ndts, strlen(ndts), c) >= 0)
+    cls |= DENTAL;
+  if (find(bgdjz, strlen(bgdjz), c) >= 0)
+    cls |= VOICED;
+  if (find(letters, strlen(letters), c) >= 0)
+    cls |= LETTER;
+
+  return cls;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  unsigned int failures = 0;
+  unsigned int c;
+
+  for (c = 0; c < 256; c++)
+    {
+      uint32_t expected = derive(c);
+      if (char_classes[c] != expected)
+        {
+          fprintf(stderr, "Character 0x%02X: 0x%08lX instead of 0x%08lX\n", c,
+                  (unsigned long) char_classes[c], (unsigned long) expected);
+          failures++;
+        }
+    }
+
+  /* Derived indices must fit their fields */
+  if ((strlen(char_list) > 0x3F) || (strlen(consonants) > 0x1F) || (strlen(vocalics) > 0x1F))
+    failures++;
+
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,136 @@
+/* golden_pcm.c -- Check produced sound against reference checksums
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Sound generation is reworked for speed again and again, but
+ * the output must stay bit-identical. The fixed corpus is spoken
+ * with several configurations at the native sample rate and the
+ * sound is compared with the reference checksums. The 8-bit ones
+ * were produced by the original code. Resampled output is left
+ * to the sample_rates check, since its filter is computed
+ * in floating point.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ru_tts.h"
+
+
+/* Local data */
+
+static const char *corpus[] =
+  {
+    "Привет, мир! Как дела? Всё хорошо.",
+    "В лесу родилась ёлочка, в лесу она росла; зимой и летом стройная, зелёная была.",
+    "Сегодня 25 декабря 2023 года, температура -3,5 градуса, а вчера было 1.25.",
+    "Он сказа+л: \"Это моего+ друга дом, а не твоего+\". Ничего= страшного.",
+    "Съешь же ещё этих мягких французских булок да выпей чаю",
+    "Длинный текст без знаков препинания который тянется и тянется "
+    "потому что автор не любит запятые и точки и пишет всё подряд "
+    "одним большим предложением чтобы проверить как работает разбиение "
+    "на фразы в синтезаторе речи и как он справляется с очень длинными "
+    "предложениями без пауз",
+    "Hello world, this is Latin text: quick brown fox jumps over the lazy dog.",
+    "1 2 3 4 5 6 7 8 9 10 11 12 100 1000 1000000 123456789012 3.14159 2,718",
+    "Что? Где! Когда... Почему?! Зачем; кто: я - ты.",
+    "Э+то о+чень хоро+шая кни+га, её чита+ют все.",
+    "а б в г д е ё ж з и й к л м н о п р с т у ф х ц ч ш щ ъ ы ь э ю я",
+    "Вопрос, вопрос? Ответ! Конец.",
+    "Жили-были дед да баба, и была у них курочка Ряба."
+  };
+
+static const struct
+{
+  const char *name;
+  int speech_rate;
+  int voice_pitch;
+  int intonation;
+  int flags;
+  int sample_format;
+  unsigned long length;
+  uint32_t checksum;
+} references[] =
+  {
+    { "default", 100, 100, 100, 0, SAMPLE_FORMAT_S8,
+      877779, 0xF9FA93AE },
+    { "alternative voice", 100, 100, 100, USE_ALTERNATIVE_VOICE, SAMPLE_FORMAT_S8,
+      880043, 0x22686268 },
+    { "fast, low and flat", 250, 60, 20, 0, SAMPLE_FORMAT_S8,
+      464072, 0x84261C19 },
+    { "slow, high and expressive", 40, 200, 140, USE_ALTERNATIVE_VOICE, SAMPLE_FORMAT_S8,
+      2165655, 0x45E3CD21 },
+    { "16-bit", 100, 100, 100, 0, SAMPLE_FORMAT_S16_LE,
+      1755558, 0x457EF130 },
+    { "16-bit alternative voice", 180, 130, 60, USE_ALTERNATIVE_VOICE, SAMPLE_FORMAT_S16_LE,
+      983352, 0x83021ECD }
+  };
+
+
+/* Local subroutines */
+
+typedef struct
+{
+  unsigned long length;
+  uint32_t checksum;
+} digest_t;
+
+/* Accumulate FNV-1a checksum of the sound */
+static int digest(void *buffer, size_t size, void *user_data)
+{
+  digest_t *result = user_data;
+  const uint8_t *data = buffer;
+  size_t i;
+
+  for (i = 0; i < size; i++)
+    result->checksum = (result->checksum ^ data[i]) * 16777619U;
+  result->length += size;
+  return 0;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  ru_tts_engine_t *engine = ru_tts_engine_new();
+  char wave[4096];
+  unsigned int i, j;
+  int rc = EXIT_SUCCESS;
+
+  if (!engine)
+    return EXIT_FAILURE;
+
+  for (i = 0; i < sizeof(references) / sizeof(references[0]); i++)
+    {
+      ru_tts_conf_t config;
+      digest_t result = { 0, 2166136261U };
+
+      ru_tts_config_init(&config);
+      config.speech_rate = references[i].speech_rate;
+      config.voice_pitch = references[i].voice_pitch;
+      config.intonation = references[i].intonation;
+      config.flags |= references[i].flags | INPUT_UTF8;
+      config.sample_format = references[i].sample_format;
+      for (j = 0; j < sizeof(corpus) / sizeof(corpus[0]); j++)
+        ru_tts_engine_transfer(engine, &config, corpus[j], wave, sizeof(wave), digest, &result);
+      if ((result.length != references[i].length) ||
+          (result.checksum != references[i].checksum))
+        {
+          fprintf(stderr, "%s: %lu bytes, checksum 0x%08lX\n", references[i].name,
+                  result.length, (unsigned long) result.checksum);
+          rc = EXIT_FAILURE;
+        }
+    }
+
+  ru_tts_engine_free(engine);
+  return rc;
+}
@@ -0,0 +1,371 @@
+/* intonation_equivalence.c -- Check the indexed breakpoint search
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Random clause transcriptions with sound scripts built for them
+ * are passed both to the library intonator, which indexes speech
+ * breakpoints in advance, and to its original implementation
+ * searching them from every position, kept here. Intonation stages
+ * of all sounds and the resulting icb_t values must be identical.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "transcription.h"
+#include "soundscript.h"
+#include "modulation.h"
+
+
+/* Local macros */
+
+/* Number of random clauses */
+#define CLAUSES 200000
+
+/* Longest clause transcription */
+#define MAX_CLAUSE 300
+
+
+/* Local data */
+
+static uint8_t transcription[TRANSCRIPTION_BUFFER_SIZE + MAX_SOUNDS];
+static soundscript_t source, expected, actual;
+static modulation_t modulation;
+static unsigned long seed = 1;
+
+
+/* Local subroutines */
+
+/* Simple random numbers */
+static unsigned int next_random(unsigned int limit)
+{
+  seed = seed * 1103515245UL + 12345UL;
+  return (unsigned int)((seed >> 16) % limit);
+}
+
+/*
+ * Original speech breakpoint search
+ * ahead from specified index up to the specified end.
+ *
+ * Returns the last checked code or -1 if nothing found.
+ */
+static int search_breakpoint(uint8_t *transcription, uint16_t end, int start_index)
+{
+  int rc = -1;
+  int i;
+
+  for (i = start_index; i < end; i++)
+    {
+      rc = transcription[i];
+      if (rc != 43)
+        {
+          if (rc > 43)
+            return -1;
+          break;
+        }
+    }
+  for (i++; i < end; i++)
+    {
+      rc = transcription[i];
+      if (rc > 42)
+        return rc;
+    }
+  return -1;
+}
+
+/* Returns index where process was stopped */
+static uint16_t setstage(soundscript_t *script, uint16_t start_index, uint8_t value)
+{
+  uint16_t i = start_index;
+
+  while (i < script->length)
+    {
+      uint8_t prev = script->sounds[i].stage;
+      script->sounds[i++].stage = value;
+      if (script->sounds[i].stage <= prev)
+        break;
+    }
+  return i;
+}
+
+/* Original intonator */
+static void reference_apply_intonation(uint8_t *transcription, uint16_t end, soundscript_t *soundscript,
+                                       const modulation_t *modulation, uint8_t clause_type)
+{
+  uint16_t i = TRANSCRIPTION_START;
+  uint16_t nspeechmarks = 0;
+  int bp;
+
+  while (i < end)
+    {
+      bp = search_breakpoint(transcription, end, i);
+      if (bp < 0)
+        break;
+      if (bp != 54)
+        nspeechmarks++;
+      while (((++i) < end) &&
+             ((transcription[i] >= 53) || (transcription[i] < 43)));
+    }
+
+  for (i = 0; i < NSTAGES; i++)
+    {
+      soundscript->icb[i].count = 1;
+      soundscript->icb[i].period = 1;
+    }
+
+  if (nspeechmarks)
+    {
+      uint16_t coef[NSTAGES];
+      uint16_t prevk = 256;
+      uint16_t j = 0;
+      uint8_t m = 0;
+      uint8_t st4 = 0;
+      uint8_t stage = 0;
+
+      for (i = 0; i < NSTAGES; i++)
+        {
+          soundscript->icb[i].stretch = 90;
+          soundscript->icb[i].delta = 0;
+        }
+
+      for (i = TRANSCRIPTION_START; j < soundscript->length; i++)
+        {
+          if (!m)
+            {
+              if (nspeechmarks == 1)
+                stage = 8;
+              else if (st4)
+                stage = 4;
+              else
+                {
+                  stage = 0;
+                  st4 = 1;
+                }
+              bp = search_breakpoint(transcription, end, i);
+              m = ((bp != 53) && (bp != 54)) ? 1 : 2;
+            }
+
+          if (m < 3)
+            {
+              if ((m < 2) && (transcription[i] > 5))
+                {
+                  j = setstage(soundscript, j, stage);
+                  continue;
+                }
+              else if ((m > 1) && ((transcription[i] > 5) || (transcription[i + 1] != 53)))
+                {
+                  if (transcription[i] != 54)
+                    j = setstage(soundscript, j, stage);
+                  continue;
+                }
+
+              m = soundscript->sounds[j].stage;
+              while (j < soundscript->length)
+                {
+                  uint8_t l = m;
+                  if (m == 4)
+                    m = 3;
+                  soundscript->sounds[j++].stage = m + stage;
+                  m = soundscript->sounds[j].stage;
+                  if (l >= m)
+                    break;
+                }
+
+              m = 3;
+              continue;
+            }
+
+          if (m > 2)
+            {
+              uint8_t l = transcription[i];
+              if (l < 53)
+                {
+                  if (l < 43)
+                    j = setstage(soundscript, j, stage + 3);
+                  else if (l != 43)
+                    break;
+                  else
+                    {
+                      j++;
+                      bp = search_breakpoint(transcription, end, i + 1);
+                      if (bp < 0)
+                        break;
+                      else if (bp != 54)
+                        {
+                          nspeechmarks--;
+                          m = 0;
+                        }
+                    }
+                }
+            }
+        }
+
+      memset(coef, 0, sizeof(coef));
+      for (i = 0; i < soundscript->length; i++)
+        {
+          uint8_t j = soundscript->sounds[i].id;
+          uint8_t k = soundscript->sounds[i].stage;
+          if (soundscript->voice->sound_lengths[j] < VOICE_THRESHOLD)
+            {
+              uint16_t l = soundscript->sounds[i].duration;
+              l /= 10;
+              coef[k] += l;
+            }
+        }
+
+      for (i = 0; i < soundscript->length; i++)
+        {
+          uint8_t j = soundscript->sounds[i].id;
+          uint8_t k = soundscript->sounds[i].stage;
+          if ((prevk != ((uint16_t)k)) && (soundscript->voice->sound_lengths[j] < VOICE_THRESHOLD))
+            {
+              int q = 0;
+              int tone1 = modulation->tones[clause_type][k][0];
+              int tone2 = modulation->tones[clause_type][k][1] - tone1;
+              soundscript->icb[k].period = 1;
+              soundscript->icb[k].count = 1;
+              if (tone2)
+                {
+                  int t;
+                  int r;
+                  int tone3 = tone2;
+                  tone2 = tone1;
+                  tone1 += tone3 >> 1;
+                  t = (coef[k] * 10 + (tone1 >> 1)) / tone1;
+                  if (!t)
+                    t++;
+                  q = tone3 / t;
+                  r = tone3 % t;
+                  if (q)
+                    {
+                      if (r < 0)
+                        {
+                          r = (-r) << 1;
+                          if (r >= t)
+                            q--;
+                        }
+                      else
+                        {
+                          r <<= 1;
+                          if (r >= t)
+                            q++;
+                        }
+                    }
+                  else
+                    {
+                      q = (r < 0) ? -1 : 1;
+                      if (r < 0)
+                        r = -r;
+                      t = (t + (r >> 1)) / r;
+                      t &= 0xFF;
+                      soundscript->icb[k].period = t;
+                      soundscript->icb[k].count = t;
+                    }
+                }
+              else tone2 = tone1;
+              soundscript->icb[k].stretch = tone2;
+              soundscript->icb[k].delta = q;
+              prevk = (uint16_t)k;
+            }
+          else if (prevk != ((uint16_t)k))
+            prevk = 256;
+        }
+    }
+  else
+    {
+      for (i = 0; i < NSTAGES; i++)
+        {
+          soundscript->icb[i].stretch = VOICE_THRESHOLD;
+          soundscript->icb[i].delta = 0;
+        }
+
+      for (i = 0; i < soundscript->length; i = setstage(soundscript, i, 0));
+    }
+}
+
+/* Random phoncode with words, pauses and marks in it */
+static uint8_t random_phoncode(void)
+{
+  unsigned int n = next_random(100);
+  if (n < 20)
+    return 43;
+  if (n < 35)
+    return 44 + next_random(11);
+  return next_random(43);
+}
+
+/* Compare intonation applied to the clause up to specified end */
+static int check(uint16_t end, uint8_t clause_type)
+{
+  size_t i;
+
+  memcpy(&expected, &source, sizeof(soundscript_t));
+  memcpy(&actual, &source, sizeof(soundscript_t));
+  reference_apply_intonation(transcription, end, &expected, &modulation, clause_type);
+  apply_intonation(transcription, end, &actual, &modulation, clause_type);
+  if (memcmp(expected.icb, actual.icb, sizeof(expected.icb)))
+    return 0;
+  for (i = 0; i < expected.length; i++)
+    if (actual.sounds[i].stage != expected.sounds[i].stage)
+      return 0;
+  return 1;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  unsigned long marked = 0;
+  unsigned long failures = 0;
+  unsigned long n;
+
+  for (n = 0; n < CLAUSES; n++)
+    {
+      const voice_t *voice = next_random(2) ? &female : &male;
+      uint8_t clause_type = next_random(CLAUSE_TYPES);
+      uint16_t length = 1 + next_random(next_random(4) ? 40 : MAX_CLAUSE);
+      uint16_t end = TRANSCRIPTION_START + length;
+      size_t i;
+
+      if (!(n % 1000))
+        modulation_setup(&modulation, 50 + next_random(250), next_random(150),
+                         voice->pitch_factor);
+
+      /* Clause transcription is followed by pauses up to the buffer end */
+      memset(transcription, 43, sizeof(transcription));
+      for (i = TRANSCRIPTION_START; i < end; i++)
+        transcription[i] = random_phoncode();
+      if (next_random(2))
+        transcription[end - 1] = 44 + next_random(6);
+      end += next_random(3);
+
+      memset(&source, 0, sizeof(soundscript_t));
+      source.voice = voice;
+      build_utterance(transcription, end, &source);
+      for (i = 0; i < source.length; i++)
+        source.sounds[i].duration = 1 + next_random(3000);
+
+      if (!check(end, clause_type))
+        {
+          if (failures++ < 10)
+            fprintf(stderr, "Mismatch for clause %lu of %u phoncodes\n",
+                    n, (unsigned int) length);
+        }
+      else if (expected.icb[0].stretch != VOICE_THRESHOLD)
+        marked++;
+    }
+
+  printf("%lu clauses checked, %lu with speech marks, %lu mismatches\n",
+         (unsigned long) CLAUSES, marked, failures);
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
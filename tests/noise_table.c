@@ -0,0 +1,66 @@
+/* noise_table.c -- Check the precomputed noise waveforms
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * The noise bank compiled into the library must be exactly
+ * what the noise generator produces. Otherwise noise.c
+ * should be regenerated by "make noise-table".
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "soundscript.h"
+
+
+/* Local data */
+
+static noise_bank_t bank;
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  size_t i, k;
+  int rc = EXIT_SUCCESS;
+
+  noise_bank_setup(&bank);
+
+  if (memcmp(bank.slot, noise_bank.slot, sizeof(bank.slot)))
+    {
+      fprintf(stderr, "Noise slots differ\n");
+      rc = EXIT_FAILURE;
+    }
+
+  for (i = 0; i < NOISE_SOUNDS; i++)
+    {
+      for (k = 0; k < NOISE_TABLE_LENGTH; k++)
+        if (bank.samples[i][k] != noise_bank.samples[i][k])
+          {
+            fprintf(stderr, "Noise %u differs at sample %u\n",
+                    (unsigned int) i, (unsigned int) k);
+            rc = EXIT_FAILURE;
+            break;
+          }
+      if ((bank.registers[i].ax != noise_bank.registers[i].ax) ||
+          (bank.registers[i].var1 != noise_bank.registers[i].var1) ||
+          (bank.registers[i].var2 != noise_bank.registers[i].var2) ||
+          (bank.registers[i].var3 != noise_bank.registers[i].var3))
+        {
+          fprintf(stderr, "Noise %u registers differ\n", (unsigned int) i);
+          rc = EXIT_FAILURE;
+        }
+    }
+
+  return rc;
+}
@@ -0,0 +1,114 @@
+/* phoncode_properties.c -- Check the phoncode property table
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * The time planner classifies phoncodes by the property table
+ * instead of searching the phoncode sets. Properties of every
+ * phoncode are derived here from these sets the same way
+ * the planner used to search them and compared with the table.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "soundscript.h"
+
+
+/* Local data */
+
+/* Original phoncode sets (the order is significant) */
+static const uint8_t set0[] = { 44, 45, 48, 49, 46, 47, 50, 51 };
+static const uint8_t set1[] = { 10, 15, 18, 16, 19, 8, 13, 14, 17 };
+static const uint8_t set2[] = { 6, 11, 7, 12, 9 };
+static const uint8_t set3[] = { 20, 23, 21, 24, 22, 25 };
+static const uint8_t set4[] = { 34, 37, 35, 38, 32, 36, 39, 33, 40, 41 };
+static const uint8_t set5[] = { 26, 29, 27, 30, 28, 31 };
+static const uint8_t set6[] = { 10, 14, 17, 15, 18, 16, 19, 8, 13 };
+static const uint8_t set7[] = { 6, 11, 7, 12, 9, 20, 23, 21, 24, 22, 25 };
+static const uint8_t set8[] = { 20, 23, 26, 29, 15, 18, 6, 11, 34, 37 };
+static const uint8_t set9[] = { 21, 24, 27, 30, 14, 17, 16, 19, 7, 12, 35, 38, 36, 39, 32, 33, 9 };
+static const uint8_t set10[] = { 22, 25, 28, 31, 40, 41 };
+
+
+/* Local subroutines */
+
+/* Original rank definition */
+static uint8_t rank(uint8_t phoncode)
+{
+  uint8_t rc = 0;
+  if (memchr(set1, phoncode, sizeof(set1)))
+    rc = 1;
+  else if (memchr(set2, phoncode, sizeof(set2)))
+    rc = 2;
+  else if (memchr(set3, phoncode, sizeof(set3)))
+    rc = 3;
+  else if (memchr(set4, phoncode, sizeof(set4)))
+    rc = 4;
+  else if (memchr(set5, phoncode, sizeof(set5)))
+    rc = 5;
+  return rc;
+}
+
+/* Derive properties of the phoncode from the sets */
+static uint16_t derive(uint8_t phoncode)
+{
+  const uint8_t *found = memchr(set0, phoncode, sizeof(set0));
+  uint16_t properties = rank(phoncode);
+
+  if (memchr(set6, phoncode, sizeof(set6)))
+    properties |= SET6;
+  if (memchr(set7, phoncode, sizeof(set7)))
+    properties |= SET7;
+  if (memchr(set8, phoncode, 4))
+    properties |= SET8_HEAD;
+  if (memchr(set8, phoncode, sizeof(set8)))
+    properties |= SET8;
+  if (memchr(set9, phoncode, 4))
+    properties |= SET9_HEAD;
+  if (memchr(set9, phoncode, sizeof(set9)))
+    properties |= SET9;
+  if (memchr(set10, phoncode, 4))
+    properties |= SET10_HEAD;
+  if (memchr(set10, phoncode, sizeof(set10)))
+    properties |= SET10;
+  if (found)
+    {
+      uint16_t k = found - set0;
+      if (k > 3)
+        k = 0;
+      properties |= BOUNDARY | (k << 12);
+    }
+
+  return properties;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  unsigned int failures = 0;
+  unsigned int c;
+
+  for (c = 0; c < 256; c++)
+    {
+      uint16_t expected = derive(c);
+      if (phoncode_properties[c] != expected)
+        {
+          fprintf(stderr, "Phoncode %u: 0x%04X instead of 0x%04X\n", c,
+                  (unsigned int) phoncode_properties[c], (unsigned int) expected);
+          failures++;
+        }
+    }
+
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
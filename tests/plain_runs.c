@@ -0,0 +1,154 @@
+/* plain_runs.c -- Check normalization of plain letter runs
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Runs of plain letters may be normalized at once by the kernel
+ * chosen for the processor. Random texts made mostly of letters
+ * and spaces, but with any other bytes among them, are normalized
+ * with this kernel and without it in both encodings,
+ * and the results must be the same.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ru_tts.h"
+#include "transcription.h"
+
+
+/* Local macros */
+
+#define TEXTS 2000
+#define MAX_TEXT_LENGTH 3000
+
+
+/* Local data */
+
+static uint32_t seed = 1;
+
+
+/* Local subroutines */
+
+/* Pseudo-random number generator */
+static unsigned int random_number(unsigned int range)
+{
+  seed = seed * 1103515245UL + 12345UL;
+  return (seed >> 8) % range;
+}
+
+/*
+ * Make random text of specified length. Bytes from 0xC0
+ * are koi8-r letters, so in UTF-8 they are mostly replaced
+ * by Latin ones to make long runs.
+ */
+static void make_text(char *text, size_t length, int utf8)
+{
+  static const char plain[] = "abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ";
+  size_t i;
+
+  for (i = 0; i < length; i++)
+    switch (random_number(16))
+      {
+      case 0:
+      case 1:
+      case 2:
+        text[i] = ' ';
+        break;
+      case 3:
+        text[i] = (char) random_number(256);
+        break;
+      case 4:
+        text[i] = ",.;:?!-+=\t\n0123"[random_number(16)];
+        break;
+      case 5:
+      case 6:
+      case 7:
+      case 8:
+        text[i] = plain[random_number(sizeof(plain) - 1)];
+        break;
+      default:
+        if (utf8 && random_number(8))
+          text[i] = plain[random_number(sizeof(plain) - 1)];
+        else text[i] = (char)(0xC0 + random_number(64));
+        break;
+      }
+}
+
+/* Normalize the whole text collecting the result */
+static size_t normalize(input_t *input, const char *text, size_t length, char *result)
+{
+  size_t size = 0;
+
+  input->start = input->text;
+  input->end = input->text;
+  input->word_start = input->text;
+  input->word_end = input->text;
+  input->source = text;
+  input->source_end = text + length;
+  while (input_fetch(input))
+    {
+      memcpy(result + size, input->start, input->end - input->start);
+      size += input->end - input->start;
+      input->start = input->end;
+    }
+  return size;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  input_t *input = malloc(sizeof(input_t));
+  char *text = malloc(MAX_TEXT_LENGTH);
+  char *expected = malloc(2 * MAX_TEXT_LENGTH);
+  char *result = malloc(2 * MAX_TEXT_LENGTH);
+  unsigned int failures = 0;
+  unsigned int i;
+
+  if (!input || !text || !expected || !result)
+    return EXIT_FAILURE;
+  memset(input, 0, sizeof(input_t));
+  input_reset(input, 0);
+  if (!input->plain_run)
+    {
+      printf("No plain run normalizer for this processor\n");
+      return 77;
+    }
+
+  for (i = 0; i < TEXTS; i++)
+    {
+      size_t length = 1 + random_number(MAX_TEXT_LENGTH);
+      int flags = (i & 1) ? INPUT_UTF8 : 0;
+      size_t expected_size, size;
+
+      make_text(text, length, flags & INPUT_UTF8);
+      input_reset(input, flags);
+      input->plain_run = NULL;
+      expected_size = normalize(input, text, length, expected);
+      input_reset(input, flags);
+      size = normalize(input, text, length, result);
+      if ((size != expected_size) || memcmp(result, expected, size))
+        {
+          fprintf(stderr, "Text %u of %lu bytes%s: %lu characters instead of %lu\n",
+                  i, (unsigned long) length, (flags & INPUT_UTF8) ? " in UTF-8" : "",
+                  (unsigned long) size, (unsigned long) expected_size);
+          failures++;
+        }
+    }
+
+  free(input);
+  free(text);
+  free(expected);
+  free(result);
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,130 @@
+/* pull_split.c -- Check pulled speech against the transferred one
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Speech pulled in portions of any size must be exactly the same
+ * as the speech of one transfer. Texts longer than a piece
+ * transcribed at once are checked, including a clause
+ * without any punctuation, which has to be continued
+ * from one piece to another.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ru_tts.h"
+
+
+/* Local macros */
+
+/* Repeated phrases make texts longer than 4 KB */
+#define PHRASE_REPEAT 100
+
+
+/* Local data */
+
+static const struct
+{
+  const char *phrase;
+  int flags;
+} texts[] =
+  {
+    { "съешь же ещё этих мягких французских булок да выпей чаю ", INPUT_UTF8 },
+    { "\xd3\xdf\xc5\xdb\xd8 \xd6\xc5 \xc5\xdd\xa3 \xdc\xd4\xc9\xc8 \xcd\xd1\xc7\xcb\xc9\xc8 "
+      "\xc6\xd2\xc1\xce\xc3\xd5\xda\xd3\xcb\xc9\xc8 \xc2\xd5\xcc\xcf\xcb \xc4\xc1 "
+      "\xd7\xd9\xd0\xc5\xca \xde\xc1\xc0 ", 0 },
+    { "Съешь же ещё этих мягких французских булок, да выпей чаю. ", INPUT_UTF8 }
+  };
+
+/* Pulled portion sizes in samples */
+static const size_t portions[] = { 1, 997, 65536 };
+
+
+/* Local subroutines */
+
+typedef struct
+{
+  char *data;
+  size_t size;
+} sound_t;
+
+/* Sound collector */
+static int collect(void *buffer, size_t size, void *user_data)
+{
+  sound_t *sound = user_data;
+  char *data = realloc(sound->data, sound->size + size);
+
+  if (!data)
+    return 1;
+  memcpy(data + sound->size, buffer, size);
+  sound->data = data;
+  sound->size += size;
+  return 0;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  ru_tts_engine_t *engine = ru_tts_engine_new();
+  ru_tts_conf_t config;
+  char wave[65536];
+  char *text;
+  unsigned int i, j;
+  int rc = EXIT_SUCCESS;
+
+  text = malloc(PHRASE_REPEAT * 128);
+  if (!engine || !text)
+    return EXIT_FAILURE;
+
+  for (i = 0; i < sizeof(texts) / sizeof(texts[0]); i++)
+    {
+      size_t length = strlen(texts[i].phrase);
+      sound_t whole = { NULL, 0 };
+
+      for (j = 0; j < PHRASE_REPEAT; j++)
+        memcpy(text + j * length, texts[i].phrase, length);
+      length *= PHRASE_REPEAT;
+
+      ru_tts_config_init(&config);
+      config.flags |= texts[i].flags;
+      ru_tts_engine_transfer_n(engine, &config, text, length, wave, sizeof(wave), collect, &whole);
+
+      for (j = 0; j < sizeof(portions) / sizeof(portions[0]); j++)
+        {
+          sound_t pulled = { NULL, 0 };
+          size_t n;
+
+          ru_tts_read_begin(engine, &config, text, length);
+          do
+            {
+              n = ru_tts_read(engine, wave, portions[j]);
+              collect(wave, n, &pulled);
+            }
+          while (n == portions[j]);
+          if ((pulled.size != whole.size) ||
+              memcmp(pulled.data, whole.data, whole.size))
+            {
+              fprintf(stderr, "Text %u in portions of %lu: %lu samples instead of %lu\n",
+                      i, (unsigned long) portions[j], (unsigned long) pulled.size,
+                      (unsigned long) whole.size);
+              rc = EXIT_FAILURE;
+            }
+          free(pulled.data);
+        }
+      free(whole.data);
+    }
+
+  ru_tts_engine_free(engine);
+  free(text);
+  return rc;
+}
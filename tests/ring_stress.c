@@ -0,0 +1,330 @@
+/* ring_stress.c -- Ring buffer stress test
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Producer and consumer threads pass data through a small ring
+ * in chunks of random sizes. The consumer checks that everything
+ * arrives intact and in order. At last the consumer imitates
+ * accelerated real-time playback, where short reads before
+ * the end are underruns, and there must be none of them.
+ */
+
+#include <pthread.h>
+#include <sched.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "ru_tts.h"
+
+
+/* Local macros */
+
+#define RING_SIZE 4096
+#define PATTERN_LENGTH (16 * 1024 * 1024)
+#define MAX_CHUNK 3000
+#define SPEECH_REPEAT 20
+
+/*
+ * Playback imitation: 50 ms of 16-bit sound at the native rate
+ * is taken 16 times faster than in real time after prebuffering.
+ */
+#define PLAYBACK_RING_SIZE 65536
+#define PLAYBACK_PERIOD 1000
+#define PLAYBACK_INTERVAL 3125000L
+#define PLAYBACK_PREBUFFER 100000000L
+
+
+/* Local data types */
+
+/* Test case description */
+typedef struct
+{
+  ru_tts_ring_t *ring;
+  const uint8_t *expected; /* NULL for the generated pattern */
+  size_t length;
+  size_t text_length;
+  unsigned long underruns;
+  int mode;
+  int playback;
+} job_t;
+
+/* Producer modes */
+enum
+  {
+    PRODUCE_PATTERN,
+    PRODUCE_TRANSFER,
+    PRODUCE_FILL
+  };
+
+
+/* Local data */
+
+static const char text[] =
+  "Съешь же ещё этих мягких французских булок, да выпей чаю. "
+  "В 1991 году: 3,5 килограмма — это много? Нет! А 12.75 рубля... "
+  "Он сказал: «Привет». Она ответила; потом ушла.";
+
+static ru_tts_conf_t config;
+static char *speech_text = NULL;
+static size_t speech_text_length = 0;
+
+
+/* Local subroutines */
+
+/* Byte of the generated pattern at specified position */
+static uint8_t pattern(size_t i)
+{
+  return (uint8_t)((i * 7) ^ (i >> 9));
+}
+
+/* Sleep for specified number of nanoseconds */
+static void pause_for(long nanoseconds)
+{
+  struct timespec interval = { 0, nanoseconds };
+  nanosleep(&interval, NULL);
+}
+
+/* Simple reentrant random numbers */
+static size_t next_random(unsigned long *seed, size_t limit)
+{
+  *seed = *seed * 1103515245UL + 12345UL;
+  return 1 + (size_t)((*seed >> 16) % limit);
+}
+
+/* Reference sound collector */
+static int collect(void *buffer, size_t size, void *user_data)
+{
+  job_t *job = user_data;
+  uint8_t *expected = realloc((uint8_t *) job->expected, job->length + size);
+  if (!expected)
+    return 1;
+  memcpy(expected + job->length, buffer, size);
+  job->expected = expected;
+  job->length += size;
+  return 0;
+}
+
+/* Producer thread */
+static void *produce(void *arg)
+{
+  job_t *job = arg;
+  unsigned long seed = 1;
+
+  switch (job->mode)
+    {
+    case PRODUCE_PATTERN:
+      {
+        uint8_t chunk[MAX_CHUNK];
+        size_t done = 0;
+        while (done < job->length)
+          {
+            size_t n = next_random(&seed, MAX_CHUNK);
+            size_t i;
+            if (n > (job->length - done))
+              n = job->length - done;
+            if (n & 1)
+              {
+                for (i = 0; i < n; i++)
+                  chunk[i] = pattern(done + i);
+                if (ru_tts_ring_write(chunk, n, job->ring))
+                  break;
+              }
+            else
+              {
+                size_t size;
+                uint8_t *buffer = ru_tts_ring_get_buffer(job->ring, &size);
+                if (!buffer)
+                  break;
+                if (n > size)
+                  n = size;
+                for (i = 0; i < n; i++)
+                  buffer[i] = pattern(done + i);
+                if (ru_tts_ring_commit(job->ring, n))
+                  break;
+              }
+            done += n;
+          }
+        ru_tts_ring_finish(job->ring);
+      }
+      break;
+    case PRODUCE_TRANSFER:
+      {
+        ru_tts_engine_t *engine = ru_tts_engine_new();
+        char wave[1000];
+        if (engine)
+          ru_tts_engine_transfer_n(engine, &config, speech_text, job->text_length,
+                                   wave, sizeof(wave), ru_tts_ring_write, job->ring);
+        ru_tts_ring_finish(job->ring);
+        ru_tts_engine_free(engine);
+      }
+      break;
+    case PRODUCE_FILL:
+      {
+        ru_tts_engine_t *engine = ru_tts_engine_new();
+        if (engine)
+          {
+            ru_tts_read_begin(engine, &config, speech_text, job->text_length);
+            while (ru_tts_ring_fill(job->ring, engine))
+              if (job->playback)
+                pause_for(1000000L);
+              else sched_yield();
+          }
+        else ru_tts_ring_finish(job->ring);
+        ru_tts_engine_free(engine);
+      }
+      break;
+    default:
+      break;
+    }
+
+  return NULL;
+}
+
+/* Consume data from the ring checking it */
+static int consume(job_t *job)
+{
+  uint8_t chunk[MAX_CHUNK];
+  unsigned long seed = 2;
+  size_t done = 0;
+
+  if (job->playback)
+    pause_for(PLAYBACK_PREBUFFER);
+
+  while (!ru_tts_ring_finished(job->ring))
+    {
+      size_t requested = job->playback ? PLAYBACK_PERIOD : next_random(&seed, MAX_CHUNK);
+      size_t n = ru_tts_ring_read(job->ring, chunk, requested);
+      size_t i;
+
+      if (job->playback)
+        {
+          if ((n < requested) && !ru_tts_ring_finished(job->ring))
+            job->underruns++;
+          pause_for(PLAYBACK_INTERVAL);
+        }
+      else if (n < requested)
+        sched_yield();
+      if ((done + n) > job->length)
+        {
+          fprintf(stderr, "Too much data: %lu bytes\n", (unsigned long) (done + n));
+          return 0;
+        }
+      for (i = 0; i < n; i++, done++)
+        if (chunk[i] != (job->expected ? job->expected[done] : pattern(done)))
+          {
+            fprintf(stderr, "Data mismatch at %lu\n", (unsigned long) done);
+            return 0;
+          }
+    }
+
+  if (done != job->length)
+    {
+      fprintf(stderr, "Data lost: %lu bytes of %lu\n",
+              (unsigned long) done, (unsigned long) job->length);
+      return 0;
+    }
+  return 1;
+}
+
+/* Run specified test case */
+static int run(const char *title, int mode, int policy, int playback)
+{
+  pthread_t producer;
+  job_t job;
+  int ok;
+
+  job.expected = NULL;
+  job.length = 0;
+  job.text_length = playback ? sizeof(text) : speech_text_length;
+  job.underruns = 0;
+  job.mode = mode;
+  job.playback = playback;
+
+  /* Reference data */
+  if (mode == PRODUCE_PATTERN)
+    job.length = PATTERN_LENGTH;
+  else if (mode == PRODUCE_TRANSFER)
+    {
+      char wave[1000];
+      ru_tts_transfer_n(&config, speech_text, job.text_length, wave, sizeof(wave), collect, &job);
+    }
+  else
+    {
+      ru_tts_engine_t *engine = ru_tts_engine_new();
+      uint8_t buffer[1000];
+      size_t n;
+      if (engine)
+        {
+          ru_tts_read_begin(engine, &config, speech_text, job.text_length);
+          while ((n = ru_tts_read(engine, buffer, sizeof(buffer) / 2)))
+            collect(buffer, 2 * n, &job);
+          ru_tts_engine_free(engine);
+        }
+    }
+  if (!job.length)
+    {
+      fprintf(stderr, "%s: no reference data\n", title);
+      return 0;
+    }
+
+  job.ring = ru_tts_ring_new(playback ? PLAYBACK_RING_SIZE : RING_SIZE, policy);
+  if (!job.ring || pthread_create(&producer, NULL, produce, &job))
+    {
+      fprintf(stderr, "%s: cannot start\n", title);
+      free((uint8_t *) job.expected);
+      return 0;
+    }
+  ok = consume(&job);
+  if (!ok)
+    ru_tts_ring_close(job.ring);
+  pthread_join(producer, NULL);
+  ru_tts_ring_free(job.ring);
+  free((uint8_t *) job.expected);
+  printf("%s: %lu bytes %s", title, (unsigned long) job.length, ok ? "intact" : "broken");
+  if (playback)
+    printf(", %lu underruns", job.underruns);
+  printf("\n");
+  return ok && !job.underruns;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  int ok = 1;
+  int i;
+
+  ru_tts_config_init(&config);
+  config.flags |= INPUT_UTF8;
+  config.sample_format = SAMPLE_FORMAT_S16_LE;
+  speech_text = malloc(SPEECH_REPEAT * sizeof(text));
+  if (!speech_text)
+    return EXIT_FAILURE;
+  for (i = 0; i < SPEECH_REPEAT; i++)
+    {
+      memcpy(speech_text + speech_text_length, text, sizeof(text) - 1);
+      speech_text_length += sizeof(text) - 1;
+      speech_text[speech_text_length++] = ' ';
+    }
+
+  ok &= run("Pattern", PRODUCE_PATTERN, RING_BLOCK, 0);
+  ok &= run("Transfer", PRODUCE_TRANSFER, RING_BLOCK, 0);
+  ok &= run("Blocking fill", PRODUCE_FILL, RING_BLOCK, 0);
+  ok &= run("Non-blocking fill", PRODUCE_FILL, RING_NONBLOCK, 0);
+  ok &= run("Transfer playback", PRODUCE_TRANSFER, RING_BLOCK, 1);
+  ok &= run("Non-blocking fill playback", PRODUCE_FILL, RING_NONBLOCK, 1);
+
+  free(speech_text);
+  return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,117 @@
+/* sample_rates.c -- Check output sample rate support
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Supported rates must produce the amount of sound proportional
+ * to the rate, while unsupported ones must be rejected rather than
+ * silently replaced by the native rate.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ru_tts.h"
+
+
+/* Local data */
+
+static const int supported[] =
+  {
+    10000, 8000, 11025, 16000, 22050, 32000, 44100, 48000, 96000
+  };
+
+static const int unsupported[] =
+  {
+    0, 7999, 8001, 22051, 44101, 96001, -10000
+  };
+
+static const char text[] = "Проверка частоты дискретизации.";
+
+
+/* Local subroutines */
+
+/* Sound length counter */
+static int count(void *buffer, size_t size, void *user_data)
+{
+  (*(size_t *) user_data) += size;
+  return 0;
+}
+
+/* Get speech length in samples for specified rate */
+static size_t speak(ru_tts_engine_t *engine, int rate)
+{
+  ru_tts_conf_t config;
+  char wave[4096];
+  size_t length = 0;
+
+  ru_tts_config_init(&config);
+  config.flags |= INPUT_UTF8;
+  config.sample_rate = rate;
+  ru_tts_engine_transfer(engine, &config, text, wave, sizeof(wave), count, &length);
+  return length;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  ru_tts_engine_t *engine = ru_tts_engine_new();
+  ru_tts_conf_t config;
+  size_t native;
+  unsigned int i;
+  int rc = EXIT_SUCCESS;
+
+  if (!engine)
+    return EXIT_FAILURE;
+  ru_tts_config_init(&config);
+  native = speak(engine, 10000);
+
+  for (i = 0; i < sizeof(supported) / sizeof(supported[0]); i++)
+    {
+      ru_tts_compiled_conf_t *compiled;
+      size_t length = speak(engine, supported[i]);
+      double ratio = ((double) length) * 10000.0 / (((double) native) * supported[i]);
+      config.sample_rate = supported[i];
+      compiled = ru_tts_config_compile(&config);
+      if (!compiled || (ratio < 0.99) || (ratio > 1.01))
+        {
+          fprintf(stderr, "Rate %d: %lu samples, %s\n", supported[i],
+                  (unsigned long) length, compiled ? "compiled" : "rejected");
+          rc = EXIT_FAILURE;
+        }
+      ru_tts_compiled_conf_free(compiled);
+    }
+
+  for (i = 0; i < sizeof(unsupported) / sizeof(unsupported[0]); i++)
+    {
+      ru_tts_compiled_conf_t *compiled;
+      size_t length = speak(engine, unsupported[i]);
+      config.sample_rate = unsupported[i];
+      compiled = ru_tts_config_compile(&config);
+      if (compiled || length)
+        {
+          fprintf(stderr, "Rate %d: %lu samples, %s\n", unsupported[i],
+                  (unsigned long) length, compiled ? "compiled" : "rejected");
+          rc = EXIT_FAILURE;
+        }
+      ru_tts_compiled_conf_free(compiled);
+    }
+
+  /* Supported rate must work again after rejected one */
+  if (speak(engine, 10000) != native)
+    {
+      fprintf(stderr, "Engine is broken by unsupported rate\n");
+      rc = EXIT_FAILURE;
+    }
+
+  ru_tts_engine_free(engine);
+  return rc;
+}
@@ -0,0 +1,177 @@
+/* stream_split.c -- Check streamed text against the whole one
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Text pushed to the stream in chunks of any size must sound
+ * exactly as the same text passed by one transfer, so clauses
+ * may be split only where the normalized text allows it.
+ * A clause without any punctuation longer than the stream buffer
+ * has to be continued from one buffer filling to another.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ru_tts.h"
+
+
+/* Local macros */
+
+/* Repeated phrases make clauses longer than 4 KB */
+#define PHRASE_REPEAT 100
+
+
+/* Local data */
+
+static const struct
+{
+  const char *text;
+  int flags;
+} texts[] =
+  {
+    { "а: @! б", INPUT_UTF8 },
+    { "а. — б", INPUT_UTF8 },
+    { "а: «б»! в", INPUT_UTF8 },
+    { "а… б. в…! г", INPUT_UTF8 },
+    { "\xcc(; Р", INPUT_UTF8 },
+    { "Москва́. ́Столица, — сказал он.", INPUT_UTF8 },
+    { "\xc1: @! \xc2", 0 },
+    { "\xcd. /:", 0 },
+    { "\xfb; ':", 0 },
+    { "\xc4: #, \xc1", 0 }
+  };
+
+static const struct
+{
+  const char *phrase;
+  int flags;
+} phrases[] =
+  {
+    { "съешь же ещё этих мягких французских булок да выпей чаю ", INPUT_UTF8 },
+    { "\xd3\xdf\xc5\xdb\xd8 \xd6\xc5 \xc5\xdd\xa3 \xdc\xd4\xc9\xc8 \xcd\xd1\xc7\xcb\xc9\xc8 "
+      "\xc6\xd2\xc1\xce\xc3\xd5\xda\xd3\xcb\xc9\xc8 \xc2\xd5\xcc\xcf\xcb \xc4\xc1 "
+      "\xd7\xd9\xd0\xc5\xca \xde\xc1\xc0 ", 0 }
+  };
+
+/* Chunk sizes long clauses are pushed in */
+static const size_t chunks[] = { 1, 7, 1000, 4095, 4096, 5000 };
+
+
+/* Local subroutines */
+
+typedef struct
+{
+  char *data;
+  size_t size;
+} sound_t;
+
+/* Sound collector */
+static int collect(void *buffer, size_t size, void *user_data)
+{
+  sound_t *sound = user_data;
+  char *data = realloc(sound->data, sound->size + size);
+
+  if (!data)
+    return 1;
+  memcpy(data + sound->size, buffer, size);
+  sound->data = data;
+  sound->size += size;
+  return 0;
+}
+
+/*
+ * Push the text to the stream in chunks of specified size
+ * and compare the sound with the whole text one.
+ * Returns non-zero value when they are the same.
+ */
+static int stream_matches(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                          const char *text, size_t length, size_t chunk,
+                          const sound_t *whole)
+{
+  char wave[4096];
+  sound_t streamed = { NULL, 0 };
+  size_t offset;
+  int rc;
+
+  ru_tts_stream_begin(engine, config, wave, sizeof(wave), collect, &streamed);
+  for (offset = 0; offset < length; offset += chunk)
+    ru_tts_stream_push(engine, text + offset,
+                       ((length - offset) < chunk) ? (length - offset) : chunk);
+  ru_tts_stream_finish(engine);
+  rc = (streamed.size == whole->size) && !memcmp(streamed.data, whole->data, whole->size);
+  if (!rc)
+    fprintf(stderr, "%lu samples instead of %lu in ",
+            (unsigned long) streamed.size, (unsigned long) whole->size);
+  free(streamed.data);
+  return rc;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  ru_tts_engine_t *engine = ru_tts_engine_new();
+  ru_tts_conf_t config;
+  char wave[4096];
+  char *text;
+  unsigned int i, j;
+  int rc = EXIT_SUCCESS;
+
+  text = malloc(PHRASE_REPEAT * 128);
+  if (!engine || !text)
+    return EXIT_FAILURE;
+
+  for (i = 0; i < sizeof(texts) / sizeof(texts[0]); i++)
+    {
+      size_t length = strlen(texts[i].text);
+      size_t chunk;
+      sound_t whole = { NULL, 0 };
+
+      ru_tts_config_init(&config);
+      config.flags |= texts[i].flags;
+      ru_tts_engine_transfer(engine, &config, texts[i].text, wave, sizeof(wave), collect, &whole);
+
+      for (chunk = 1; chunk <= length; chunk++)
+        if (!stream_matches(engine, &config, texts[i].text, length, chunk, &whole))
+          {
+            fprintf(stderr, "text %u in chunks of %lu\n", i, (unsigned long) chunk);
+            rc = EXIT_FAILURE;
+          }
+      free(whole.data);
+    }
+
+  for (i = 0; i < sizeof(phrases) / sizeof(phrases[0]); i++)
+    {
+      size_t length = strlen(phrases[i].phrase);
+      sound_t whole = { NULL, 0 };
+
+      for (j = 0; j < PHRASE_REPEAT; j++)
+        memcpy(text + j * length, phrases[i].phrase, length);
+      length *= PHRASE_REPEAT;
+
+      ru_tts_config_init(&config);
+      config.flags |= phrases[i].flags;
+      ru_tts_engine_transfer_n(engine, &config, text, length, wave, sizeof(wave), collect, &whole);
+
+      for (j = 0; j < sizeof(chunks) / sizeof(chunks[0]); j++)
+        if (!stream_matches(engine, &config, text, length, chunks[j], &whole))
+          {
+            fprintf(stderr, "long clause %u in chunks of %lu\n", i, (unsigned long) chunks[j]);
+            rc = EXIT_FAILURE;
+          }
+      free(whole.data);
+    }
+
+  ru_tts_engine_free(engine);
+  free(text);
+  return rc;
+}
@@ -0,0 +1,140 @@
+/* suffix_index.c -- Check the accented word suffix index
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Suffixes of accented words are looked up once per word
+ * instead of trying every rule at every letter. The indexed lookup
+ * is compared here with the linear scan of the rules at each letter
+ * of words made of all the suffixes, their weakly stressed variants,
+ * their near misses and various stems and followers. The index
+ * is checked both as it goes through a word and when built anew
+ * at each position.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "transcription.h"
+
+
+/* Local data */
+
+/* Suffix rules in the order of precedence (normalized text) */
+static const char *suffixes[] =
+  { NULL, "O+GO", "E+GO", "EGO+", "OGO+", "TXSQ", "EGO", "OGO", "TSQ" };
+
+static const char *stems[] = { "", "K", "A", "KA", "MOLOD", "+", "N=" };
+static const char *followers[] = { "", " ", ",", "A", "+" };
+
+
+/* Local subroutines */
+
+/* Find the rule matching the whole rest of the word by the linear scan */
+static uint8_t scan(const char *s)
+{
+  uint8_t rule;
+  size_t n, i;
+
+  for (n = 0; char_classes[(unsigned char)s[n]] & LETTER; n++);
+  for (rule = 1; rule < (sizeof(suffixes) / sizeof(suffixes[0])); rule++)
+    if (strlen(suffixes[rule]) == n)
+      {
+        for (i = 0; (i < n) && ((s[i] == suffixes[rule][i]) || ((suffixes[rule][i] == '+') && (s[i] == '='))); i++);
+        if (i == n)
+          return rule;
+      }
+  return 0;
+}
+
+/* Check the index at every letter of the text */
+static unsigned int check(input_t *input, const char *text)
+{
+  unsigned int failures = 0;
+  size_t length = strlen(text);
+  size_t i;
+  int fresh;
+
+  memcpy(input->text, text, length + 1);
+  input->end = input->text + length;
+  for (fresh = 0; fresh < 2; fresh++)
+    {
+      input->word_start = input->word_end = input->text;
+      for (i = 0; i < length; i++)
+        if (char_classes[(unsigned char)text[i]] & LETTER)
+          {
+            uint8_t expected = scan(text + i);
+            uint8_t rule;
+
+            if (fresh)
+              input->word_start = input->word_end = input->text;
+            input->start = input->text + i;
+            rule = word_suffix(input);
+            if (rule != expected)
+              {
+                fprintf(stderr, "\"%s\" at %lu%s: rule %u instead of %u\n", text,
+                        (unsigned long) i, fresh ? " anew" : "", rule, expected);
+                failures++;
+              }
+          }
+    }
+  return failures;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  unsigned int failures = 0;
+  input_t *input = malloc(sizeof(input_t));
+  char body[8], text[32];
+  unsigned int i, j, k, m;
+
+  if (!input)
+    return EXIT_FAILURE;
+  memset(input, 0, sizeof(input_t));
+  input_reset(input, 0);
+
+  for (i = 1; i < (sizeof(suffixes) / sizeof(suffixes[0])); i++)
+    {
+      size_t n = strlen(suffixes[i]);
+
+      /* Variants: the suffix itself, weakly stressed, each letter missed, cut and extended */
+      for (m = 0; m < n + 4; m++)
+        {
+          strcpy(body, suffixes[i]);
+          if (m == 1)
+            {
+              char *s = strchr(body, '+');
+              if (!s)
+                continue;
+              *s = '=';
+            }
+          else if ((m >= 2) && (m < n + 2))
+            body[m - 2] = 'B';
+          else if (m == n + 2)
+            body[n - 1] = 0;
+          else if (m == n + 3)
+            strcat(body, "A");
+
+          for (j = 0; j < (sizeof(stems) / sizeof(stems[0])); j++)
+            for (k = 0; k < (sizeof(followers) / sizeof(followers[0])); k++)
+              {
+                sprintf(text, "%s%s%s", stems[j], body, followers[k]);
+                failures += check(input, text);
+              }
+        }
+    }
+
+  free(input);
+  return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
@@ -0,0 +1,164 @@
+/* transcription_corpus.c -- Check transcription of a generated corpus
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * The character class table must not change the transcription
+ * the character lists produced. Every combination of three
+ * characters from a chosen set is transcribed, as well as words
+ * with all the stressed and unstressed suffixes. The phonetic
+ * codes of all clauses are compared with the reference checksum
+ * taken from the transcription that searched the lists. The lists
+ * version was fixed not to soften a dental consonant at the clause
+ * start, where it used to read past the end of the softened codes.
+ */
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "transcription.h"
+#include "synth.h"
+
+
+/* Local data */
+
+/* Characters combined in the corpus (KOI8-R) */
+static const char charset[] =
+  "\xc0\xc1\xc2\xc3\xc4\xc5\xc6\xc7\xc8\xc9\xca\xcb\xcc\xcd\xce\xcf"
+  "\xd0\xd1\xd2\xd3\xd4\xd5\xd6\xd7\xd8\xd9\xda\xdb\xdc\xdd\xde\xdf"
+  "\xa3+=-,.?10";
+
+/* Word stems and suffixes combined in the corpus (KOI8-R) */
+static const char *stems[] =
+  {
+    "\xcb\xd2\xc1\xd3\xce", /* красн */
+    "\xd3\xc9\xce", /* син */
+    "\xd4\xd2\xc5+\xd4", /* тре+т */
+    "\xcd", /* м */
+    "\xd5\xde\xc9", /* учи */
+    "\xc4\xd2\xd5\xc7+" /* дру+г */
+  };
+static const char *suffixes[] =
+  {
+    "\xcf\xc7\xcf", /* ого */
+    "\xc5\xc7\xcf", /* его */
+    "\xcf+\xc7\xcf", /* о+го */
+    "\xc5+\xc7\xcf", /* е+го */
+    "\xcf\xc7\xcf+", /* ого+ */
+    "\xc5\xc7\xcf+", /* его+ */
+    "\xd4\xd3\xd1", /* тся */
+    "\xd4\xd8\xd3\xd1", /* ться */
+    "\xd4\xd8", /* ть */
+    ""
+  };
+static const char *followers[] = { " ", ", ", ". ", "\xc1 " };
+
+/* Reference values produced with the character lists */
+#define EXPECTED_CLAUSES 46497UL
+#define EXPECTED_LENGTH 488763UL
+#define EXPECTED_CHECKSUM 0x4852436AUL
+
+/* Transcription summary */
+static unsigned long clauses = 0;
+static unsigned long total_length = 0;
+static uint32_t checksum = 2166136261UL;
+
+
+/* Local subroutines */
+
+/* Accumulate FNV-1a hash of the data */
+static void hash(const uint8_t *data, size_t length)
+{
+  size_t i;
+
+  for (i = 0; i < length; i++)
+    checksum = (checksum ^ data[i]) * 16777619UL;
+}
+
+/* Transcription consumer */
+static int collect(void *buffer, size_t length, void *user_data)
+{
+  ttscb_t *ttscb = user_data;
+  uint8_t clause_type = ttscb->transcription_state.clause_type;
+
+  hash(buffer, length);
+  hash(&clause_type, 1);
+  clauses++;
+  total_length += length;
+  return 0;
+}
+
+/* Append string to the text */
+static char *append(char *text, const char *s)
+{
+  size_t length = strlen(s);
+
+  memcpy(text, s, length);
+  return text + length;
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  size_t n = sizeof(charset) - 1;
+  uint8_t transcription[TRANSCRIPTION_BUFFER_SIZE];
+  sink_t consumer;
+  ttscb_t ttscb;
+  input_t *input;
+  char *text, *s;
+  unsigned int i, j, k;
+
+  text = malloc(n * n * n * 4 + 4096);
+  input = malloc(sizeof(input_t));
+  if (!text || !input)
+    return EXIT_FAILURE;
+
+  s = text;
+  for (i = 0; i < n; i++)
+    for (j = 0; j < n; j++)
+      for (k = 0; k < n; k++)
+        {
+          *s++ = charset[i];
+          *s++ = charset[j];
+          *s++ = charset[k];
+          *s++ = ' ';
+        }
+  for (i = 0; i < sizeof(stems) / sizeof(stems[0]); i++)
+    for (j = 0; j < sizeof(suffixes) / sizeof(suffixes[0]); j++)
+      for (k = 0; k < sizeof(followers) / sizeof(followers[0]); k++)
+        {
+          s = append(s, stems[i]);
+          s = append(s, suffixes[j]);
+          s = append(s, followers[k]);
+        }
+
+  memset(&ttscb, 0, sizeof(ttscb));
+  ttscb.flags = DEC_SEP_POINT | DEC_SEP_COMMA;
+  sink_setup(&consumer, transcription, TRANSCRIPTION_MAXLEN, collect, &ttscb);
+  memset(input, 0, sizeof(input_t));
+  input_reset(input, 0);
+  process_text(text, s - text, input, &consumer);
+
+  free(input);
+  free(text);
+  if ((clauses != EXPECTED_CLAUSES) || (total_length != EXPECTED_LENGTH) ||
+      (checksum != EXPECTED_CHECKSUM))
+    {
+      fprintf(stderr, "%lu clauses of %lu codes with checksum 0x%08lX "
+              "instead of %lu clauses of %lu codes with checksum 0x%08lX\n",
+              clauses, total_length, (unsigned long) checksum,
+              EXPECTED_CLAUSES, EXPECTED_LENGTH, EXPECTED_CHECKSUM);
+      return EXIT_FAILURE;
+    }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,111 @@
+/* utf8_input.c -- Check UTF-8 input against its koi8-r equivalent
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Text in UTF-8 must sound exactly as the same text in koi8-r
+ * with dashes, quotes, ellipses and accents spelled the way
+ * they are mapped there.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ru_tts.h"
+
+
+/* Local data */
+
+static const struct
+{
+  const char *utf8;
+  const char *koi8;
+} texts[] =
+  {
+    { "а. — б",
+      "\xc1. - \xc2" },
+    { "Он сказал — нет… Да.",
+      "\xef\xce \xd3\xcb\xc1\xda\xc1\xcc - \xce\xc5\xd4... \xe4\xc1." },
+    { "«Москва́» — столица.",
+      "\"\xed\xcf\xd3\xcb\xd7\xc1+\" - \xd3\xd4\xcf\xcc\xc9\xc3\xc1." },
+    { "Ёлка – ёж, не так ли?",
+      "\xb3\xcc\xcb\xc1 - \xa3\xd6, \xce\xc5 \xd4\xc1\xcb \xcc\xc9?" },
+    { "Подожди…",
+      "\xf0\xcf\xc4\xcf\xd6\xc4\xc9..." }
+  };
+
+
+/* Local subroutines */
+
+typedef struct
+{
+  char *data;
+  size_t size;
+} sound_t;
+
+/* Sound collector */
+static int collect(void *buffer, size_t size, void *user_data)
+{
+  sound_t *sound = user_data;
+  char *data = realloc(sound->data, sound->size + size);
+
+  if (!data)
+    return 1;
+  memcpy(data + sound->size, buffer, size);
+  sound->data = data;
+  sound->size += size;
+  return 0;
+}
+
+/* Speak the text collecting produced sound */
+static void speak(ru_tts_engine_t *engine, const char *text, int flags, sound_t *sound)
+{
+  ru_tts_conf_t config;
+  char wave[4096];
+
+  ru_tts_config_init(&config);
+  config.flags |= flags;
+  sound->data = NULL;
+  sound->size = 0;
+  ru_tts_engine_transfer(engine, &config, text, wave, sizeof(wave), collect, sound);
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  ru_tts_engine_t *engine = ru_tts_engine_new();
+  unsigned int i;
+  int rc = EXIT_SUCCESS;
+
+  if (!engine)
+    return EXIT_FAILURE;
+
+  for (i = 0; i < sizeof(texts) / sizeof(texts[0]); i++)
+    {
+      sound_t utf8, koi8;
+      speak(engine, texts[i].utf8, INPUT_UTF8, &utf8);
+      speak(engine, texts[i].koi8, 0, &koi8);
+      if (!utf8.size || (utf8.size != koi8.size) ||
+          memcmp(utf8.data, koi8.data, utf8.size))
+        {
+          fprintf(stderr, "\"%s\": %lu samples in UTF-8, %lu in koi8-r\n",
+                  texts[i].utf8, (unsigned long) utf8.size,
+                  (unsigned long) koi8.size);
+          rc = EXIT_FAILURE;
+        }
+      free(utf8.data);
+      free(koi8.data);
+    }
+
+  ru_tts_engine_free(engine);
+  return rc;
+}
@@ -0,0 +1,167 @@
+/* word_cache.c -- Check the word transcriptions cache
+ *
+ * Copyright (C) 1990, 1991 Speech Research Laboratory, Minsk
+ * Copyright (C) 2005 Igor Poretsky <poretsky@mlbox.ru>
+ * Copyright (C) 2021 Boris Lobanov <lobbormef@gmail.com>
+ * Copyright (C) 2021 Alexander Ivanov <ivalex01@gmail.com>
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*
+ * Repeated words must be taken from the cache, but the speech
+ * must stay exactly the same as without it. Texts with repeated
+ * words are spoken by transfer and by streaming with caches
+ * of several sizes, including the one that keeps only a single word.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ru_tts.h"
+
+
+/* Local macros */
+
+#define PHRASE_REPEAT 20
+
+/* Chunk size the text is streamed in */
+#define STREAM_CHUNK 13
+
+
+/* Local data */
+
+static const struct
+{
+  const char *phrase;
+  int flags;
+} texts[] =
+  {
+    { "Съешь же ещё этих мягких французских булок, да выпей чаю. ", INPUT_UTF8 },
+    { "Он сказа+л: \"Это моего+ друга дом, а не твоего+\". Ничего= страшного! ", INPUT_UTF8 },
+    { "Тот тётя тут, дядя Дима; те тени тянутся. Оттого= и сто+ит 25 рублей? ", INPUT_UTF8 },
+    { "\xd3\xdf\xc5\xdb\xd8 \xd6\xc5 \xc5\xdd\xa3 \xdc\xd4\xc9\xc8 \xcd\xd1\xc7\xcb\xc9\xc8 "
+      "\xc6\xd2\xc1\xce\xc3\xd5\xda\xd3\xcb\xc9\xc8 \xc2\xd5\xcc\xcf\xcb, \xc4\xc1 "
+      "\xd7\xd9\xd0\xc5\xca \xde\xc1\xc0. ", 0 }
+  };
+
+/* Cache sizes in words */
+static const size_t cache_sizes[] = { 1, 16, 1024 };
+
+
+/* Local subroutines */
+
+typedef struct
+{
+  char *data;
+  size_t size;
+} sound_t;
+
+/* Sound collector */
+static int collect(void *buffer, size_t size, void *user_data)
+{
+  sound_t *sound = user_data;
+  char *data = realloc(sound->data, sound->size + size);
+
+  if (!data)
+    return 1;
+  memcpy(data + sound->size, buffer, size);
+  sound->data = data;
+  sound->size += size;
+  return 0;
+}
+
+/* Speak the text by transfer or by streaming */
+static void speak(ru_tts_engine_t *engine, const ru_tts_conf_t *config,
+                  const char *text, size_t length, int stream, sound_t *sound)
+{
+  char wave[4096];
+  size_t offset;
+
+  if (!stream)
+    {
+      ru_tts_engine_transfer_n(engine, config, text, length, wave, sizeof(wave), collect, sound);
+      return;
+    }
+  ru_tts_stream_begin(engine, config, wave, sizeof(wave), collect, sound);
+  for (offset = 0; offset < length; offset += STREAM_CHUNK)
+    ru_tts_stream_push(engine, text + offset,
+                       ((length - offset) < STREAM_CHUNK) ? (length - offset) : STREAM_CHUNK);
+  ru_tts_stream_finish(engine);
+}
+
+
+/* Main routine */
+
+int main(int argc, char **argv)
+{
+  ru_tts_engine_t *engine = ru_tts_engine_new();
+  ru_tts_conf_t config;
+  unsigned long hits, misses;
+  char *text;
+  unsigned int i, j, stream;
+  int rc = EXIT_SUCCESS;
+
+  text = malloc(PHRASE_REPEAT * 128);
+  if (!engine || !text)
+    return EXIT_FAILURE;
+
+  for (i = 0; i < sizeof(texts) / sizeof(texts[0]); i++)
+    {
+      size_t length = strlen(texts[i].phrase);
+
+      for (j = 0; j < PHRASE_REPEAT; j++)
+        memcpy(text + j * length, texts[i].phrase, length);
+      length *= PHRASE_REPEAT;
+      ru_tts_config_init(&config);
+      config.flags |= texts[i].flags;
+
+      for (stream = 0; stream < 2; stream++)
+        {
+          sound_t plain = { NULL, 0 };
+
+          ru_tts_engine_word_cache(engine, 0);
+          speak(engine, &config, text, length, stream, &plain);
+          ru_tts_engine_word_cache_stats(engine, &hits, &misses);
+          if (hits || misses)
+            {
+              fprintf(stderr, "Text %u: %lu hits and %lu misses without cache\n", i, hits, misses);
+              rc = EXIT_FAILURE;
+            }
+
+          for (j = 0; j < sizeof(cache_sizes) / sizeof(cache_sizes[0]); j++)
+            {
+              sound_t cached = { NULL, 0 };
+
+              if (ru_tts_engine_word_cache(engine, cache_sizes[j]))
+                {
+                  rc = EXIT_FAILURE;
+                  continue;
+                }
+              speak(engine, &config, text, length, stream, &cached);
+              ru_tts_engine_word_cache_stats(engine, &hits, &misses);
+              if ((cached.size != plain.size) || memcmp(cached.data, plain.data, plain.size))
+                {
+                  fprintf(stderr, "Text %u %s with cache of %lu words: %lu samples instead of %lu\n",
+                          i, stream ? "streamed" : "transferred", (unsigned long) cache_sizes[j],
+                          (unsigned long) cached.size, (unsigned long) plain.size);
+                  rc = EXIT_FAILURE;
+                }
+              if (!misses || ((cache_sizes[j] > 16) && (hits < misses)))
+                {
+                  fprintf(stderr, "Text %u %s with cache of %lu words: %lu hits and %lu misses\n",
+                          i, stream ? "streamed" : "transferred", (unsigned long) cache_sizes[j],
+                          hits, misses);
+                  rc = EXIT_FAILURE;
+                }
+              free(cached.data);
+            }
+          free(plain.data);
+        }
+    }
+
+  ru_tts_engine_free(engine);
+  free(text);
+  return rc;
+}